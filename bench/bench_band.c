@@ -0,0 +1,87 @@
+/* 带状/三对角基准：tridiag_solve、band_lu（kl = ku = 1 与给定带宽）、tridiag_batch_solve
+ * 用法：bench_band [n] [bw] [count] [nthreads]，默认 n = 1<<20，bw = 8，count = 4096，nthreads = 0
+ * 单系统输出秒数；批量模式以 n = 256 的 count 个系统输出每秒求解数。 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Gaussian.h"
+#include "gaussian_band.h"
+#include "gaussian_batch.h"
+#define TEST_SEED 0x9E3779B97F4A7C15ULL
+#include "test_gaussian_common.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static double time_band(size_t n, size_t bw, const double *b, double *x) {
+    const size_t ldab = BAND_LDAB_LU(bw, bw);
+    double *AB = (double*)malloc(n * ldab * sizeof(double));
+    size_t *ipiv = (size_t*)malloc(n * sizeof(size_t));
+    if (!AB || !ipiv) { free(AB); free(ipiv); return -1.0; }
+    for (size_t i = 0; i < n * ldab; ++i) AB[i] = rand_unit();
+    for (size_t i = 0; i < n; ++i) AB[BAND_IDX(i, i, ldab, bw)] += 2.0 * (double)bw + 1.0;
+    double t0 = now_sec();
+    GAUSSIAN_Err r = band_lu_decompose(n, bw, bw, AB, ldab, ipiv);
+    if (r == GAUSSIAN_SUCCESS) band_lu_solve(n, bw, bw, AB, ldab, ipiv, b, x);
+    double t = now_sec() - t0;
+    free(AB); free(ipiv);
+    return r == GAUSSIAN_SUCCESS ? t : -1.0;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : (size_t)1 << 20;
+    size_t bw = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 8;
+    size_t count = argc > 3 ? (size_t)strtoul(argv[3], NULL, 10) : 4096;
+    size_t nthreads = argc > 4 ? (size_t)strtoul(argv[4], NULL, 10) : 0;
+    if (n == 0) {
+        fprintf(stderr, "usage: %s [n] [bw] [count] [nthreads]\n", argv[0]);
+        return 1;
+    }
+
+    double *dl = (double*)malloc(n * sizeof(double));
+    double *d = (double*)malloc(n * sizeof(double));
+    double *du = (double*)malloc(n * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    if (!dl || !d || !du || !b || !x) { fprintf(stderr, "out of memory\n"); return 1; }
+    for (size_t i = 0; i < n; ++i) {
+        dl[i] = rand_unit(); du[i] = rand_unit(); d[i] = 3.0 + rand_unit(); b[i] = rand_unit();
+    }
+
+    double t0 = now_sec();
+    tridiag_solve(n, dl, d, du, b, x);
+    double t_thomas = now_sec() - t0;
+    printf("n=%zu  thomas %.4f s   band_lu(1,1) %.4f s   band_lu(%zu,%zu) %.4f s\n",
+           n, t_thomas, time_band(n, 1, b, x), bw, bw, time_band(n, bw, b, x));
+    free(dl); free(d); free(du); free(b); free(x);
+
+    const size_t m = 256, len = gauss_batch_size_x(m, count);
+    double *Bl = (double*)malloc(len * sizeof(double)), *Bd = (double*)malloc(len * sizeof(double));
+    double *Bu = (double*)malloc(len * sizeof(double)), *Bb = (double*)malloc(len * sizeof(double));
+    double *Bx = (double*)malloc(len * sizeof(double));
+    if (!Bl || !Bd || !Bu || !Bb || !Bx) { fprintf(stderr, "out of memory\n"); return 1; }
+    for (size_t i = 0; i < len; ++i) {
+        Bl[i] = rand_unit(); Bu[i] = rand_unit(); Bd[i] = 3.0 + rand_unit(); Bb[i] = rand_unit();
+    }
+    double s0 = 0.0;
+    {
+        double xs[256];
+        t0 = now_sec();
+        for (size_t s = 0; s < count; ++s)     /* 基线：逐个求解同规模系统（数据取缓冲区开头，只计时） */
+            tridiag_solve(m, Bl, Bd, Bu, Bb, xs);
+        s0 = count / (now_sec() - t0);
+    }
+    t0 = now_sec();
+    tridiag_batch_solve(m, count, Bl, Bd, Bu, Bb, Bx, NULL, 1);
+    double s1 = count / (now_sec() - t0);
+    t0 = now_sec();
+    tridiag_batch_solve(m, count, Bl, Bd, Bu, Bb, Bx, NULL, nthreads);
+    double s2 = count / (now_sec() - t0);
+    printf("batch n=%zu count=%zu  single %.3e sys/s   batch-1T %.3e sys/s   batch-MT %.3e sys/s\n",
+           m, count, s0, s1, s2);
+    free(Bl); free(Bd); free(Bu); free(Bb); free(Bx);
+    return 0;
+}
@@ -0,0 +1,61 @@
+/* 批量小系统基准：gauss_batch_solve vs 逐个 gauss_pp_core
+ * 用法：bench_batch [count] [nthreads]，默认 count = 1<<20，nthreads = 0（全部 CPU）
+ * 对 n = 3..16 输出每秒求解的系统数。 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+#include "gaussian_batch.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : (size_t)1 << 20;
+    size_t nthreads = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 0;
+
+    printf("%4s %16s %16s %16s %8s\n", "n", "core(sys/s)", "batch-1T(sys/s)", "batch-MT(sys/s)", "speedup");
+    for (size_t n = 3; n <= GAUSSIAN_BATCH_MAX_N; ++n) {
+        const size_t lda = n + 1;
+        double *A = (double*)malloc(count * n * lda * sizeof(double));
+        double *work = (double*)malloc(n * lda * sizeof(double));
+        double *Ab = (double*)malloc(gauss_batch_size_A(n, count) * sizeof(double));
+        double *xb = (double*)malloc(gauss_batch_size_x(n, count) * sizeof(double));
+        double *x = (double*)malloc(n * sizeof(double));
+        if (!A || !work || !Ab || !xb || !x) {
+            fprintf(stderr, "n=%zu: out of memory\n", n);
+            return 1;
+        }
+        unsigned long long s = 0x9E3779B97F4A7C15ULL;
+        for (size_t i = 0; i < count * n * lda; ++i) {
+            s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+            A[i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+        }
+        gauss_batch_pack(n, count, A, lda, Ab);
+
+        /* 基线：每个系统拷贝后调用 gauss_pp_core（其为就地算法） */
+        double t0 = now_sec();
+        for (size_t k = 0; k < count; ++k) {
+            memcpy(work, A + k * n * lda, n * lda * sizeof(double));
+            gauss_pp_core(n, work, lda, x);
+        }
+        double t_core = now_sec() - t0;
+
+        t0 = now_sec();
+        gauss_batch_solve(n, count, Ab, xb, NULL, 1);
+        double t_b1 = now_sec() - t0;
+
+        t0 = now_sec();
+        gauss_batch_solve(n, count, Ab, xb, NULL, nthreads);
+        double t_bm = now_sec() - t0;
+
+        printf("%4zu %16.3e %16.3e %16.3e %8.2f\n", n,
+               count / t_core, count / t_b1, count / t_bm, t_core / t_bm);
+        free(A); free(work); free(Ab); free(xb); free(x);
+    }
+    return 0;
+}
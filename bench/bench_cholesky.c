@@ -0,0 +1,73 @@
+/* Cholesky 基准：cholesky_decompose（1 线程 / 多线程）vs lu_decompose_blocked
+ * 用法：bench_cholesky [n_min] [n_max] [nthreads]，默认 1000..8000（n 每次翻倍），nthreads = 0
+ * GFLOP/s 按 Cholesky n^3/3、LU 2n^3/3 计。 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* 对角占优的对称矩阵（因此正定） */
+static void fill_spd(size_t n, double *A) {
+    unsigned long long s = 0x9E3779B97F4A7C15ULL ^ n;
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j <= i; ++j) {
+            s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+            double v = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+            A[i * n + j] = A[j * n + i] = v;
+        }
+    for (size_t i = 0; i < n; ++i) A[i * n + i] = (double)n + 1.0;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n_min = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 1000;
+    size_t n_max = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 8000;
+    size_t nthreads = argc > 3 ? (size_t)strtoul(argv[3], NULL, 10) : 0;
+    if (n_min == 0 || n_max < n_min) {
+        fprintf(stderr, "usage: %s [n_min] [n_max] [nthreads]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%6s %12s %9s %12s %9s %12s %9s\n", "n",
+           "chol-1T(s)", "GFLOP/s", "chol-MT(s)", "GFLOP/s", "lu(s)", "GFLOP/s");
+    for (size_t n = n_min; n <= n_max; n *= 2) {
+        double *A0 = (double*)malloc(n * n * sizeof(double));
+        double *A = (double*)malloc(n * n * sizeof(double));
+        size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+        if (!A0 || !A || !piv) {
+            fprintf(stderr, "n=%zu: out of memory\n", n);
+            return 1;
+        }
+        fill_spd(n, A0);
+        double fl = (double)n * (double)n * (double)n / 3.0;
+
+        memcpy(A, A0, n * n * sizeof(double));
+        double t0 = now_sec();
+        GAUSSIAN_Err r1 = cholesky_decompose(n, A, n, 1);
+        double t1 = now_sec() - t0;
+
+        memcpy(A, A0, n * n * sizeof(double));
+        t0 = now_sec();
+        GAUSSIAN_Err r2 = cholesky_decompose(n, A, n, nthreads);
+        double t2 = now_sec() - t0;
+
+        memcpy(A, A0, n * n * sizeof(double));
+        t0 = now_sec();
+        GAUSSIAN_Err r3 = lu_decompose_blocked(n, A, n, piv);
+        double t3 = now_sec() - t0;
+
+        if (r1 != GAUSSIAN_SUCCESS || r2 != GAUSSIAN_SUCCESS || r3 != GAUSSIAN_SUCCESS)
+            fprintf(stderr, "n=%zu: factorization failed (%d %d %d)\n", n, r1, r2, r3);
+        else
+            printf("%6zu %12.4f %9.2f %12.4f %9.2f %12.4f %9.2f\n", n,
+                   t1, fl / t1 * 1e-9, t2, fl / t2 * 1e-9, t3, 2.0 * fl / t3 * 1e-9);
+        free(A0); free(A); free(piv);
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+/* 对称特征值基准：非均匀二维刚度矩阵（s x s 网格、五点格式、随机边系数，n = s^2，
+ * 对称正定，带宽 s，按稠密矩阵存放）求 k 个特征对的时间
+ * 用法：bench_eig [nmax] [k] [nthreads]，默认 nmax = 4000，k = 10，nthreads = 0（全部 CPU）；
+ * n 取 500、1000、2000、4000 中不超过 nmax 的（网格取 s = floor(sqrt(n))）
+ * 对比：sym_eig 只求特征值 / sym_eig 求最小 k 个向量 / eig_shift_invert（sigma = 0，最小 k 个）
+ * / eig_shift_invert（sigma 取谱中部，内部 k 个）；输出耗时、迭代数与最大相对残差。 */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+#include "gaussian_eig.h"
+#include "gaussian_gemm.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* 单元边系数 c in [0.01, 1)，边 (p, q) 贡献 c (e_p - e_q)(e_p - e_q)^T；边界处接地 */
+static void stiffness_2d(size_t s, double *A) {
+    const size_t n = s * s;
+    unsigned long long seed = 0x9E3779B97F4A7C15ULL ^ n;
+    memset(A, 0, n * n * sizeof(double));
+    for (size_t i = 0; i < s; ++i)
+        for (size_t j = 0; j < s; ++j) {
+            const size_t p = i * s + j;
+            for (int dir = 0; dir < 4; ++dir) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                double c = 0.01 + 0.99 * (double)(seed >> 11) / 9007199254740992.0;
+                size_t q = n;
+                if (dir == 0 && j + 1 < s) q = p + 1;
+                else if (dir == 1 && i + 1 < s) q = p + s;
+                else if ((dir == 2 && i == 0) || (dir == 3 && j == 0)) q = n + 1;
+                if (q == n) continue;
+                A[IDX(p,p,n)] += c;
+                if (q > n) continue;
+                A[IDX(q,q,n)] += c;
+                A[IDX(p,q,n)] -= c;
+                A[IDX(q,p,n)] -= c;
+            }
+        }
+}
+
+/* max_i ||A x_i - lambda_i x_i||_2 / ||A||_1 */
+static double max_resid(size_t n, const double *A, size_t k, const double *lam,
+                        const double *X, double *AX) {
+    gaussian_gemm(GEMM_NO_TRANS, GEMM_TRANS, k, n, n, 1.0, X, n, A, n, 0.0, AX, n, 1);
+    const double anorm = mat_norm1(n, A, n);
+    double r = 0.0;
+    for (size_t i = 0; i < k; ++i) {
+        double s = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            double d = AX[IDX(i,j,n)] - lam[i] * X[IDX(i,j,n)];
+            s += d * d;
+        }
+        if (sqrt(s) / anorm > r) r = sqrt(s) / anorm;
+    }
+    return r;
+}
+
+int main(int argc, char *argv[]) {
+    size_t nmax = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 4000;
+    size_t k = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 10;
+    size_t nthreads = argc > 3 ? (size_t)strtoul(argv[3], NULL, 10) : 0;
+    static const size_t sizes[] = { 500, 1000, 2000, 4000 };
+    if (k == 0 || nmax < 500) {
+        fprintf(stderr, "usage: %s [nmax>=500] [k>=1] [nthreads]\n", argv[0]);
+        return 1;
+    }
+    printf("k=%zu nthreads=%zu\n", k, nthreads);
+    printf("%6s %-22s %10s %6s %12s\n", "n", "", "time(s)", "iters", "resid");
+    for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]) && sizes[si] <= nmax; ++si) {
+        size_t s = (size_t)sqrt((double)sizes[si]);
+        const size_t n = s * s;
+        if (k > n) k = n;
+        double *A = (double*)malloc(n * n * sizeof(double));
+        double *W = (double*)malloc(n * n * sizeof(double));
+        double *w = (double*)malloc(n * sizeof(double));
+        double *X = (double*)malloc(k * n * sizeof(double));
+        double *AX = (double*)malloc(k * n * sizeof(double));
+        double *lam = (double*)malloc(k * sizeof(double));
+        if (!A || !W || !w || !X || !AX || !lam) {
+            fprintf(stderr, "n=%zu: out of memory\n", n);
+            return 1;
+        }
+        stiffness_2d(s, A);
+
+        memcpy(W, A, n * n * sizeof(double));
+        double t1 = now_sec();
+        GAUSSIAN_Err e = sym_eig(n, W, n, w, 0, 0, NULL, n, nthreads);
+        double t2 = now_sec();
+        printf("%6zu %-22s %10.4f %6s %12s%s\n", n, "sym_eig values", t2 - t1, "-", "-",
+               e == GAUSSIAN_SUCCESS ? "" : " (failed)");
+        const double mid = 0.5 * (w[0] + w[n - 1]);
+
+        memcpy(W, A, n * n * sizeof(double));
+        t1 = now_sec();
+        e = sym_eig(n, W, n, w, 0, k - 1, X, n, nthreads);
+        t2 = now_sec();
+        printf("%6zu %-22s %10.4f %6s %12.2e%s\n", n, "sym_eig k vectors", t2 - t1, "-",
+               max_resid(n, A, k, w, X, AX), e == GAUSSIAN_SUCCESS ? "" : " (failed)");
+
+        EigShiftOptions o;
+        EigShiftStatus st;
+        eig_shift_options_default(&o);
+        o.nthreads = nthreads;
+        const double sig[2] = { 0.0, mid };
+        static const char *names[2] = { "shift-invert sigma=0", "shift-invert interior" };
+        for (int v = 0; v < 2; ++v) {
+            t1 = now_sec();
+            e = eig_shift_invert(n, A, n, sig[v], k, lam, X, n, &o, &st);
+            t2 = now_sec();
+            printf("%6zu %-22s %10.4f %6zu %12.2e%s\n", n, names[v], t2 - t1, st.iterations,
+                   max_resid(n, A, k, lam, X, AX), e == GAUSSIAN_SUCCESS ? "" : " (failed)");
+        }
+        free(A); free(W); free(w); free(X); free(AX); free(lam);
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+/* GEMM 基准：C -= A * B（n x n，行主序）
+ * 用法：bench_gemm [n_min] [n_max] [nthreads]，默认 128..4096（n 每次翻倍），nthreads = 0（全部 CPU）
+ * 对比：axpy4 行更新（原 Schur 更新的写法）vs gaussian_gemm 单线程 vs gaussian_gemm 多线程，
+ * 输出耗时与 GFLOP/s（按 2 n^3 计），各取 3 次中最快的一次。 */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+#include "gaussian_gemm.h"
+#include "gaussian_simd.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void fill_random(size_t len, double *A, unsigned long long s) {
+    for (size_t i = 0; i < len; ++i) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        A[i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+    }
+}
+
+/* C -= A B：4 行一组，B 的每一行被复用 4 次，列方向 256 一块 */
+static void axpy_update(size_t n, const double *A, const double *B, double *C) {
+    const GaussianKernels *K = gaussian_kernels();
+    for (size_t j0 = 0; j0 < n; j0 += 256) {
+        size_t jb = n - j0 < 256 ? n - j0 : 256;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+            for (size_t p = 0; p < n; ++p) {
+                const double a[4] = { A[IDX(i,p,n)], A[IDX(i+1,p,n)],
+                                      A[IDX(i+2,p,n)], A[IDX(i+3,p,n)] };
+                K->axpy4(jb, a, &B[IDX(p,j0,n)], &C[IDX(i,j0,n)], &C[IDX(i+1,j0,n)],
+                         &C[IDX(i+2,j0,n)], &C[IDX(i+3,j0,n)]);
+            }
+        for (; i < n; ++i)
+            for (size_t p = 0; p < n; ++p)
+                K->axpy(jb, A[IDX(i,p,n)], &B[IDX(p,j0,n)], &C[IDX(i,j0,n)]);
+    }
+}
+
+static double max_diff(size_t len, const double *x, const double *y) {
+    double d = 0.0;
+    for (size_t i = 0; i < len; ++i)
+        if (fabs(x[i] - y[i]) > d) d = fabs(x[i] - y[i]);
+    return d;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n_min = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 128;
+    size_t n_max = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 4096;
+    size_t nthreads = argc > 3 ? (size_t)strtoul(argv[3], NULL, 10) : 0;
+    if (n_min == 0 || n_max < n_min) {
+        fprintf(stderr, "usage: %s [n_min] [n_max] [nthreads]\n", argv[0]);
+        return 1;
+    }
+
+    printf("kernel: %s\n", gaussian_kernels()->name);
+    printf("%8s %12s %10s %12s %10s %12s %10s %8s %10s\n",
+           "n", "axpy4(s)", "GFLOP/s", "gemm-1t(s)", "GFLOP/s", "gemm-mt(s)", "GFLOP/s",
+           "speedup", "max diff");
+    for (size_t n = n_min; n <= n_max; n *= 2) {
+        double *A = (double*)malloc(n * n * sizeof(double));
+        double *B = (double*)malloc(n * n * sizeof(double));
+        double *C0 = (double*)malloc(n * n * sizeof(double));
+        double *C1 = (double*)malloc(n * n * sizeof(double));
+        double *C2 = (double*)malloc(n * n * sizeof(double));
+        if (!A || !B || !C0 || !C1 || !C2) {
+            fprintf(stderr, "n=%zu: out of memory\n", n);
+            return 1;
+        }
+        fill_random(n * n, A, 0x9E3779B97F4A7C15ULL ^ n);
+        fill_random(n * n, B, 0x2545F4914F6CDD1DULL ^ n);
+
+        double t_ax = INFINITY, t_1 = INFINITY, t_mt = INFINITY;
+        int ok = 1;
+        for (int rep = 0; rep < 3 && ok; ++rep) {
+            memset(C0, 0, n * n * sizeof(double));
+            memset(C1, 0, n * n * sizeof(double));
+            memset(C2, 0, n * n * sizeof(double));
+            double t0 = now_sec();
+            axpy_update(n, A, B, C0);
+            double t1 = now_sec();
+            ok = gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, n, n, n, -1.0, A, n, B, n,
+                               1.0, C1, n, 1) == GAUSSIAN_SUCCESS;
+            double t2 = now_sec();
+            ok = ok && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, n, n, n, -1.0, A, n, B, n,
+                                     1.0, C2, n, nthreads) == GAUSSIAN_SUCCESS;
+            double t3 = now_sec();
+            if (t1 - t0 < t_ax) t_ax = t1 - t0;
+            if (t2 - t1 < t_1) t_1 = t2 - t1;
+            if (t3 - t2 < t_mt) t_mt = t3 - t2;
+        }
+        if (!ok) {
+            fprintf(stderr, "n=%zu: gemm failed\n", n);
+        } else {
+            double flops = 2.0 * (double)n * (double)n * (double)n;
+            double d = max_diff(n * n, C0, C1);
+            double d2 = max_diff(n * n, C1, C2);
+            printf("%8zu %12.4f %10.2f %12.4f %10.2f %12.4f %10.2f %8.2f %10.2e\n", n,
+                   t_ax, flops / t_ax * 1e-9, t_1, flops / t_1 * 1e-9,
+                   t_mt, flops / t_mt * 1e-9, t_ax / t_mt, d > d2 ? d : d2);
+        }
+        free(A); free(B); free(C0); free(C1); free(C2);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+/* 求逆基准：lu_inverse vs 对单位阵做 lu_solve_multi
+ * 用法：bench_inverse [n_min] [n_max]，默认 500..4000（n 每次翻倍）
+ * 输出分解耗时、两种求逆耗时，以及求逆与分解的耗时比；
+ * 另给出 O(n^2) 的 lu_condest 耗时与估计值，对照由逆矩阵得到的精确 rcond。 */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void fill_random(size_t n, double *A) {
+    unsigned long long s = 0x9E3779B97F4A7C15ULL ^ n;
+    for (size_t i = 0; i < n * n; ++i) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        A[i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+    }
+}
+
+/* ||A X - I||_max，抽查 16 行 */
+static double inverse_error(size_t n, const double *A, const double *X) {
+    double err = 0.0;
+    for (size_t t = 0; t < 16; ++t) {
+        size_t i = (t * 7919) % n;
+        for (size_t j = 0; j < n; ++j) {
+            double s = (i == j) ? -1.0 : 0.0;
+            for (size_t k = 0; k < n; ++k) s += A[i * n + k] * X[k * n + j];
+            if (fabs(s) > err) err = fabs(s);
+        }
+    }
+    return err;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n_min = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 500;
+    size_t n_max = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 4000;
+    if (n_min == 0 || n_max < n_min) {
+        fprintf(stderr, "usage: %s [n_min] [n_max]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%6s %10s %12s %10s %14s %10s %10s %11s %10s %10s\n", "n", "factor(s)", "inverse(s)",
+           "ratio", "solve_multi(s)", "ratio", "||AX-I||", "condest(s)", "rcond", "exact");
+    for (size_t n = n_min; n <= n_max; n *= 2) {
+        double *A = (double*)malloc(n * n * sizeof(double));
+        double *LU = (double*)malloc(n * n * sizeof(double));
+        double *E = (double*)calloc(n * n, sizeof(double));
+        double *X = (double*)malloc(n * n * sizeof(double));
+        size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+        if (!A || !LU || !E || !X || !piv) {
+            fprintf(stderr, "n=%zu: out of memory\n", n);
+            free(A); free(LU); free(E); free(X); free(piv);
+            return 1;
+        }
+        fill_random(n, A);
+        for (size_t i = 0; i < n; ++i) E[i * n + i] = 1.0;
+
+        double anorm = mat_norm1(n, A, n), rcond = 0.0;
+        memcpy(LU, A, n * n * sizeof(double));
+        double t0 = now_sec();
+        GAUSSIAN_Err r = lu_decompose_blocked(n, LU, n, piv);
+        double t_f = now_sec() - t0;
+
+        t0 = now_sec();
+        if (r == GAUSSIAN_SUCCESS) r = lu_solve_multi(n, LU, n, piv, n, E, n, X, n);
+        double t_s = now_sec() - t0;
+
+        t0 = now_sec();
+        if (r == GAUSSIAN_SUCCESS) r = lu_condest(n, LU, n, piv, anorm, &rcond);
+        double t_c = now_sec() - t0;
+
+        t0 = now_sec();
+        if (r == GAUSSIAN_SUCCESS) r = lu_inverse(n, LU, n, piv);
+        double t_i = now_sec() - t0;
+        if (r != GAUSSIAN_SUCCESS) {
+            fprintf(stderr, "n=%zu: failed (%d)\n", n, (int)r);
+        } else {
+            printf("%6zu %10.3f %12.3f %9.2fx %14.3f %9.2fx %10.2e %11.4f %10.3e %10.3e\n", n, t_f,
+                   t_i, t_i / t_f, t_s, t_s / t_f, inverse_error(n, A, LU), t_c, rcond,
+                   1.0 / (anorm * mat_norm1(n, LU, n)));
+        }
+        free(A); free(LU); free(E); free(X); free(piv);
+    }
+    return 0;
+}
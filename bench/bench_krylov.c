@@ -0,0 +1,75 @@
+/* Krylov 基准：二维 Poisson（nx*nx 阶）上 CG / BiCGSTAB / GMRES(30) × 无 / Jacobi / ILU(0)
+ * 用法：bench_krylov [nx] [nthreads]，默认 nx = 512（约 2.6e5 未知数），nthreads = 0
+ * 输出迭代数、耗时、每次迭代耗时与真实相对残差。 */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "iterative.h"
+#include "sparse.h"
+
+typedef GAUSSIAN_Err (*KrylovFn)(const CsrMatrix *A, const double *b, double *x,
+                                 const IterOptions *opts, IterStatus *status);
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+    size_t nx = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 512;
+    size_t nthreads = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 0;
+    if (nx < 2) {
+        fprintf(stderr, "usage: %s [nx] [nthreads]\n", argv[0]);
+        return 1;
+    }
+
+    CsrMatrix A;
+    double t0 = now_sec();
+    if (csr_poisson2d(nx, nx, &A) != GAUSSIAN_SUCCESS) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    const size_t n = A.nrows;
+    printf("poisson2d %zux%zu: n=%zu nnz=%zu (generated in %.3f s)\n", nx, nx, n, A.nnz, now_sec() - t0);
+
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    double *r = (double*)malloc(n * sizeof(double));
+    if (!b || !x || !r) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < n; ++i) b[i] = 1.0;
+
+    const char *names[3] = { "cg", "bicgstab", "gmres(30)" };
+    const KrylovFn fns[3] = { krylov_cg, krylov_bicgstab, krylov_gmres };
+    const char *pcs[3] = { "none", "jacobi", "ilu0" };
+
+    printf("%-10s %-7s %7s %10s %12s %12s %s\n", "solver", "precond", "iters", "time(s)", "ms/iter", "residual", "status");
+    for (int s = 0; s < 3; ++s) {
+        for (int p = 0; p < 3; ++p) {
+            IterOptions opts;
+            iter_options_default(&opts);
+            opts.max_iter = 10000;
+            opts.precond = (IterPrecond)p;
+            opts.nthreads = nthreads;
+            IterStatus st = { 0, 0.0, NULL, 0, 0, 0.0 };
+            for (size_t i = 0; i < n; ++i) x[i] = 0.0;
+
+            t0 = now_sec();
+            GAUSSIAN_Err ret = fns[s](&A, b, x, &opts, &st);
+            double t = now_sec() - t0;
+
+            csr_spmv(&A, x, r, NULL);
+            double rr = 0.0, bb = 0.0;
+            for (size_t i = 0; i < n; ++i) { rr += (b[i] - r[i]) * (b[i] - r[i]); bb += b[i] * b[i]; }
+            printf("%-10s %-7s %7zu %10.3f %12.3f %12.3e %d\n", names[s], pcs[p], st.iterations, t,
+                   st.iterations ? t * 1e3 / (double)st.iterations : 0.0, sqrt(rr / bb), (int)ret);
+        }
+    }
+    free(b); free(x); free(r);
+    csr_free(&A);
+    return 0;
+}
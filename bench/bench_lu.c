@@ -0,0 +1,71 @@
+/* LU 分解基准：lu_decompose_pp vs lu_decompose_blocked vs lu_decompose_recursive
+ * 用法：bench_lu [n_min] [n_max]，默认 256..8192（n 每次翻倍）
+ * 输出每个 n 的耗时与 GFLOP/s（按 2/3 n^3 计）；speedup 为相对 pp 的加速比。 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+
+typedef GAUSSIAN_Err (*LuFn)(size_t n, double *A, size_t lda, size_t *piv);
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void fill_random(size_t n, double *A) {
+    unsigned long long s = 0x9E3779B97F4A7C15ULL ^ n;
+    for (size_t i = 0; i < n * n; ++i) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        A[i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+    }
+}
+
+/* 返回秒数；失败返回负值 */
+static double time_lu(LuFn fn, size_t n, const double *A0, double *A, size_t *piv) {
+    memcpy(A, A0, n * n * sizeof(double));
+    double t0 = now_sec();
+    GAUSSIAN_Err ret = fn(n, A, n, piv);
+    double t1 = now_sec();
+    return ret == GAUSSIAN_SUCCESS ? t1 - t0 : -1.0;
+}
+
+int main(int argc, char *argv[]) {
+    size_t n_min = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 256;
+    size_t n_max = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 8192;
+    if (n_min == 0 || n_max < n_min) {
+        fprintf(stderr, "usage: %s [n_min] [n_max]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%8s %12s %10s %12s %10s %8s %14s %10s %8s\n",
+           "n", "pp(s)", "GFLOP/s", "blocked(s)", "GFLOP/s", "speedup",
+           "recursive(s)", "GFLOP/s", "speedup");
+    for (size_t n = n_min; n <= n_max; n *= 2) {
+        double *A0 = (double*)malloc(n * n * sizeof(double));
+        double *A = (double*)malloc(n * n * sizeof(double));
+        size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+        if (!A0 || !A || !piv) {
+            fprintf(stderr, "n=%zu: out of memory\n", n);
+            free(A0); free(A); free(piv);
+            return 1;
+        }
+        fill_random(n, A0);
+
+        double flops = 2.0 / 3.0 * (double)n * (double)n * (double)n;
+        double t_pp = time_lu(lu_decompose_pp, n, A0, A, piv);
+        double t_bl = time_lu(lu_decompose_blocked, n, A0, A, piv);
+        double t_re = time_lu(lu_decompose_recursive, n, A0, A, piv);
+        if (t_pp < 0 || t_bl < 0 || t_re < 0) {
+            fprintf(stderr, "n=%zu: factorization failed\n", n);
+        } else {
+            printf("%8zu %12.4f %10.2f %12.4f %10.2f %8.2f %14.4f %10.2f %8.2f\n", n,
+                   t_pp, flops / t_pp * 1e-9, t_bl, flops / t_bl * 1e-9, t_pp / t_bl,
+                   t_re, flops / t_re * 1e-9, t_pp / t_re);
+        }
+        free(A0); free(A); free(piv);
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+/* 分片多线程 LU 与 CALU（锦标赛选主元）基准：相对串行 lu_decompose_pp 的加速比
+ * 用法：bench_lu_tiled [n] [nb]，默认 n = 4096，nb = 128（CALU 取其默认面板宽度）
+ * 依次测试 1/2/4/8/16 线程。 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void fill_random(size_t n, double *A) {
+    unsigned long long s = 0x9E3779B97F4A7C15ULL ^ n;
+    for (size_t i = 0; i < n * n; ++i) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        A[i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 4096;
+    size_t nb = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 128;
+    static const size_t threads[] = { 1, 2, 4, 8, 16 };
+
+    double *A0 = (double*)malloc(n * n * sizeof(double));
+    double *A = (double*)malloc(n * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    if (!A0 || !A || !piv) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    fill_random(n, A0);
+    double flops = 2.0 / 3.0 * (double)n * (double)n * (double)n;
+
+    memcpy(A, A0, n * n * sizeof(double));
+    double t0 = now_sec();
+    if (lu_decompose_pp(n, A, n, piv) != GAUSSIAN_SUCCESS) {
+        fprintf(stderr, "lu_decompose_pp failed\n");
+        return 1;
+    }
+    double t_serial = now_sec() - t0;
+    printf("n=%zu nb=%zu serial lu_decompose_pp: %.4f s (%.2f GFLOP/s)\n",
+           n, nb, t_serial, flops / t_serial * 1e-9);
+
+    printf("%8s %12s %10s %8s %12s %10s %8s\n", "threads", "tiled(s)", "GFLOP/s", "speedup",
+           "calu(s)", "GFLOP/s", "speedup");
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        memcpy(A, A0, n * n * sizeof(double));
+        t0 = now_sec();
+        GAUSSIAN_Err ret = lu_decompose_tiled(n, A, n, piv, nb, threads[t]);
+        double dt = now_sec() - t0;
+        if (ret != GAUSSIAN_SUCCESS) {
+            fprintf(stderr, "threads=%zu: lu_decompose_tiled failed (%d)\n", threads[t], ret);
+            continue;
+        }
+        memcpy(A, A0, n * n * sizeof(double));
+        t0 = now_sec();
+        ret = lu_decompose_calu(n, A, n, piv, 0, threads[t]);
+        double dc = now_sec() - t0;
+        if (ret != GAUSSIAN_SUCCESS) {
+            fprintf(stderr, "threads=%zu: lu_decompose_calu failed (%d)\n", threads[t], ret);
+            continue;
+        }
+        printf("%8zu %12.4f %10.2f %8.2f %12.4f %10.2f %8.2f\n", threads[t],
+               dt, flops / dt * 1e-9, t_serial / dt, dc, flops / dc * 1e-9, t_serial / dc);
+    }
+    free(A0); free(A); free(piv);
+    return 0;
+}
@@ -0,0 +1,85 @@
+/* 混合精度 LU 基准：mixed_lu_solve vs 双精度 lu_decompose_blocked + lu_solve
+ * 用法：bench_mixed [n_min] [n_max]，默认 256..2048（n 每次翻倍）
+ * 每个 n 两种矩阵：random（[-1,1] 均匀分布）与 near-singular（末行为前两行平均
+ * 加 1e-10 扰动，cond ~ 1e10 > 1/FLT_EPSILON，细化停滞后回退双精度）。
+ * 输出耗时、细化步数与后向误差 ||b - A x||_inf / (||A||_inf ||x||_inf + ||b||_inf)。 */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+#include "gaussian_mixed.h"
+#include "test_gaussian_common.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static double backward_error(size_t n, const double *A, const double *b, const double *x) {
+    double rn = 0.0, an = 0.0, xn = 0.0, bn = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double s = 0.0, ra = 0.0;
+        for (size_t j = 0; j < n; ++j) { s += A[i * n + j] * x[j]; ra += fabs(A[i * n + j]); }
+        if (fabs(b[i] - s) > rn) rn = fabs(b[i] - s);
+        if (ra > an) an = ra;
+        if (fabs(x[i]) > xn) xn = fabs(x[i]);
+        if (fabs(b[i]) > bn) bn = fabs(b[i]);
+    }
+    return rn / (an * xn + bn);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n_min = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 256;
+    size_t n_max = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 2048;
+    if (n_min < 2 || n_max < n_min) {
+        fprintf(stderr, "usage: %s [n_min>=2] [n_max]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%6s %-14s %10s %11s %10s %6s %9s %11s %8s\n", "n", "matrix",
+           "double(s)", "berr", "mixed(s)", "iters", "fallback", "berr", "speedup");
+    for (size_t n = n_min; n <= n_max; n *= 2) {
+        double *A = (double*)malloc(n * n * sizeof(double));
+        double *LU = (double*)malloc(n * n * sizeof(double));
+        double *b = (double*)malloc(n * sizeof(double));
+        double *x = (double*)malloc(n * sizeof(double));
+        size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+        if (!A || !LU || !b || !x || !piv) {
+            fprintf(stderr, "n=%zu: out of memory\n", n);
+            free(A); free(LU); free(b); free(x); free(piv);
+            return 1;
+        }
+        for (int kind = 0; kind < 2; ++kind) {
+            test_seed = 0x9E3779B97F4A7C15ULL ^ n;
+            for (size_t i = 0; i < n * n; ++i) A[i] = rand_unit();
+            for (size_t i = 0; i < n; ++i) b[i] = rand_unit();
+            if (kind == 1)
+                for (size_t j = 0; j < n; ++j)
+                    A[(n - 1) * n + j] = 0.5 * (A[j] + A[n + j]) + 1e-10 * rand_unit();
+
+            memcpy(LU, A, n * n * sizeof(double));
+            double t0 = now_sec();
+            GAUSSIAN_Err r1 = lu_decompose_blocked(n, LU, n, piv);
+            if (r1 == GAUSSIAN_SUCCESS) r1 = lu_solve(n, LU, n, piv, b, x);
+            double t_d = now_sec() - t0;
+            double berr_d = backward_error(n, A, b, x);
+
+            MixedStatus st;
+            t0 = now_sec();
+            GAUSSIAN_Err r2 = mixed_lu_solve(n, A, n, b, x, NULL, &st);
+            double t_m = now_sec() - t0;
+            if (r1 != GAUSSIAN_SUCCESS || r2 != GAUSSIAN_SUCCESS) {
+                fprintf(stderr, "n=%zu: solve failed (%d, %d)\n", n, (int)r1, (int)r2);
+                continue;
+            }
+            printf("%6zu %-14s %10.3f %11.3e %10.3f %6zu %9s %11.3e %7.2fx\n", n,
+                   kind ? "near-singular" : "random", t_d, berr_d, t_m, st.iterations,
+                   st.fallback ? "yes" : "no", backward_error(n, A, b, x), t_d / t_m);
+        }
+        free(A); free(LU); free(b); free(x); free(piv);
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+/* 最小二乘基准：超定 A X = b（m x n，m >> n）
+ * 用法：bench_qr [m] [n] [nthreads] [cond]，默认 m = 200000，n = 64，nthreads = 0（全部 CPU），
+ * cond = 1e6（A = 随机矩阵乘以几何递减的列尺度，条件数约为 cond）
+ * 对比：法方程（gaussian_gemm 形成 A^T A、A^T b + cholesky）vs qr_lstsq 单线程（分块 Householder）
+ * vs qr_lstsq 多线程（瘦高输入走 TSQR）；相容右端 b = A x_true，输出耗时与 ||x - x_true||_inf，
+ * 各取 3 次中最快的一次。 */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+#include "gaussian_gemm.h"
+#include "gaussian_qr.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void fill_random(size_t len, double *A, unsigned long long s) {
+    for (size_t i = 0; i < len; ++i) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        A[i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+    }
+}
+
+static double err_inf(size_t n, const double *x, const double *y) {
+    double d = 0.0;
+    for (size_t i = 0; i < n; ++i)
+        if (fabs(x[i] - y[i]) > d) d = fabs(x[i] - y[i]);
+    return d;
+}
+
+/* 法方程：G = A^T A，c = A^T b，G x = c（Cholesky） */
+static GAUSSIAN_Err normal_equations(size_t m, size_t n, const double *A, const double *b,
+                                     double *G, double *c, double *x, size_t nthreads) {
+    GAUSSIAN_Err ret = gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, n, m, 1.0, A, n, A, n,
+                                     0.0, G, n, nthreads);
+    if (ret == GAUSSIAN_SUCCESS)
+        ret = gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, 1, m, 1.0, A, n, b, 1,
+                            0.0, c, 1, nthreads);
+    if (ret == GAUSSIAN_SUCCESS) ret = cholesky_decompose(n, G, n, nthreads);
+    if (ret == GAUSSIAN_SUCCESS) ret = cholesky_solve(n, G, n, c, x);
+    return ret;
+}
+
+int main(int argc, char *argv[]) {
+    size_t m = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 200000;
+    size_t n = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 64;
+    size_t nthreads = argc > 3 ? (size_t)strtoul(argv[3], NULL, 10) : 0;
+    double cond = argc > 4 ? strtod(argv[4], NULL) : 1e6;
+    if (n == 0 || m < n || !(cond >= 1.0)) {
+        fprintf(stderr, "usage: %s [m] [n] [nthreads] [cond]\n", argv[0]);
+        return 1;
+    }
+
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double *W = (double*)malloc(m * n * sizeof(double));
+    double *b = (double*)malloc(m * sizeof(double));
+    double *bw = (double*)malloc(m * sizeof(double));
+    double *G = (double*)malloc(n * n * sizeof(double));
+    double *c = (double*)malloc(n * sizeof(double));
+    double *xt = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(3 * n * sizeof(double));
+    if (!A || !W || !b || !bw || !G || !c || !xt || !x) {
+        fprintf(stderr, "m=%zu n=%zu: out of memory\n", m, n);
+        return 1;
+    }
+    fill_random(m * n, A, 0x9E3779B97F4A7C15ULL ^ m);
+    for (size_t j = 0; j < n; ++j) {
+        double s = n > 1 ? pow(cond, -(double)j / (double)(n - 1)) : 1.0;
+        for (size_t i = 0; i < m; ++i) A[IDX(i,j,n)] *= s;
+    }
+    fill_random(n, xt, 0x2545F4914F6CDD1DULL ^ n);
+    gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, 1, n, 1.0, A, n, xt, 1, 0.0, b, 1, 1);
+
+    double t[3] = { INFINITY, INFINITY, INFINITY };
+    GAUSSIAN_Err e[3] = { GAUSSIAN_SUCCESS, GAUSSIAN_SUCCESS, GAUSSIAN_SUCCESS };
+    for (int rep = 0; rep < 3; ++rep) {
+        double t0 = now_sec();
+        e[0] = normal_equations(m, n, A, b, G, c, &x[0], nthreads);
+        double t1 = now_sec();
+        memcpy(W, A, m * n * sizeof(double));
+        memcpy(bw, b, m * sizeof(double));
+        double t2 = now_sec();
+        e[1] = qr_lstsq(m, n, W, n, 1, bw, 1, &x[n], 1, 1);
+        double t3 = now_sec();
+        memcpy(W, A, m * n * sizeof(double));
+        memcpy(bw, b, m * sizeof(double));
+        double t4 = now_sec();
+        e[2] = qr_lstsq(m, n, W, n, 1, bw, 1, &x[2 * n], 1, nthreads);
+        double t5 = now_sec();
+        if (t1 - t0 < t[0]) t[0] = t1 - t0;
+        if (t3 - t2 < t[1]) t[1] = t3 - t2;
+        if (t5 - t4 < t[2]) t[2] = t5 - t4;
+    }
+
+    static const char *names[3] = { "normal eq", "qr 1 thread", "qr/tsqr mt" };
+    double flops = 2.0 * (double)m * (double)n * (double)n;
+    printf("m=%zu n=%zu cond~%.1e\n", m, n, cond);
+    printf("%-14s %10s %10s %12s\n", "", "time(s)", "GFLOP/s", "|x-x_true|");
+    for (int k = 0; k < 3; ++k) {
+        if (e[k] != GAUSSIAN_SUCCESS)
+            printf("%-14s %10.4f %10s %12s (err %d)\n", names[k], t[k], "-", "failed", (int)e[k]);
+        else
+            printf("%-14s %10.4f %10.2f %12.2e\n", names[k], t[k],
+                   (k == 0 ? flops / 2.0 : flops) / t[k] * 1e-9, err_inf(n, &x[k * n], xt));
+    }
+    free(A); free(W); free(b); free(bw); free(G); free(c); free(xt); free(x);
+    return 0;
+}
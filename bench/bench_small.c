@@ -0,0 +1,63 @@
+/* 小规模特化基准：gauss_pp_solve_N vs 通用路径 gauss_pp_core
+ * 用法：bench_small [reps]，默认 reps = 2000000
+ * 输出 n = 2..8 每次求解的平均延迟（ns）。两条路径都先复制增广矩阵，
+ * 因为通用路径就地修改输入。 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+
+#define NSYS 64   /* 轮换使用的矩阵个数，避免分支预测记住单个输入 */
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+typedef GAUSSIAN_Err (*GaussSmallFn)(const double *A, size_t lda, double *x);
+
+int main(int argc, char *argv[]) {
+    static const GaussSmallFn solve_n[9] = {
+        NULL, NULL, gauss_pp_solve_2, gauss_pp_solve_3, gauss_pp_solve_4,
+        gauss_pp_solve_5, gauss_pp_solve_6, gauss_pp_solve_7, gauss_pp_solve_8
+    };
+    size_t reps = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 2000000;
+    static double A[NSYS][8 * 9];
+    double W[8 * 9], x[8];
+    volatile double sink = 0.0;
+
+    unsigned long long s = 0x9E3779B97F4A7C15ULL;
+    for (size_t k = 0; k < NSYS; ++k)
+        for (size_t i = 0; i < 8 * 9; ++i) {
+            s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+            A[k][i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+        }
+
+    printf("%4s %14s %14s %8s\n", "n", "generic(ns)", "special(ns)", "speedup");
+    for (size_t n = 2; n <= 8; ++n) {
+        const size_t lda = n + 1;
+        const size_t bytes = n * lda * sizeof(double);
+
+        double t0 = now_sec();
+        for (size_t r = 0; r < reps; ++r) {
+            memcpy(W, A[r % NSYS], bytes);
+            gauss_pp_core(n, W, lda, x);
+            sink += x[0];
+        }
+        double t_gen = (now_sec() - t0) / (double)reps * 1e9;
+
+        t0 = now_sec();
+        for (size_t r = 0; r < reps; ++r) {
+            memcpy(W, A[r % NSYS], bytes);
+            solve_n[n](W, lda, x);
+            sink += x[0];
+        }
+        double t_sp = (now_sec() - t0) / (double)reps * 1e9;
+
+        printf("%4zu %14.1f %14.1f %8.2f\n", n, t_gen, t_sp, t_gen / t_sp);
+    }
+    (void)sink;
+    return 0;
+}
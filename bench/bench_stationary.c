@@ -0,0 +1,60 @@
+/* 定常迭代基准：二维 Poisson（nx*nx 阶，CSR）与同一矩阵的稠密存储
+ * 用法：bench_stationary [nx] [nthreads]，默认 nx = 128，nthreads = 0
+ * 稠密版本仅在 nx <= 48（n <= 2304）时运行。 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "iterative.h"
+#include "sparse.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+    size_t nx = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 128;
+    size_t nthreads = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 0;
+    CsrMatrix A;
+    if (nx < 2 || csr_poisson2d(nx, nx, &A) != GAUSSIAN_SUCCESS) {
+        fprintf(stderr, "usage: %s [nx>=2] [nthreads]\n", argv[0]);
+        return 1;
+    }
+    const size_t n = A.nrows;
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    double *D = nx <= 48 ? (double*)malloc(n * n * sizeof(double)) : NULL;
+    if (!b || !x) { fprintf(stderr, "out of memory\n"); return 1; }
+    for (size_t i = 0; i < n; ++i) b[i] = 1.0;
+    if (D) csr_to_dense(&A, D, n);
+
+    const char *names[3] = { "jacobi", "gauss-seidel", "sor(auto)" };
+    printf("poisson2d %zux%zu: n=%zu\n", nx, nx, n);
+    printf("%-8s %-13s %8s %7s %8s %10s %12s\n", "layout", "method", "threads", "omega", "iters", "time(s)", "residual");
+    for (int layout = 0; layout < 2; ++layout) {
+        if (layout == 1 && !D) break;
+        for (int m = 0; m < 3; ++m) {
+            size_t threads[2] = { 1, nthreads };
+            for (int t = 0; t < 2; ++t) {
+                IterOptions opts;
+                iter_options_default(&opts);
+                opts.max_iter = 200000;
+                opts.nthreads = threads[t];
+                IterStatus st = { 0, 0.0, NULL, 0, 0, 0.0 };
+                for (size_t i = 0; i < n; ++i) x[i] = 0.0;
+                double t0 = now_sec();
+                GAUSSIAN_Err ret = layout == 0
+                    ? stationary_solve_csr(&A, b, x, (StationaryMethod)m, &opts, &st)
+                    : stationary_solve_dense(n, D, n, b, x, (StationaryMethod)m, &opts, &st);
+                double el = now_sec() - t0;
+                printf("%-8s %-13s %8zu %7.3f %8zu %10.3f %12.3e%s\n", layout ? "dense" : "csr", names[m],
+                       threads[t], st.omega, st.iterations, el, st.residual,
+                       ret == GAUSSIAN_SUCCESS ? "" : "  (not converged)");
+            }
+        }
+    }
+    free(b); free(x); free(D);
+    csr_free(&A);
+    return 0;
+}
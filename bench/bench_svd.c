@@ -0,0 +1,221 @@
+/* SVD / 伪逆基准
+ * 用法：bench_svd [n] [nthreads]，默认 n = 1000，nthreads = 0（全部 CPU）
+ * 1. 良态方阵 A x = b（n x n，对角占优）：lu_decompose_blocked + lu_solve vs qr_lstsq vs svd_pinv_solve
+ *    （良态时走 QR 快速路径），输出耗时与 ||x - x_true||_inf
+ * 2. 秩亏拟合矩阵（4n x n/5，多项式基 + 线性相关列，数值秩 < 列数）：法方程 + gauss_pp_core
+ *    vs svd_pinv_solve（Jacobi 路径），输出耗时、数值秩与残差 ||A^T (A x - b)||
+ * 3. svd_jacobi（2n/5 x n/5，秩 10 的信号 + 噪声）全部奇异值 vs 截断 k = 10（带 U、V）：单线程 vs nthreads，输出耗时与扫描遍数
+ * 第 1 项取 3 次中最快的一次。 */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Gaussian.h"
+#include "gaussian_gemm.h"
+#include "gaussian_qr.h"
+#include "gaussian_svd.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void fill_random(size_t len, double *A, unsigned long long s) {
+    for (size_t i = 0; i < len; ++i) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        A[i] = (double)(s >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+    }
+}
+
+static double err_inf(size_t n, const double *x, const double *y) {
+    double d = 0.0;
+    for (size_t i = 0; i < n; ++i)
+        if (fabs(x[i] - y[i]) > d) d = fabs(x[i] - y[i]);
+    return d;
+}
+
+/* ||A^T (A x - b)||_inf / (||A||_max^2 m)：最小二乘解的最优性 */
+static double normal_resid(size_t m, size_t n, const double *A, const double *b, const double *x) {
+    double *r = (double*)malloc(m * sizeof(double));
+    double *g = (double*)malloc(n * sizeof(double));
+    double amax = 0.0, res = INFINITY;
+    if (r && g) {
+        memcpy(r, b, m * sizeof(double));
+        gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, 1, n, 1.0, A, n, x, 1, -1.0, r, 1, 1);
+        gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, 1, m, 1.0, A, n, r, 1, 0.0, g, 1, 1);
+        for (size_t i = 0; i < m * n; ++i) if (fabs(A[i]) > amax) amax = fabs(A[i]);
+        res = 0.0;
+        for (size_t j = 0; j < n; ++j) if (fabs(g[j]) > res) res = fabs(g[j]);
+        res /= amax * amax * (double)m;
+    }
+    free(r); free(g);
+    return res;
+}
+
+static void bench_square(size_t n, size_t nthreads) {
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *W = (double*)malloc(n * n * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *bw = (double*)malloc(n * sizeof(double));
+    double *xt = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(3 * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    if (!A || !W || !b || !bw || !xt || !x || !piv) {
+        fprintf(stderr, "n=%zu: out of memory\n", n);
+        exit(1);
+    }
+    fill_random(n * n, A, 0x9E3779B97F4A7C15ULL ^ n);
+    for (size_t i = 0; i < n; ++i) A[IDX(i,i,n)] += 2.0 * sqrt((double)n);
+    fill_random(n, xt, 0x2545F4914F6CDD1DULL);
+    gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, n, 1, n, 1.0, A, n, xt, 1, 0.0, b, 1, 1);
+
+    double t[3] = { INFINITY, INFINITY, INFINITY };
+    GAUSSIAN_Err e[3] = { GAUSSIAN_SUCCESS, GAUSSIAN_SUCCESS, GAUSSIAN_SUCCESS };
+    size_t rank = 0;
+    for (int rep = 0; rep < 3; ++rep) {
+        for (int v = 0; v < 3; ++v) {
+            memcpy(W, A, n * n * sizeof(double));
+            memcpy(bw, b, n * sizeof(double));
+            double t0 = now_sec();
+            if (v == 0) {
+                e[0] = lu_decompose_blocked(n, W, n, piv);
+                if (e[0] == GAUSSIAN_SUCCESS) e[0] = lu_solve(n, W, n, piv, b, &x[0]);
+            } else if (v == 1) {
+                e[1] = qr_lstsq(n, n, W, n, 1, bw, 1, &x[n], 1, nthreads);
+            } else {
+                e[2] = svd_pinv_solve(n, n, W, n, 1, bw, 1, &x[2 * n], 1, 0.0, &rank, nthreads);
+            }
+            double t1 = now_sec();
+            if (t1 - t0 < t[v]) t[v] = t1 - t0;
+        }
+    }
+    static const char *names[3] = { "lu blocked", "qr_lstsq", "svd_pinv_solve" };
+    printf("well-conditioned n=%zu (pinv rank %zu)\n", n, rank);
+    printf("%-16s %10s %12s\n", "", "time(s)", "|x-x_true|");
+    for (int v = 0; v < 3; ++v) {
+        if (e[v] != GAUSSIAN_SUCCESS)
+            printf("%-16s %10.4f %12s (err %d)\n", names[v], t[v], "failed", (int)e[v]);
+        else
+            printf("%-16s %10.4f %12.2e\n", names[v], t[v], err_inf(n, &x[v * n], xt));
+    }
+    free(A); free(W); free(b); free(bw); free(xt); free(x); free(piv);
+}
+
+/* 拟合矩阵：前 n - n/4 列为 [0,1] 上的 Legendre 型多项式基（按行随机采样点），
+ * 后 n/4 列为前面若干列的线性组合，数值秩 n - n/4 */
+static void fitting_matrix(size_t m, size_t n, double *A) {
+    const size_t r = n - n / 4;
+    unsigned long long s = 0x853C49E6748FEA9BULL;
+    for (size_t i = 0; i < m; ++i) {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        double t = 2.0 * (double)(s >> 11) / 9007199254740992.0 - 1.0;
+        double p0 = 1.0, p1 = t;
+        for (size_t j = 0; j < r; ++j) {
+            A[IDX(i,j,n)] = p0;
+            double p2 = ((2.0 * (double)j + 3.0) * t * p1 - ((double)j + 1.0) * p0) / ((double)j + 2.0);
+            p0 = p1;
+            p1 = p2;
+        }
+        for (size_t j = r; j < n; ++j)
+            A[IDX(i,j,n)] = A[IDX(i,j - r,n)] - 0.5 * A[IDX(i,(j * 7) % r,n)];
+    }
+}
+
+static void bench_fitting(size_t m, size_t n, size_t nthreads) {
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double *W = (double*)malloc(m * n * sizeof(double));
+    double *b = (double*)malloc(m * sizeof(double));
+    double *bw = (double*)malloc(m * sizeof(double));
+    double *Aug = (double*)malloc(n * (n + 1) * sizeof(double));
+    double *x = (double*)malloc(2 * n * sizeof(double));
+    if (!A || !W || !b || !bw || !Aug || !x) {
+        fprintf(stderr, "m=%zu n=%zu: out of memory\n", m, n);
+        exit(1);
+    }
+    fitting_matrix(m, n, A);
+    fill_random(m, b, 0x2545F4914F6CDD1DULL ^ m);
+
+    /* 法方程 [A^T A | A^T b] + gauss_pp_core */
+    double t0 = now_sec();
+    gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, n, m, 1.0, A, n, A, n, 0.0, Aug, n + 1, nthreads);
+    gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, 1, m, 1.0, A, n, b, 1, 0.0, &Aug[n], n + 1, nthreads);
+    GAUSSIAN_Err e0 = gauss_pp_core(n, Aug, n + 1, &x[0]);
+    double t1 = now_sec();
+    memcpy(W, A, m * n * sizeof(double));
+    memcpy(bw, b, m * sizeof(double));
+    size_t rank = 0;
+    double t2 = now_sec();
+    GAUSSIAN_Err e1 = svd_pinv_solve(m, n, W, n, 1, bw, 1, &x[n], 1, 0.0, &rank, nthreads);
+    double t3 = now_sec();
+    printf("rank-deficient fitting m=%zu n=%zu (rank %zu)\n", m, n, n - n / 4);
+    printf("%-16s %10s %8s %14s\n", "", "time(s)", "rank", "|A^T r|");
+    if (e0 != GAUSSIAN_SUCCESS)
+        printf("%-16s %10.4f %8s %14s (err %d)\n", "normal eq + pp", t1 - t0, "-", "failed", (int)e0);
+    else
+        printf("%-16s %10.4f %8s %14.2e\n", "normal eq + pp", t1 - t0, "-",
+               normal_resid(m, n, A, b, &x[0]));
+    if (e1 != GAUSSIAN_SUCCESS)
+        printf("%-16s %10.4f %8s %14s (err %d)\n", "svd_pinv_solve", t3 - t2, "-", "failed", (int)e1);
+    else
+        printf("%-16s %10.4f %8zu %14.2e\n", "svd_pinv_solve", t3 - t2, rank,
+               normal_resid(m, n, A, b, &x[n]));
+    free(A); free(W); free(b); free(bw); free(Aug); free(x);
+}
+
+static void bench_jacobi(size_t m, size_t n, size_t nthreads) {
+    const size_t kt = n < 10 ? n : 10;
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double *U = (double*)malloc(n * m * sizeof(double));
+    double *V = (double*)malloc(n * n * sizeof(double));
+    double *s = (double*)malloc(n * sizeof(double));
+    if (!A || !U || !V || !s) {
+        fprintf(stderr, "m=%zu n=%zu: out of memory\n", m, n);
+        exit(1);
+    }
+    /* 秩 kt 的信号 B C 加 1e-3 的噪声：前 kt 个奇异值与其余之间有明显间隙 */
+    double *Bm = (double*)malloc(m * kt * sizeof(double));
+    double *Cm = (double*)malloc(kt * n * sizeof(double));
+    if (!Bm || !Cm) {
+        fprintf(stderr, "m=%zu n=%zu: out of memory\n", m, n);
+        exit(1);
+    }
+    fill_random(m * n, A, 0x9E3779B97F4A7C15ULL ^ (m + n));
+    fill_random(m * kt, Bm, 0x2545F4914F6CDD1DULL);
+    fill_random(kt * n, Cm, 0x853C49E6748FEA9BULL);
+    gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, n, kt, 1.0, Bm, kt, Cm, n, 1e-3, A, n, 1);
+    free(Bm); free(Cm);
+    printf("svd_jacobi m=%zu n=%zu (rank-%zu signal + 1e-3 noise)\n", m, n, kt);
+    printf("%-22s %10s %8s\n", "", "time(s)", "sweeps");
+    for (int v = 0; v < 4; ++v) {
+        SvdOptions o;
+        SvdStatus st = {0, 0};
+        svd_options_default(&o);
+        o.k = (v & 1) ? kt : 0;
+        o.nthreads = (v & 2) ? nthreads : 1;
+        double t0 = now_sec();
+        GAUSSIAN_Err e = svd_jacobi(m, n, A, n, s, U, m, V, n, &o, &st);
+        double t1 = now_sec();
+        char name[40];
+        snprintf(name, sizeof(name), "%s, %s", o.k ? "k=10" : "all", (v & 2) ? "mt" : "1 thread");
+        printf("%-22s %10.4f %8zu%s\n", name, t1 - t0, st.sweeps,
+               e == GAUSSIAN_SUCCESS ? "" : " (failed)");
+    }
+    free(A); free(U); free(V); free(s);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 1000;
+    size_t nthreads = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 0;
+    if (n < 20) {
+        fprintf(stderr, "usage: %s [n>=20] [nthreads]\n", argv[0]);
+        return 1;
+    }
+    bench_square(n, nthreads);
+    printf("\n");
+    bench_fitting(4 * n, n / 5, nthreads);
+    printf("\n");
+    bench_jacobi(2 * n / 5, n / 5, nthreads);
+    return 0;
+}
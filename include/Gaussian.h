@@ -10,14 +10,76 @@ extern "C" {
 typedef enum Gaussian{
     GAUSSIAN_SUCCESS = 0,
     GAUSSIAN_BAD_MATRIX = 1,
-    GAUSSIAN_INVALID_INPUT = 2
+    GAUSSIAN_INVALID_INPUT = 2,
+    GAUSSIAN_NO_MEMORY = 3,
+    GAUSSIAN_NOT_SPD = 4,
+    GAUSSIAN_NOT_CONVERGED = 5
 }GAUSSIAN_Err;
 
 
 // 非API设计
 GAUSSIAN_Err gauss_pp_core(size_t n, double *A, size_t lda, double *x);
+/* 固定规模特化（需显式调用，gauss_pp_core 不自动分派）：A 为 N x (N+1) 增广矩阵（不修改），
+ * 循环完全展开、无分支选主元。结果与 gauss_pp_core 相差舍入量级；
+ * 存在并列主元时可能选不同的行，且不跳过小乘子 */
+GAUSSIAN_Err gauss_pp_solve_2(const double *A, size_t lda, double *x);
+GAUSSIAN_Err gauss_pp_solve_3(const double *A, size_t lda, double *x);
+GAUSSIAN_Err gauss_pp_solve_4(const double *A, size_t lda, double *x);
+GAUSSIAN_Err gauss_pp_solve_5(const double *A, size_t lda, double *x);
+GAUSSIAN_Err gauss_pp_solve_6(const double *A, size_t lda, double *x);
+GAUSSIAN_Err gauss_pp_solve_7(const double *A, size_t lda, double *x);
+GAUSSIAN_Err gauss_pp_solve_8(const double *A, size_t lda, double *x);
 GAUSSIAN_Err gauss_jordan_solve(size_t n, double *A, size_t lda, double *x);
 GAUSSIAN_Err lu_decompose_pp(size_t n, double *A, size_t lda, size_t *piv);
+/* 以下三个版本与 lu_decompose_pp 同签名、同约定，可直接替换；Schur 更新走 GEMM，
+ * 累加次序不同，因子只在舍入误差内一致，近似平局的列上主元可能不同 */
+/* 分块版本 */
+GAUSSIAN_Err lu_decompose_blocked(size_t n, double *A, size_t lda, size_t *piv);
+/* 递归（cache-oblivious）版本：按列对半递归，无需调块参数 */
+GAUSSIAN_Err lu_decompose_recursive(size_t n, double *A, size_t lda, size_t *piv);
+/* 多线程分片版本：nb 为分片边长（0 取默认），nthreads = 0 取 CPU 数 */
+GAUSSIAN_Err lu_decompose_tiled(size_t n, double *A, size_t lda, size_t *piv,
+                                size_t nb, size_t nthreads);
+/* CALU：面板主元由行块间的锦标赛（并行归约树）选出，每面板 O(log) 次同步；
+ * 输出约定与 lu_decompose_pp 相同，主元序列一般不同。nb = 0 取默认，nthreads = 0 取 CPU 数 */
+GAUSSIAN_Err lu_decompose_calu(size_t n, double *A, size_t lda, size_t *piv,
+                               size_t nb, size_t nthreads);
+/* 复用 LU 分解求解：单右端 / 多右端（B、X 为 n x nrhs 行主序），O(n^2) 每个右端 */
+GAUSSIAN_Err lu_solve(size_t n, const double *LU, size_t lda, const size_t *piv,
+                      const double *b, double *x);
+GAUSSIAN_Err lu_solve_multi(size_t n, const double *LU, size_t lda, const size_t *piv,
+                            size_t nrhs, const double *B, size_t ldb,
+                            double *X, size_t ldx);
+/* 转置求解 A^T y = c，复用同一 LU 与 piv，O(n^2)，按行访问 LU */
+GAUSSIAN_Err lu_solve_transpose(size_t n, const double *LU, size_t lda, const size_t *piv,
+                                const double *c, double *y);
+/* 条件数估计：||A||_1（分解前求）；基于 LU 的 Hager/Higham 估计，O(n^2)，
+ * 给出倒数条件数 rcond = 1 / (||A||_1 ||A^{-1}||_1) 的估计（U 有零对角时为 0）。
+ * lu_decompose_pp_rcond：rcond 为可选输出，NULL 时与 lu_decompose_pp 完全相同；
+ * 分解失败时 *rcond = 0 */
+double mat_norm1(size_t n, const double *A, size_t lda);
+GAUSSIAN_Err lu_condest(size_t n, const double *LU, size_t lda, const size_t *piv,
+                        double anorm, double *rcond);
+GAUSSIAN_Err lu_decompose_pp_rcond(size_t n, double *A, size_t lda, size_t *piv, double *rcond);
+/* lu_condest 的核心，适用于任意可求解 A x = b 与 A^T x = b 的分解：
+ * solve(ctx, trans, b, x) 在 trans = 0 / 1 时求解 A x = b / A^T x = b（b 与 x 不重叠，b 只读），
+ * 非 GAUSSIAN_SUCCESS 时原样返回；*est 为 ||A^{-1}||_1 的下界估计，默认至多 13 次求解 */
+typedef GAUSSIAN_Err (*GaussInvSolveFn)(void *ctx, int trans, const double *b, double *x);
+GAUSSIAN_Err inv_norm1_est(size_t n, GaussInvSolveFn solve, void *ctx, double *est);
+/* 基于 LU 分解（lu_decompose_pp / blocked / tiled 的输出）：
+ * lu_det 直接连乘，|det| 超出 double 范围时为 inf / 0；
+ * lu_logdet 给出 log|det| 与符号（-1 / 0 / 1），不会溢出；piv 不是置换时返回 GAUSSIAN_INVALID_INPUT */
+GAUSSIAN_Err lu_det(size_t n, const double *LU, size_t lda, const size_t *piv, double *det);
+GAUSSIAN_Err lu_logdet(size_t n, const double *LU, size_t lda, const size_t *piv,
+                       double *logabsdet, int *sign);
+/* 就地求逆：LU 被 A^{-1} 覆盖；分块三角求逆，约 4/3 n^3 次运算（相当于两次分解），
+ * 额外内存 (GAUSSIAN_LU_NB + 1) * n 个 double；|u_ii| < EPS 返回 GAUSSIAN_BAD_MATRIX */
+GAUSSIAN_Err lu_inverse(size_t n, double *LU, size_t lda, const size_t *piv);
+/* 对称正定：只读下三角，L 写回下三角；nthreads = 0 取 CPU 数 */
+GAUSSIAN_Err cholesky_decompose(size_t n, double *A, size_t lda, size_t nthreads);
+GAUSSIAN_Err cholesky_solve(size_t n, const double *L, size_t lda, const double *b, double *x);
+/* 显式拷贝出 L 与 U（两个 n x n 稠密矩阵）；只需三角求解/乘法时
+ * 改用 gaussian_tri.h 的零拷贝视图 lu_view_L / lu_view_U 或压缩存储 tri_pack */
 void lu_extract(size_t n, const double *LU, size_t lda,
                 double *L, size_t ldl,
                 double *U, size_t ldu);
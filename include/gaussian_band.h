@@ -0,0 +1,53 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_BAND_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_BAND_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 带状矩阵（kl 条下对角线、ku 条上对角线）紧凑存储，行主序：
+ *   元素 (i,j)（i-kl <= j <= i+ku）位于 AB[BAND_IDX(i, j, ldab, kl)]，
+ *   即第 i 行的带内元素从 AB + i*ldab 起连续存放，主对角位于偏移 kl。
+ * - 只求解（不分解）时 ldab >= kl + ku + 1
+ * - 带选主元的 LU 会在 U 中产生至多 kl 条额外上对角线，
+ *   需 ldab >= BAND_LDAB_LU(kl, ku)，偏移 kl+ku+1 .. 2kl+ku 为填充区（由分解清零）
+ * 时间 O(n*kl*(kl+ku))，内存 O(n*(2kl+ku+1))。
+ * ============================================================ */
+#define BAND_IDX(i,j,ldab,kl) ((i)*(ldab) + (j) - (i) + (kl))
+#define BAND_LDAB_LU(kl,ku) (2*(kl) + (ku) + 1)
+
+/* 从稠密矩阵（行跨度 lda）抽取带内元素；填充区清零 */
+GAUSSIAN_Err band_pack(size_t n, size_t kl, size_t ku, const double *A, size_t lda,
+                       double *AB, size_t ldab);
+
+/* 带状 LU（部分选主元）：L 的乘子留在下带，U 写回主对角及上带（含填充区）。
+ * ipiv 为逐步行交换序列（第 k 步与第 ipiv[k] 行交换，ipiv[k] <= k+kl），
+ * 与 lu_decompose_pp 的置换向量语义不同，只供 band_lu_solve 使用。 */
+GAUSSIAN_Err band_lu_decompose(size_t n, size_t kl, size_t ku, double *AB, size_t ldab,
+                               size_t *ipiv);
+/* 复用带状 LU 求解，x 可与 b 相同 */
+GAUSSIAN_Err band_lu_solve(size_t n, size_t kl, size_t ku, const double *AB, size_t ldab,
+                           const size_t *ipiv, const double *b, double *x);
+
+/* 三对角 Thomas 算法（不选主元，适用于对角占优/对称正定）：
+ * dl[1..n) 为下对角（dl[0] 不用），d[0..n) 主对角，du[0..n-1) 上对角（du[n-1] 不用）。
+ * 输入不被修改；x 可与 b 相同。消元中出现 |主元| < EPS 时返回 GAUSSIAN_BAD_MATRIX，
+ * 此时应改用 band_lu_decompose(kl = ku = 1)。 */
+GAUSSIAN_Err tridiag_solve(size_t n, const double *dl, const double *d, const double *du,
+                           const double *b, double *x);
+
+/* 批量三对角：count 个独立的 n 阶系统，采用 gaussian_batch.h 的交错布局，
+ * 第 s 个系统的第 i 个元素（dl/d/du/b/x 均同）位于 GAUSS_BATCH_XIDX(n, s, i)，
+ * 缓冲区按 gauss_batch_size_x(n, count) 分配；末组的空 lane 不读不写（按单位系统计算）。
+ * info（可为 NULL）逐系统返回 GAUSSIAN_SUCCESS / GAUSSIAN_BAD_MATRIX；
+ * nthreads = 0 使用全部 CPU，1 为单线程。 */
+GAUSSIAN_Err tridiag_batch_solve(size_t n, size_t count, const double *dl, const double *d,
+                                 const double *du, const double *b, double *x,
+                                 GAUSSIAN_Err *info, size_t nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_BAND_H
@@ -0,0 +1,48 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_BATCH_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_BATCH_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 批量小规模方程组（n = 1..GAUSSIAN_BATCH_MAX_N）高斯消元
+ * 交错（SIMD-across-systems）布局：
+ *   每 GAUSSIAN_BATCH_LANES 个方程组为一组，组内同一位置 (i,j) 的元素连续存放，
+ *   第 s 个增广矩阵 n x (n+1) 的元素 (i,j) 位于 GAUSS_BATCH_AIDX(n, s, i, j)，
+ *   解向量第 i 个分量位于 GAUSS_BATCH_XIDX(n, s, i)。
+ * - 缓冲区按整组分配：gauss_batch_size_A / gauss_batch_size_x 给出元素个数
+ * - 消元在各 lane 上同时进行，选主元以逐 lane 比较/选择完成（无分支）
+ * ============================================================ */
+#define GAUSSIAN_BATCH_LANES 8
+#define GAUSSIAN_BATCH_MAX_N 16
+
+#define GAUSS_BATCH_AIDX(n, s, i, j) \
+    ((((s) / GAUSSIAN_BATCH_LANES) * (n) * ((n) + 1) + (i) * ((n) + 1) + (j)) \
+     * GAUSSIAN_BATCH_LANES + (s) % GAUSSIAN_BATCH_LANES)
+#define GAUSS_BATCH_XIDX(n, s, i) \
+    ((((s) / GAUSSIAN_BATCH_LANES) * (n) + (i)) * GAUSSIAN_BATCH_LANES \
+     + (s) % GAUSSIAN_BATCH_LANES)
+
+size_t gauss_batch_size_A(size_t n, size_t count);
+size_t gauss_batch_size_x(size_t n, size_t count);
+
+/* 从逐个存放的增广矩阵（第 s 个位于 A + s*n*lda，行跨度 lda >= n+1）打包成交错布局；
+ * 末组的空 lane 填为单位阵、右端为 0 */
+GAUSSIAN_Err gauss_batch_pack(size_t n, size_t count, const double *A, size_t lda,
+                              double *A_batch);
+/* 把交错布局的解展开为 x[s*n + i] */
+GAUSSIAN_Err gauss_batch_unpack_x(size_t n, size_t count, const double *x_batch, double *x);
+
+/* 求解 count 个 n x n 方程组；A_batch 不被修改。
+ * info（可为 NULL）逐系统返回 GAUSSIAN_SUCCESS / GAUSSIAN_BAD_MATRIX；
+ * 任一系统奇异时整体返回 GAUSSIAN_BAD_MATRIX，其余系统的解仍有效。
+ * nthreads = 0 使用全部 CPU，1 为单线程。 */
+GAUSSIAN_Err gauss_batch_solve(size_t n, size_t count, const double *A_batch,
+                               double *x_batch, GAUSSIAN_Err *info, size_t nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_BATCH_H
@@ -0,0 +1,69 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_EIG_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_EIG_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 对称特征值问题（行主序，行跨度 lda；只读上三角含对角）
+ * 特征向量按行给出：Z 的第 i 行是特征值 w[i] 的单位特征向量（行跨度 ldz >= n），
+ * 即 A = Z^T diag(w) Z
+ *
+ * 稠密全谱 / 按序号选取：sym_eig
+ * 1. 三对角化 Q^T A Q = T：Householder 反射消去第 k 行对角线右侧第二个起的元素，
+ *    每 GAUSSIAN_EIG_NB 行一个面板（dlatrd 式）：面板内只做对称矩阵-向量乘，
+ *    面板的秩 2nb 更新按行块落在上三角上，走 gaussian_gemm
+ * 2. 特征值：隐式位移 QL（Wilkinson 位移），O(n^2)，升序
+ * 3. 特征向量（只算选中的 il..iu）：对 T 做反迭代（带部分选主元的三对角 LU），
+ *    特征值相距 < 1e-3 ||T|| 的成簇向量相互重正交化；再以 WY 块形式回代 z <- z Q^T（GEMM）
+ *
+ * 移位求逆：eig_shift_invert，求最接近 sigma 的 k 个特征对
+ * - (A - sigma I) 只用 lu_decompose_blocked（部分选主元）分解一次，之后每步都是 lu_solve_multi；
+ * - 每次调用只建一个线程池，各步的 QR 与 GEMM 共用
+ * - 块反迭代（子空间维数 p = min(n, max(2k, k + 2))）：Y = (A - sigma I)^{-1} X，
+ *   用 QR（gaussian_qr.h）正交化，Rayleigh-Ritz：H = Q^T A Q 的 sym_eig，X = Q S
+ * - 按 |theta - sigma| 排序的前 k 个 Ritz 对的残差 ||A x - theta x||_2 <= tol ||A||_1 时收敛
+ * - sigma 恰为特征值（A - sigma I 奇异，主元 < EPS）返回 GAUSSIAN_BAD_MATRIX
+ * ============================================================ */
+
+/* 三对角化：d（n）为对角，e（n-1）为次对角，tau（n-1）与 A 的上三角中第 k 行 k+2 列起存放反射；
+ * A 的下三角被用作工作区 */
+GAUSSIAN_Err sym_tridiagonalize(size_t n, double *A, size_t lda, double *d, double *e,
+                                double *tau, size_t nthreads);
+/* 三对角全部特征值（升序写回 d），e 被破坏；不收敛返回 GAUSSIAN_NOT_CONVERGED */
+GAUSSIAN_Err sym_tridiag_eigvals(size_t n, double *d, double *e);
+/* 三对角 T 对应升序特征值 w[0..k) 的特征向量（反迭代），按行写入 Z（k x n） */
+GAUSSIAN_Err sym_tridiag_eigvecs(size_t n, const double *d, const double *e,
+                                 size_t k, const double *w, double *Z, size_t ldz);
+
+/* 全部特征值升序写入 w（n 个）；Z 非 NULL 时再给出序号 il..iu（含）的特征向量，
+ * 写入 Z 的前 iu - il + 1 行。A 被三对角化结果覆盖 */
+GAUSSIAN_Err sym_eig(size_t n, double *A, size_t lda, double *w,
+                     size_t il, size_t iu, double *Z, size_t ldz, size_t nthreads);
+
+typedef struct EigShiftOptions {
+    size_t max_iter;        /* 块反迭代步数上限 */
+    double tol;             /* 相对残差目标，0 = 16 sqrt(n) DBL_EPSILON */
+    size_t nthreads;        /* GEMM / QR 线程数，0 = 全部 CPU */
+} EigShiftOptions;
+
+typedef struct EigShiftStatus {
+    size_t iterations;
+    double residual;        /* 前 k 个 Ritz 对的最大 ||A x - theta x||_2 / ||A||_1 */
+} EigShiftStatus;
+
+/* max_iter = 200，tol = 0（自动），nthreads = 0 */
+void eig_shift_options_default(EigShiftOptions *opts);
+
+/* 最接近 sigma 的 k 个特征对：lambda 按 |lambda - sigma| 升序，X 的第 i 行为对应特征向量；
+ * A 不被修改。未在 max_iter 内收敛返回 GAUSSIAN_NOT_CONVERGED（结果为最后一步的 Ritz 对） */
+GAUSSIAN_Err eig_shift_invert(size_t n, const double *A, size_t lda, double sigma, size_t k,
+                              double *lambda, double *X, size_t ldx,
+                              const EigShiftOptions *opts, EigShiftStatus *status);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_EIG_H
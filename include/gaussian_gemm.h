@@ -0,0 +1,46 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_GEMM_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_GEMM_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+#include "thread_pool.h"
+
+/* ============================================================
+ * 稠密矩阵乘：C = alpha * op(A) * op(B) + beta * C
+ * - op(A) 为 m x k，op(B) 为 k x n，C 为 m x n；行主序，行跨度 lda / ldb / ldc
+ *   op(X) = X（GEMM_NO_TRANS）或 X^T（GEMM_TRANS）。转置时 A 按 k x m 存储，lda >= m
+ * - 分块（BLIS 式三层循环 NC / KC / MC）：
+ *     B 的 KC x NC 块打包为 NR 列一条的连续面板，所有线程共享；
+ *     A 的 MC x KC 块打包为 MR 行一条的连续面板（乘以 alpha），每个线程各一份；
+ *     MR x NR 寄存器分块微核在打包面板上做秩 KC 更新
+ * - 微核随 gaussian_kernels()->level 选择：AVX-512 8x16 / AVX2 6x8 / 标量 4x4；
+ *   边界块在局部缓冲区中计算后加回 C
+ * - 多线程按 C 的 MC 行块（行块不足时再按 NR 对齐的列段）划分，各元素只由一个线程累加，
+ *   结果与线程数无关
+ * - beta = 0 时 C 的原值不参与计算（可含 NaN）；alpha = 0 或 k = 0 时只做 C *= beta
+ * - C 不可与 A / B 重叠；打包缓冲区申请失败返回 GAUSSIAN_NO_MEMORY
+ * ============================================================ */
+typedef enum GemmTrans {
+    GEMM_NO_TRANS = 0,
+    GEMM_TRANS = 1
+} GemmTrans;
+
+/* nthreads = 0 表示全部 CPU，1 为单线程；问题规模较小时自动退回单线程 */
+GAUSSIAN_Err gaussian_gemm(GemmTrans ta, GemmTrans tb, size_t m, size_t n, size_t k,
+                           double alpha, const double *A, size_t lda,
+                           const double *B, size_t ldb,
+                           double beta, double *C, size_t ldc, size_t nthreads);
+
+/* 在调用者的线程池上执行；pool = NULL 为单线程（可在线程池任务内部调用）。
+ * m*n*k 低于 GAUSSIAN_GEMM_MT_FLOPS 时不进线程池，调用者无需自行判断 */
+GAUSSIAN_Err gaussian_gemm_pool(GemmTrans ta, GemmTrans tb, size_t m, size_t n, size_t k,
+                                double alpha, const double *A, size_t lda,
+                                const double *B, size_t ldb,
+                                double beta, double *C, size_t ldc, ThreadPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_GEMM_H
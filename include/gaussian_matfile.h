@@ -0,0 +1,61 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_MATFILE_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_MATFILE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 二进制矩阵文件 + 内存映射加载：求解器直接在映射上运算，无解析、无拷贝
+ *
+ * 文件布局（本机字节序）：64 字节文件头
+ *   magic "GAUSMAT1" | uint32 字节序标记 0x01020304 | uint32 dtype | uint64 rows, cols, lda
+ *   | uint64 align | uint64 data_offset | 保留（填零）
+ * 其后在 data_offset 处为 rows x lda 个元素（行主序，行跨度 lda，每行 cols 之后为填充）
+ * - align 为 2 的幂，介于元素大小与 4096 之间；data_offset 与 lda * 元素大小 均是 align 的倍数，
+ *   映射起点按页对齐，因此每行行首都按 align 对齐（align = 64 即缓存行 / AVX-512 对齐）
+ * - 字节序标记不符、文件截断、参数不一致均返回 GAUSSIAN_INVALID_INPUT
+ *
+ * 映射模式：
+ * - GMAT_MAP_READONLY：只读共享映射，只给出 cdata；适合 lu_solve 等不修改 A 的例程
+ * - GMAT_MAP_COPY_ON_WRITE：私有映射，data 可写；就地例程（gauss_pp_core、lu_decompose_pp、
+ *   lu_decompose_pp_f32 ……）只修改被写到的页的私有副本，文件内容永不改变
+ * ============================================================ */
+typedef enum GMatDtype {
+    GMAT_F64 = 1,
+    GMAT_F32 = 2
+} GMatDtype;
+
+typedef enum GMatMode {
+    GMAT_MAP_READONLY = 0,
+    GMAT_MAP_COPY_ON_WRITE = 1
+} GMatMode;
+
+typedef struct GMatMap {
+    size_t rows, cols, lda;
+    GMatDtype dtype;
+    size_t align;
+    const void *cdata;      /* 首元素，dtype 为 GMAT_F64 时即 const double * */
+    void *data;             /* 可写视图：仅 GMAT_MAP_COPY_ON_WRITE 时非 NULL */
+    void *base;             /* 以下为内部使用：映射起点、长度与平台句柄 */
+    size_t len;
+    void *handle;
+} GMatMap;
+
+/* align 对齐下的最小行跨度（元素个数，>= cols）；align 非法时返回 0 */
+size_t gmat_aligned_lda(size_t cols, GMatDtype dtype, size_t align);
+
+/* 写文件：A 为 rows x cols 双精度（行跨度 lda），按 dtype 存储（GMAT_F32 时逐元素转换），
+ * 行跨度取 gmat_aligned_lda(cols, dtype, align)；align = 0 取 64 */
+GAUSSIAN_Err gmat_write(const char *path, size_t rows, size_t cols, const double *A, size_t lda,
+                        GMatDtype dtype, size_t align);
+
+/* 映射文件；映射失败返回 GAUSSIAN_NO_MEMORY。m 在 gmat_unmap 之前保持有效 */
+GAUSSIAN_Err gmat_map(const char *path, GMatMode mode, GMatMap *m);
+void gmat_unmap(GMatMap *m);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_MATFILE_H
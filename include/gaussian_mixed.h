@@ -0,0 +1,52 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_MIXED_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_MIXED_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 混合精度 LU：单精度分解 + 双精度迭代细化
+ * - A 转为 float 后做与 lu_decompose_pp 相同的部分选主元 LU（分块，单精度 SIMD 核），
+ *   O(n^3) 部分的访存量减半、向量宽度加倍
+ * - 残差 r = b - A x 用原始双精度 A 计算，修正量 A d = r 用单精度因子求解
+ *   （r 先按 ||r||_inf 缩放，避免单精度上/下溢）
+ * - 后向误差 berr = ||b - A x||_inf / (||A||_inf ||x||_inf + ||b||_inf)，
+ *   berr <= tol 即收敛；cond(A) * FLT_EPSILON 接近 1 时细化不收敛，
+ *   此时（berr 未减半、超出 max_iter、A 超出 float 范围或单精度主元过小）
+ *   回退为双精度 lu_decompose_blocked + lu_solve
+ * ============================================================ */
+typedef struct MixedOptions {
+    size_t max_iter;        /* 细化步数上限 */
+    double tol;             /* 后向误差目标，0 = sqrt(n) * DBL_EPSILON */
+    int allow_fallback;     /* 0 = 停滞时不回退，返回 GAUSSIAN_NOT_CONVERGED */
+} MixedOptions;
+
+typedef struct MixedStatus {
+    size_t iterations;      /* 实际完成的细化步数（不含首次求解） */
+    double backward_error;  /* 返回解的 berr */
+    int fallback;           /* 1 = 结果来自双精度 LU */
+} MixedStatus;
+
+/* max_iter = 30，tol = 0（自动），允许回退 */
+void mixed_options_default(MixedOptions *opts);
+
+/* 单精度部分选主元 LU，约定与 lu_decompose_pp 相同（主元 < 1e-12 返回 GAUSSIAN_BAD_MATRIX） */
+GAUSSIAN_Err lu_decompose_pp_f32(size_t n, float *A, size_t lda, size_t *piv);
+/* 基于单精度因子求解，b 与 x 不可重叠 */
+GAUSSIAN_Err lu_solve_f32(size_t n, const float *LU, size_t lda, const size_t *piv,
+                          const float *b, float *x);
+
+/* A x = b，A（行跨度 lda）与 b 不被修改；opts 为 NULL 时取默认值，status 可为 NULL。
+ * 不允许回退时：细化停滞返回 GAUSSIAN_NOT_CONVERGED（x 为 berr 最小的迭代），
+ * 单精度主元过小返回 GAUSSIAN_BAD_MATRIX，A 超出 float 范围返回 GAUSSIAN_NOT_CONVERGED（x 未定义）。
+ * 额外内存：n*n 个 float，回退时另需 n*n 个 double */
+GAUSSIAN_Err mixed_lu_solve(size_t n, const double *A, size_t lda,
+                            const double *b, double *x,
+                            const MixedOptions *opts, MixedStatus *status);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_MIXED_H
@@ -0,0 +1,72 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_OOC_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_OOC_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stdio.h>
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 外存（out-of-core）LU：矩阵大于内存时，P A = L U 在磁盘文件上原地完成
+ *
+ * 列面板文件：64 字节文件头 {magic "GAUSOOC1", n, w, state}（uint64，本机字节序），
+ *   其后依次为各列面板：面板 k 覆盖列 [k w, k w + wb)，n x wb 行主序（行跨度 wb，
+ *   末面板 wb = n - k w），文件偏移 64 + 8 n k w；分解完成后面板之后追加 n 个 uint64 的 piv
+ *
+ * 分解（左视 slab 算法）：面板 j 读入内存后依次流入已分解的面板 k < j：
+ *     U_kj = L_kk^{-1} A_kj；A_(k+1..),j -= L_(k+1..),k U_kj（gaussian_gemm）
+ *   然后在内存中对面板 j 的 n - j w 行做部分选主元分解并写回。
+ * - 内存：3 个面板缓冲区（当前面板 + 两个交替的流入面板），即 3 n w 个 double，
+ *   须不超过 mem_budget（否则返回 GAUSSIAN_NO_MEMORY）；ooc_panel_width 给出预算允许的最大 w
+ * - I/O 重叠：独立的 I/O 线程按提交顺序读写，计算面板 k 时预取面板 k+1，
+ *   分解面板 j 时预取面板 j+1，写回与下一轮的读取排队执行
+ * - 后续面板的行交换对已写回的 L 惰性施加（流入时在内存中补做），
+ *   最后一遍顺序扫描统一补做并写回，文件中即为与 lu_decompose_pp 相同约定的因子
+ * - 主元在整列上选取，规则同 lu_decompose_pp；更新走 GEMM，累加次序不同，因子在舍入误差内一致，
+ *   近似平局的列上主元可能不同；|u_kk| < EPS 返回 GAUSSIAN_BAD_MATRIX
+ * - 文件读写失败或格式不符返回 GAUSSIAN_INVALID_INPUT
+ * ============================================================ */
+typedef struct OocOptions {
+    size_t mem_budget;      /* 面板缓冲区上限（字节），0 = 256 MB */
+    size_t nthreads;        /* 计算线程数，0 = 全部 CPU */
+} OocOptions;
+
+typedef struct OocStats {
+    unsigned long long bytes_read, bytes_written;
+    double io_wait;         /* 计算线程等待 I/O 的秒数（未被计算掩盖的部分） */
+} OocStats;
+
+typedef struct OocMatrix {
+    FILE *fp;
+    size_t n, w;
+    int factored;
+    size_t *piv;            /* 分解后有效 */
+} OocMatrix;
+
+/* 预算允许的面板宽度（<= n，至少为 1）；预算连一列都容不下时返回 0 */
+size_t ooc_panel_width(size_t n, size_t mem_budget);
+
+/* 新建面板文件（内容为零矩阵），w = 0 时取 ooc_panel_width(n, 0) */
+GAUSSIAN_Err ooc_create(const char *path, size_t n, size_t w, OocMatrix *M);
+/* 打开已有面板文件（读写），分解过的文件同时读入 piv */
+GAUSSIAN_Err ooc_open(const char *path, OocMatrix *M);
+void ooc_close(OocMatrix *M);
+
+/* 面板 k 与内存缓冲区之间的读写：buf 为 n x wb 行主序（行跨度 wb） */
+GAUSSIAN_Err ooc_write_panel(OocMatrix *M, size_t k, const double *buf);
+GAUSSIAN_Err ooc_read_panel(const OocMatrix *M, size_t k, double *buf);
+/* 按行块写入：A 为 m 行 x n 列（行跨度 lda），写到第 i0 行起；面板缓冲区由调用者限制 m */
+GAUSSIAN_Err ooc_write_rows(OocMatrix *M, size_t i0, size_t m, const double *A, size_t lda);
+
+/* 原地分解；opts / stats 可为 NULL */
+GAUSSIAN_Err ooc_lu_factor(OocMatrix *M, const OocOptions *opts, OocStats *stats);
+/* 用磁盘上的因子求解 A X = B（B、X 为 n x nrhs 行主序，可相同）：顺序扫描两遍文件，
+ * 内存为 2 个面板缓冲区 + O(n nrhs) */
+GAUSSIAN_Err ooc_lu_solve(const OocMatrix *M, size_t nrhs, const double *B, size_t ldb,
+                          double *X, size_t ldx, const OocOptions *opts);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_OOC_H
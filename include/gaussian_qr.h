@@ -0,0 +1,48 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_QR_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_QR_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+#include "thread_pool.h"
+
+/* ============================================================
+ * Householder QR 与最小二乘（m >= n，行主序，行跨度 lda，约定同 src/Gaussian.c）
+ * - 就地结果：R 在上三角（含对角），第 j 个 Householder 向量 v_j 存在第 j 列对角线以下
+ *   （v_j(j) = 1 不存储），H_j = I - tau_j v_j v_j^T，Q = H_0 H_1 ... H_{n-1}
+ * - 分块：每 GAUSSIAN_QR_NB 列一个面板，面板内按列对半递归（左半的反射以 WY 形式更新右半）；
+ *   面板的 nb 个反射合成紧凑 WY 形式 I - V T V^T（T 为 nb x nb 上三角），尾部更新为三次 gaussian_gemm：
+ *     W = V^T C；W = T^T W；C -= V W
+ * - 最小二乘 min ||A X - B||_2 经 R X = (Q^T B)(0:n) 求解，条件数不平方（法方程为 cond(A)^2）
+ * - 多线程：GEMM 在线程池上执行
+ * - 瘦高矩阵的 qr_lstsq 走 TSQR：行块数取 max(线程数, A 的字节数 / GAUSSIAN_QR_TSQR_LEAF)
+ *   （每块至少 GAUSSIAN_QR_TSQR_RATIO * n 行），各块独立 QR 并变换其右端（多线程时并行，
+ *   单线程时块在缓存内完成），再把各块的 R 与变换后右端的前 n 行叠起来递归求解
+ * - nthreads = 0 取 CPU 数；|r_jj| < EPS（秩亏）时求解返回 GAUSSIAN_BAD_MATRIX
+ * ============================================================ */
+
+/* A（m x n）被 R 与 Householder 向量覆盖，tau 为 n 个标量 */
+GAUSSIAN_Err qr_decompose(size_t m, size_t n, double *A, size_t lda, double *tau,
+                          size_t nthreads);
+/* B（m x nrhs，行跨度 ldb）<- Q^T B */
+GAUSSIAN_Err qr_apply_qt(size_t m, size_t n, const double *QR, size_t lda, const double *tau,
+                         size_t nrhs, double *B, size_t ldb, size_t nthreads);
+/* 显式生成瘦 Q（m x n 列正交，行跨度 ldq） */
+GAUSSIAN_Err qr_form_q(size_t m, size_t n, const double *QR, size_t lda, const double *tau,
+                       double *Q, size_t ldq, size_t nthreads);
+/* qr_decompose / qr_form_q 在调用者的线程池上执行；pool = NULL 为单线程。
+ * 供反复分解的迭代算法共用一个线程池 */
+GAUSSIAN_Err qr_decompose_pool(size_t m, size_t n, double *A, size_t lda, double *tau,
+                               ThreadPool *pool);
+GAUSSIAN_Err qr_form_q_pool(size_t m, size_t n, const double *QR, size_t lda, const double *tau,
+                            double *Q, size_t ldq, ThreadPool *pool);
+/* 最小二乘：X（n x nrhs）为 min ||A X - B||_2 的解；A、B 作为工作区被覆盖 */
+GAUSSIAN_Err qr_lstsq(size_t m, size_t n, double *A, size_t lda,
+                      size_t nrhs, double *B, size_t ldb,
+                      double *X, size_t ldx, size_t nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_QR_H
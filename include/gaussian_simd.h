@@ -0,0 +1,68 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_SIMD_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_SIMD_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+
+/* ============================================================
+ * 消元行更新核：y -= a * x
+ * - 标量 / AVX2+FMA / AVX-512 三种实现，首次使用时按 CPUID 选定
+ * - 构建机无需 -march=native：向量核以函数级 target 属性单独编译
+ *
+ * 误差约定（ULP bound，逐次操作）：
+ *   向量核使用 FMA，y - a*x 只舍入一次；标量核先舍入乘积再舍入差。
+ *   单次 axpy / axpy4 调用中，对每个元素两条路径结果之差满足
+ *       |y_simd - y_scalar| <= GAUSSIAN_SIMD_ULP_BOUND * ulp(max(|y|, |a*x|))
+ *   其中 y 为更新前的值。该界只对一次操作成立，不在整个分解中累积保持：
+ *   端到端两条路径都只满足随 n 增长的后向误差界 berr <= c n DBL_EPSILON * 增长因子，
+ *   解向量之差的量级为 n * cond(A) * DBL_EPSILON。
+ * ============================================================ */
+#define GAUSSIAN_SIMD_ULP_BOUND 3
+
+/* 函数级指令集属性：用于按 ISA 多次编译同一段内核后运行时分派 */
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GAUSSIAN_SIMD_X86 1
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#define GAUSSIAN_TARGET_AVX2
+#define GAUSSIAN_TARGET_AVX512
+#define GAUSSIAN_ALWAYS_INLINE __forceinline
+#else
+#define GAUSSIAN_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define GAUSSIAN_TARGET_AVX512 __attribute__((target("avx512f,fma")))
+#define GAUSSIAN_ALWAYS_INLINE inline __attribute__((always_inline))
+#endif
+
+typedef enum GaussianSimdLevel {
+    GAUSSIAN_SIMD_SCALAR = 0,
+    GAUSSIAN_SIMD_AVX2 = 1,
+    GAUSSIAN_SIMD_AVX512 = 2
+} GaussianSimdLevel;
+
+typedef struct GaussianKernels {
+    GaussianSimdLevel level;
+    const char *name;
+    /* y[0..len) -= a * x[0..len) */
+    void (*axpy)(size_t len, double a, const double *x, double *y);
+    /* 4 行同时更新：yr[0..len) -= a[r] * x[0..len)，x 只读一遍 */
+    void (*axpy4)(size_t len, const double a[4], const double *x,
+                  double *y0, double *y1, double *y2, double *y3);
+    /* 单精度版本（混合精度 LU 用），向量宽度为双精度的两倍 */
+    void (*saxpy)(size_t len, float a, const float *x, float *y);
+    void (*saxpy4)(size_t len, const float a[4], const float *x,
+                   float *y0, float *y1, float *y2, float *y3);
+} GaussianKernels;
+
+/* 本机 CPU（及操作系统）支持的最高级别 */
+GaussianSimdLevel gaussian_simd_detect(void);
+/* 当前生效的核；首次调用时按 gaussian_simd_detect() 选定 */
+const GaussianKernels *gaussian_kernels(void);
+/* 强制切换（测试/基准用），超过 CPU 能力时降级；返回实际生效级别。
+ * 非线程安全：应在没有求解在进行时调用 */
+GaussianSimdLevel gaussian_simd_set_level(GaussianSimdLevel level);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_SIMD_H
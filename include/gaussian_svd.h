@@ -0,0 +1,61 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_SVD_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_SVD_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 单边 Jacobi SVD（m >= n，行主序，行跨度 lda；m < n 时对 A^T 调用）
+ * A = U^T diag(s) V：s 降序，U 的第 i 行为左奇异向量（长 m），V 的第 i 行为右奇异向量（长 n），
+ * 与 gaussian_eig.h 一样按行给出
+ * - 预处理：A = Q R（gaussian_qr.h），对 R^T 的列（即 R 的行，行主序下连续）做单边 Jacobi：
+ *   行对 (i, j) 的余弦 |g_i . g_j| / (|g_i| |g_j|) > tol 时旋转使其正交；收敛后
+ *   s_i = |g_i|，V 的行为 g_i / s_i，U 的行为累积的旋转矩阵乘以 Q^T
+ * - 并行：每遍扫描按循环赛（round-robin）排成 n - 1 轮，每轮 n/2 个互不相交的行对
+ *   经 thread_pool_parallel_for 并行旋转
+ * - 截断（opts->k = k < n）：仍旋转所有行对，但只要求范数最大的 k 行（top）收敛：
+ *   top 行与其余行按旋转角 |g_i . g_j| / max(|g_i|^2, |g_j|^2) <= tol 判断，其余行之间放宽到 sqrt(tol)；
+ *   一遍扫描中 top 行不再旋转、排名不变，且其余行的 Gershgorin 估计不超过第 k 大的范数时停止
+ * - 超过 max_sweeps 返回 GAUSSIAN_NOT_CONVERGED（结果为最后一遍的近似）
+ *
+ * 伪逆求解 svd_pinv_solve：X = A^+ B，奇异值 < rcond * s_max 视为 0（秩亏时给出最小范数解）
+ * - 先 QR；min|r_ii| / max|r_ii| 已不超过 10 n rcond 时直接判为病态，否则用 inv_norm1_est
+ *   （Gaussian.h，与 lu_condest 相同的 Hager/xLACN2 估计）估计 R 的 1-范数条件数；
+ *   良态（rcond_est > 10 n rcond）时直接 R X = (Q^T B)(0:n)，与 qr_lstsq 同价；否则对 R 做上述 Jacobi SVD
+ * ============================================================ */
+
+typedef struct SvdOptions {
+    size_t k;               /* 所需的最大奇异三元组个数，0 = 全部 n 个 */
+    double tol;             /* 行对余弦阈值，0 = max(n, 16) DBL_EPSILON */
+    size_t max_sweeps;      /* 扫描遍数上限 */
+    size_t nthreads;        /* 0 = 全部 CPU */
+} SvdOptions;
+
+typedef struct SvdStatus {
+    size_t sweeps;
+    size_t rotations;
+} SvdStatus;
+
+/* k = 0，tol = 0（自动），max_sweeps = 30，nthreads = 0 */
+void svd_options_default(SvdOptions *opts);
+
+/* A（m x n）不被修改；s 写入 k 个奇异值（k = opts->k，0 时为 n）；
+ * U（k x m，行跨度 ldu >= m）、V（k x n，行跨度 ldv >= n）为 NULL 时不计算 */
+GAUSSIAN_Err svd_jacobi(size_t m, size_t n, const double *A, size_t lda, double *s,
+                        double *U, size_t ldu, double *V, size_t ldv,
+                        const SvdOptions *opts, SvdStatus *status);
+
+/* 最小范数最小二乘：X（n x nrhs）= A^+ B；rcond = 0 取 max(m, n) DBL_EPSILON；
+ * rank 非 NULL 时给出数值秩。A、B 作为工作区被覆盖；
+ * Jacobi 未收敛时仍给出 X，返回 GAUSSIAN_NOT_CONVERGED */
+GAUSSIAN_Err svd_pinv_solve(size_t m, size_t n, double *A, size_t lda,
+                            size_t nrhs, double *B, size_t ldb,
+                            double *X, size_t ldx, double rcond, size_t *rank,
+                            size_t nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_SVD_H
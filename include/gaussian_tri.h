@@ -0,0 +1,71 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_TRI_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_TRI_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * 三角矩阵视图与压缩存储
+ * - TRI_FULL：零拷贝视图，指向任意行跨度 ld 的方阵存储（例如就地 LU 的结果），
+ *   只读取三角部分；单位对角（TRI_UNIT）时对角元不读取
+ * - TRI_PACKED：行主序压缩存储，共 n(n+1)/2 个元素（含对角，单位对角时存 1）
+ *     下三角：(i,j), j <= i 位于 i(i+1)/2 + j
+ *     上三角：(i,j), j >= i 位于 i(2n-i+1)/2 + j - i
+ * 两种布局下每行的三角部分都是连续的：tri_row(T, i)[j] 即元素 (i,j)
+ * （j 只可取该行三角范围内的列），三角求解/乘法均按行访问，直接作用于视图
+ * ============================================================ */
+typedef enum TriUplo { TRI_LOWER = 0, TRI_UPPER = 1 } TriUplo;
+typedef enum TriDiag { TRI_NON_UNIT = 0, TRI_UNIT = 1 } TriDiag;
+typedef enum TriLayout { TRI_FULL = 0, TRI_PACKED = 1 } TriLayout;
+
+#define TRI_PACKED_LOWER_IDX(i,j) ((i)*((i)+1)/2 + (j))
+#define TRI_PACKED_UPPER_IDX(n,i,j) ((i)*(2*(n)-(i)+1)/2 + (j)-(i))
+
+typedef struct TriMatrix {
+    size_t n;
+    const double *data;
+    size_t ld;              /* TRI_FULL 的行跨度；TRI_PACKED 时不使用 */
+    TriUplo uplo;
+    TriDiag diag;
+    TriLayout layout;
+} TriMatrix;
+
+/* 第 i 行的基址：返回值 p 满足 p[j] 为元素 (i,j) */
+static inline const double *tri_row(const TriMatrix *T, size_t i) {
+    if (T->layout == TRI_FULL) return T->data + i * T->ld;
+    if (T->uplo == TRI_LOWER) return T->data + TRI_PACKED_LOWER_IDX(i, 0);
+    return T->data + TRI_PACKED_UPPER_IDX(T->n, i, i) - i;
+}
+
+/* 元素 (i,j)：三角外为 0，单位对角为 1 */
+static inline double tri_get(const TriMatrix *T, size_t i, size_t j) {
+    if (i == j && T->diag == TRI_UNIT) return 1.0;
+    if (T->uplo == TRI_LOWER ? j > i : j < i) return 0.0;
+    return tri_row(T, i)[j];
+}
+
+/* lu_decompose_* 就地结果上的零拷贝视图：L 为单位下三角，U 为上三角（含对角） */
+TriMatrix lu_view_L(size_t n, const double *LU, size_t lda);
+TriMatrix lu_view_U(size_t n, const double *LU, size_t lda);
+/* 行跨度 ld 的一般方阵存储上的视图 */
+TriMatrix tri_view(size_t n, const double *A, size_t ld, TriUplo uplo, TriDiag diag);
+
+/* 压缩存储所需元素个数 n(n+1)/2 */
+size_t tri_packed_size(size_t n);
+/* 把 T 压缩到 AP（tri_packed_size(n) 个 double），*P 为其上的视图（AP 的生命周期由调用者管理） */
+GAUSSIAN_Err tri_pack(const TriMatrix *T, double *AP, TriMatrix *P);
+/* 展开为稠密 n x n（行跨度 ldb），三角外填 0 */
+GAUSSIAN_Err tri_unpack(const TriMatrix *T, double *B, size_t ldb);
+
+/* 就地多右端三角运算，B 为 n x nrhs 行主序（行跨度 ldb >= nrhs）：
+ * tri_solve：B <- T^{-1} B，非单位对角 |t_ii| < EPS 返回 GAUSSIAN_BAD_MATRIX
+ * tri_mult ：B <- T B */
+GAUSSIAN_Err tri_solve(const TriMatrix *T, size_t nrhs, double *B, size_t ldb);
+GAUSSIAN_Err tri_mult(const TriMatrix *T, size_t nrhs, double *B, size_t ldb);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_TRI_H
@@ -0,0 +1,59 @@
+#ifndef NUMERICAL_ANALYSIS_GAUSSIAN_UPDATE_H
+#define NUMERICAL_ANALYSIS_GAUSSIAN_UPDATE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+
+/* ============================================================
+ * LU 的低秩修正：A = A0 + U V^T（累计秩 r）
+ * - 惰性 Sherman-Morrison-Woodbury：保留 A0 的 LU，记录 Z = A0^{-1} U 与 V，
+ *   A^{-1} b = y - Z C^{-1} V^T y，其中 y = A0^{-1} b，C = I_r + V^T Z（r x r，小矩阵 LU）
+ * - 一次秩 k 修正 O(k n^2 + r k n + r^3)，一次求解 O(n^2 + r n)
+ * - 同时显式维护当前 A（O(k n^2)），以下情况自动用当前 A 重新分解并清空修正：
+ *   累计秩超过 max_rank；C 奇异或其估计倒数条件数 < min_rcond；
+ *   探测求解 A x = A 1 的后向误差 ||p - A x||_inf / (||A||_inf ||x||_inf + ||p||_inf)
+ *   > max_berr（A0 病态时即使 C 良态，SMW 也会因相消而失去精度）。探测为 O(n^2)
+ * - 当前 A 奇异时 lu_update_rank_k / lu_update_solve 返回 GAUSSIAN_BAD_MATRIX，
+ *   后续修正使 A 恢复非奇异后可继续使用
+ * - 求解使用对象内的工作区：同一对象不可并发求解
+ * ============================================================ */
+typedef struct LuUpdateOptions {
+    size_t max_rank;        /* 0 = min(n, 64) */
+    double min_rcond;       /* 0 = 1e-8 */
+    double max_berr;        /* 0 = 1e-11 */
+} LuUpdateOptions;
+
+typedef struct LuUpdate {
+    size_t n, rank, max_rank;
+    double min_rcond, max_berr;
+    double *A;              /* 当前矩阵，n x n */
+    double *LU;             /* A0 的 LU，n x n */
+    size_t *piv;
+    double *Zt, *Vt;        /* max_rank x n，第 j 行为 z_j / v_j */
+    double *C, *Clu;        /* max_rank x max_rank：C 与其 LU */
+    size_t *cpiv;
+    double *work;           /* 2 * max_rank */
+    int singular;           /* 1 = 当前 A 奇异（重分解失败） */
+    size_t refactorizations;/* 初始化之后的重新分解次数（含自动触发） */
+    double crcond;          /* 最近一次 C 的倒数条件数估计（rank = 0 时为 1） */
+    double berr;            /* 最近一次探测求解的后向误差（rank = 0 时为 0） */
+} LuUpdate;
+
+/* 复制 A（行跨度 lda）并分解；opts 为 NULL 时取默认值。失败时 S 无需释放 */
+GAUSSIAN_Err lu_update_init(LuUpdate *S, size_t n, const double *A, size_t lda,
+                            const LuUpdateOptions *opts);
+/* A += U V^T，U、V 为 n x k 行主序（行跨度 ldu / ldv >= k） */
+GAUSSIAN_Err lu_update_rank_k(LuUpdate *S, size_t k, const double *U, size_t ldu,
+                              const double *V, size_t ldv);
+/* 用当前 A 重新分解 */
+GAUSSIAN_Err lu_update_refactor(LuUpdate *S);
+/* A x = b，b 与 x 不可重叠 */
+GAUSSIAN_Err lu_update_solve(LuUpdate *S, const double *b, double *x);
+void lu_update_free(LuUpdate *S);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_GAUSSIAN_UPDATE_H
@@ -0,0 +1,85 @@
+#ifndef NUMERICAL_ANALYSIS_ITERATIVE_H
+#define NUMERICAL_ANALYSIS_ITERATIVE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+#include "sparse.h"
+
+/* ============================================================
+ * 迭代求解器公共约定
+ * - x 既是初值也是输出
+ * - 收敛判据：相对残差 ||b - A x||_2 / ||b||_2 <= tol（b = 0 时直接给出 x = 0）
+ * - 返回 GAUSSIAN_SUCCESS 表示收敛；达到 max_iter 仍未收敛返回 GAUSSIAN_NOT_CONVERGED，
+ *   此时 x 为最后一次迭代的结果
+ * ============================================================ */
+typedef enum IterPrecond {
+    ITER_PRECOND_NONE = 0,
+    ITER_PRECOND_JACOBI = 1,    /* 对角缩放 */
+    ITER_PRECOND_ILU0 = 2       /* 零填充不完全 LU，要求行内列号递增且对角元存在 */
+} IterPrecond;
+
+typedef struct IterOptions {
+    double tol;
+    size_t max_iter;
+    size_t restart;             /* GMRES 重启长度 */
+    IterPrecond precond;
+    size_t nthreads;            /* 0 = 全部 CPU，1 = 单线程 */
+    double omega;               /* SOR 松弛因子，0 = 自动估计 */
+} IterOptions;
+
+/* 迭代过程信息。history 由调用者提供（可为 NULL），
+ * 依次写入初始及每次迭代后的相对残差，最多 history_cap 个 */
+typedef struct IterStatus {
+    size_t iterations;
+    double residual;            /* 最终相对残差 */
+    double *history;
+    size_t history_cap;
+    size_t history_len;
+    double omega;               /* SOR 实际使用的松弛因子 */
+} IterStatus;
+
+/* tol = 1e-8，max_iter = 1000，restart = 30，无预条件，单线程，omega 自动 */
+void iter_options_default(IterOptions *opts);
+
+/* ------------------ Krylov 子空间方法（CSR） ------------------
+ * opts 为 NULL 时取默认值；status 可为 NULL。
+ * 预条件矩阵对角元 |d| < EPS 时返回 GAUSSIAN_BAD_MATRIX。 */
+/* 预条件共轭梯度：A 须对称正定（预条件后亦然），检测到 p^T A p <= 0 时返回 GAUSSIAN_NOT_SPD */
+GAUSSIAN_Err krylov_cg(const CsrMatrix *A, const double *b, double *x,
+                       const IterOptions *opts, IterStatus *status);
+/* BiCGSTAB（右预条件）：一般非对称矩阵；rho 或 omega 为零（算法中断）时返回 GAUSSIAN_BAD_MATRIX */
+GAUSSIAN_Err krylov_bicgstab(const CsrMatrix *A, const double *b, double *x,
+                             const IterOptions *opts, IterStatus *status);
+/* 重启 GMRES(m)（右预条件，修正 Gram-Schmidt + Givens 旋转）：每次重启需 (m+1)*n 个 double */
+GAUSSIAN_Err krylov_gmres(const CsrMatrix *A, const double *b, double *x,
+                          const IterOptions *opts, IterStatus *status);
+
+/* ------------------ 定常迭代（Jacobi / Gauss-Seidel / SOR） ------------------
+ * 按 A + A^T 的非零模式做贪心多色着色（五点差分即红黑两色），同色行互不耦合，
+ * 一次扫描按颜色依次进行、同色行并行更新；结果与线程数无关。
+ * - 每次扫描顺带累计各行更新时刻的残差作为估计（Jacobi 即为扫描前迭代的真实残差），
+ *   写入 history；估计达到 tol 后计算真实残差确认，status->residual 为真实残差
+ * - SOR 且 opts->omega = 0 时先做若干次 Gauss-Seidel 扫描，由相邻两次修正量之比估计
+ *   rho(GS)，取 omega = 2 / (1 + sqrt(1 - rho))（对相容次序矩阵最优）
+ * - 对角元 |a_ii| < EPS 时返回 GAUSSIAN_BAD_MATRIX；opts->precond / restart 不使用 */
+typedef enum StationaryMethod {
+    STATIONARY_JACOBI = 0,
+    STATIONARY_GAUSS_SEIDEL = 1,
+    STATIONARY_SOR = 2
+} StationaryMethod;
+
+GAUSSIAN_Err stationary_solve_csr(const CsrMatrix *A, const double *b, double *x,
+                                  StationaryMethod method, const IterOptions *opts,
+                                  IterStatus *status);
+/* 稠密 n x n，行跨度 lda；着色按 a_ij != 0 的模式，稠密矩阵退化为逐行顺序 */
+GAUSSIAN_Err stationary_solve_dense(size_t n, const double *A, size_t lda,
+                                    const double *b, double *x,
+                                    StationaryMethod method, const IterOptions *opts,
+                                    IterStatus *status);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_ITERATIVE_H
@@ -0,0 +1,42 @@
+#ifndef NUMERICAL_ANALYSIS_SPARSE_H
+#define NUMERICAL_ANALYSIS_SPARSE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+#include "thread_pool.h"
+
+/* ============================================================
+ * CSR（压缩行）稀疏矩阵
+ *   第 i 行的非零元为 val[row_ptr[i] .. row_ptr[i+1])，列号在 col_idx 中。
+ * - 本模块生成的矩阵每行列号严格递增；ILU(0) 等依赖该顺序及对角元存在
+ * - 结构体由调用者持有，csr_alloc 分配、csr_free 释放三个数组
+ * ============================================================ */
+typedef struct CsrMatrix {
+    size_t nrows, ncols, nnz;
+    size_t *row_ptr;      /* nrows + 1 */
+    size_t *col_idx;      /* nnz */
+    double *val;          /* nnz */
+} CsrMatrix;
+
+/* row_ptr 清零，col_idx / val 未初始化 */
+GAUSSIAN_Err csr_alloc(CsrMatrix *A, size_t nrows, size_t ncols, size_t nnz);
+void csr_free(CsrMatrix *A);
+
+/* 从稠密矩阵（行跨度 lda）提取 |a_ij| > drop_tol 的元素；对角元总是保留 */
+GAUSSIAN_Err csr_from_dense(size_t nrows, size_t ncols, const double *A, size_t lda,
+                            double drop_tol, CsrMatrix *out);
+/* 展开为稠密矩阵（行跨度 lda），测试/小规模用 */
+GAUSSIAN_Err csr_to_dense(const CsrMatrix *A, double *D, size_t lda);
+
+/* 二维 Poisson（五点差分，Dirichlet 边界）：nx*ny 阶，对角 4、邻点 -1，对称正定 */
+GAUSSIAN_Err csr_poisson2d(size_t nx, size_t ny, CsrMatrix *out);
+
+/* y = A x；pool 为 NULL 时单线程，否则按行分块并行。x 与 y 不可重叠 */
+void csr_spmv(const CsrMatrix *A, const double *x, double *y, ThreadPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_SPARSE_H
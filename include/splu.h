@@ -0,0 +1,78 @@
+#ifndef NUMERICAL_ANALYSIS_SPLU_H
+#define NUMERICAL_ANALYSIS_SPLU_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+#include "Gaussian.h"
+#include "sparse.h"
+
+/* ============================================================
+ * 稀疏直接 LU：P A Q = L U
+ * - 填充约减排序 Q 作用在 A + A^T 的模式上，给出列次序，同时作为首选主元行次序
+ * - 符号分析（排序、A 的列视图、填充预测）与数值分解分离：
+ *   同一稀疏模式的多次数值分解（时间步进）只需做一次 splu_analyze
+ * - 数值分解为左视（Gilbert-Peierls）列 LU + 阈值部分主元：第 k 列在尚未选为主元的行中，
+ *   若首选行 perm[k]（置换后的对角）满足 |a_dk| >= SPLU_PIVOT_TAU * max_i |a_ik| 则取之，
+ *   否则取绝对值最大的行。对角为零/偏弱（KKT、需换行的矩阵）也能分解；
+ *   主元选择依赖数值，L/U 的实际模式与非零数在 SpluNumeric 中给出。
+ *   max_i |a_ik| < EPS（数值奇异）时返回 GAUSSIAN_BAD_MATRIX
+ * ============================================================ */
+#ifndef SPLU_PIVOT_TAU
+#define SPLU_PIVOT_TAU 0.1
+#endif
+
+typedef enum SpluOrdering {
+    SPLU_ORDER_NATURAL = 0,
+    SPLU_ORDER_RCM = 1,         /* 逆 Cuthill-McKee：压缩带宽 */
+    SPLU_ORDER_MINDEG = 2       /* 精确最小度（非近似 AMD）：减少填充 */
+} SpluOrdering;
+
+typedef struct SpluSymbolic {
+    size_t n;
+    size_t *perm;               /* 新编号 -> 原编号 */
+    size_t *iperm;              /* 原编号 -> 新编号 */
+    /* A 按新列次序的 CSC 视图：第 k 列为 A(:, perm[k])，行号为原行号且递增 */
+    size_t *col_ptr, *row_idx;
+    size_t *amap;               /* CSC 第 q 个元素在 A->val 中的位置 */
+    size_t *a_row_ptr, *a_col_idx;  /* 分析时 A 的模式，用于校验 */
+    size_t nnz_a;
+    /* 以下为全取对角主元时的预测（A + A^T 模式的消去树），用于预分配与统计 */
+    size_t nnz_l, nnz_u;        /* 不含对角 / 含对角 */
+    size_t fill_in;             /* nnz_l + nnz_u - nnz(A)（对角缺失的 A 亦计入） */
+    size_t symbolic_bytes, numeric_bytes;
+} SpluSymbolic;
+
+typedef struct SpluNumeric {
+    const SpluSymbolic *sym;
+    size_t n;                   /* 缓冲区按此阶数分配 */
+    size_t *prow;               /* 第 k 步的主元行（原行号） */
+    size_t *pinv;               /* 原行号 -> 步号 */
+    /* L（单位下三角，对角省略）与 U（对角单独存放）按列压缩，行号为步号 */
+    size_t *l_ptr, *l_idx, *u_ptr, *u_idx;
+    double *l_val, *u_val, *u_diag;
+    size_t l_cap, u_cap;
+    size_t nnz_l, nnz_u;        /* 实际非零数：不含对角 / 含对角 */
+    size_t off_diag_pivots;     /* 未取首选行（置换后的对角）为主元的步数 */
+} SpluNumeric;
+
+/* 单独的排序接口：perm[新] = 原，基于 A + A^T 的模式 */
+GAUSSIAN_Err csr_order_rcm(const CsrMatrix *A, size_t *perm);
+GAUSSIAN_Err csr_order_mindeg(const CsrMatrix *A, size_t *perm);
+
+/* 符号分析；A 须为方阵、行内列号严格递增且在 [0, n) 内，否则返回 GAUSSIAN_INVALID_INPUT */
+GAUSSIAN_Err splu_analyze(const CsrMatrix *A, SpluOrdering ordering, SpluSymbolic *sym);
+void splu_symbolic_free(SpluSymbolic *sym);
+
+/* 数值分解：A 的稀疏模式（row_ptr 与 col_idx）须与 analyze 时相同（数值可变）。
+ * num 首次使用前应清零；重复分解时复用 num 中的缓冲区 */
+GAUSSIAN_Err splu_factor(const SpluSymbolic *sym, const CsrMatrix *A, SpluNumeric *num);
+void splu_numeric_free(SpluNumeric *num);
+
+/* A x = b，x 可与 b 相同 */
+GAUSSIAN_Err splu_solve(const SpluNumeric *num, const double *b, double *x);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_SPLU_H
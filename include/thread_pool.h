@@ -0,0 +1,50 @@
+#ifndef NUMERICAL_ANALYSIS_THREAD_POOL_H
+#define NUMERICAL_ANALYSIS_THREAD_POOL_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+
+/* ============================================================
+ * 线程池（pthreads / Win32 线程，见 thread_sync.h）+ 依赖驱动的任务图
+ * - 调用线程本身作为 0 号工作线程参与计算，nthreads=1 时不创建线程
+ * - thread_pool_run / parallel_for / task_graph_run 不可在任务内部嵌套调用
+ * ============================================================ */
+typedef struct ThreadPool ThreadPool;
+typedef struct TaskGraph TaskGraph;
+
+typedef void (*ThreadPoolFn)(void *ctx, size_t worker);
+typedef void (*ThreadPoolRangeFn)(void *ctx, size_t begin, size_t end);
+typedef void (*TaskFn)(void *arg);
+
+#define TASK_GRAPH_INVALID ((size_t)-1)
+
+/* 逻辑 CPU 数（至少为 1） */
+size_t thread_pool_cpu_count(void);
+
+/* nthreads = 0 表示使用 thread_pool_cpu_count()；失败返回 NULL */
+ThreadPool *thread_pool_create(size_t nthreads);
+void thread_pool_destroy(ThreadPool *pool);
+size_t thread_pool_size(const ThreadPool *pool);
+
+/* 每个工作线程（含调用者）各执行一次 fn(ctx, worker)，返回时全部完成 */
+void thread_pool_run(ThreadPool *pool, ThreadPoolFn fn, void *ctx);
+
+/* 把 [0, n) 切成长度约为 grain 的块动态分发；grain = 0 时自动选择 */
+void thread_pool_parallel_for(ThreadPool *pool, size_t n, size_t grain,
+                              ThreadPoolRangeFn fn, void *ctx);
+
+/* 任务图：先 add 全部任务并声明依赖，再 run；run 之后图不可复用 */
+TaskGraph *task_graph_create(void);
+void task_graph_destroy(TaskGraph *g);
+/* 返回任务编号；内存不足返回 TASK_GRAPH_INVALID */
+size_t task_graph_add(TaskGraph *g, TaskFn fn, void *arg, int priority);
+/* after 在 before 完成后才可执行；成功返回 0，失败返回 -1 */
+int task_graph_depend(TaskGraph *g, size_t before, size_t after);
+/* 就绪任务按 priority 从大到小调度 */
+void task_graph_run(TaskGraph *g, ThreadPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_THREAD_POOL_H
@@ -0,0 +1,74 @@
+#ifndef NUMERICAL_ANALYSIS_THREAD_SYNC_H
+#define NUMERICAL_ANALYSIS_THREAD_SYNC_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================
+ * 线程 / 互斥量 / 条件变量的最小可移植层（thread_pool.c、gaussian_ooc.c 内部使用）
+ * - _WIN32：CRITICAL_SECTION / CONDITION_VARIABLE / CreateThread（MSVC 无 pthread.h）
+ * - 其余平台：pthreads
+ * - 线程入口写作 static ThreadRet THREAD_CALL fn(void *arg)，以 return (ThreadRet)0 结束
+ * - 所有函数成功返回 0
+ * ============================================================ */
+#ifdef _WIN32
+#include <windows.h>
+
+typedef CRITICAL_SECTION ThreadMutex;
+typedef CONDITION_VARIABLE ThreadCond;
+typedef HANDLE ThreadHandle;
+typedef DWORD ThreadRet;
+#define THREAD_CALL WINAPI
+
+static inline int thread_mutex_init(ThreadMutex *m) { InitializeCriticalSection(m); return 0; }
+static inline void thread_mutex_destroy(ThreadMutex *m) { DeleteCriticalSection(m); }
+static inline void thread_mutex_lock(ThreadMutex *m) { EnterCriticalSection(m); }
+static inline void thread_mutex_unlock(ThreadMutex *m) { LeaveCriticalSection(m); }
+
+static inline int thread_cond_init(ThreadCond *c) { InitializeConditionVariable(c); return 0; }
+static inline void thread_cond_destroy(ThreadCond *c) { (void)c; }
+static inline void thread_cond_wait(ThreadCond *c, ThreadMutex *m) {
+    SleepConditionVariableCS(c, m, INFINITE);
+}
+static inline void thread_cond_signal(ThreadCond *c) { WakeConditionVariable(c); }
+static inline void thread_cond_broadcast(ThreadCond *c) { WakeAllConditionVariable(c); }
+
+static inline int thread_create(ThreadHandle *t, ThreadRet (THREAD_CALL *fn)(void *), void *arg) {
+    *t = CreateThread(NULL, 0, fn, arg, 0, NULL);
+    return *t ? 0 : -1;
+}
+static inline void thread_join(ThreadHandle t) {
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+
+#else
+#include <pthread.h>
+
+typedef pthread_mutex_t ThreadMutex;
+typedef pthread_cond_t ThreadCond;
+typedef pthread_t ThreadHandle;
+typedef void *ThreadRet;
+#define THREAD_CALL
+
+static inline int thread_mutex_init(ThreadMutex *m) { return pthread_mutex_init(m, NULL); }
+static inline void thread_mutex_destroy(ThreadMutex *m) { pthread_mutex_destroy(m); }
+static inline void thread_mutex_lock(ThreadMutex *m) { pthread_mutex_lock(m); }
+static inline void thread_mutex_unlock(ThreadMutex *m) { pthread_mutex_unlock(m); }
+
+static inline int thread_cond_init(ThreadCond *c) { return pthread_cond_init(c, NULL); }
+static inline void thread_cond_destroy(ThreadCond *c) { pthread_cond_destroy(c); }
+static inline void thread_cond_wait(ThreadCond *c, ThreadMutex *m) { pthread_cond_wait(c, m); }
+static inline void thread_cond_signal(ThreadCond *c) { pthread_cond_signal(c); }
+static inline void thread_cond_broadcast(ThreadCond *c) { pthread_cond_broadcast(c); }
+
+static inline int thread_create(ThreadHandle *t, ThreadRet (THREAD_CALL *fn)(void *), void *arg) {
+    return pthread_create(t, NULL, fn, arg);
+}
+static inline void thread_join(ThreadHandle t) { pthread_join(t, NULL); }
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif //NUMERICAL_ANALYSIS_THREAD_SYNC_H
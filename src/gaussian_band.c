@@ -0,0 +1,269 @@
+#include "gaussian_band.h"
+#include "gaussian_batch.h"
+#include "gaussian_simd.h"
+#include "thread_pool.h"
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LANES GAUSSIAN_BATCH_LANES
+
+static size_t min_sz(size_t a, size_t b) { return a < b ? a : b; }
+
+GAUSSIAN_Err band_pack(size_t n, size_t kl, size_t ku, const double *A, size_t lda,
+                       double *AB, size_t ldab) {
+    if (!A || !AB || lda < n || ldab < kl + ku + 1) return GAUSSIAN_INVALID_INPUT;
+    for (size_t i = 0; i < n; ++i) {
+        memset(AB + i * ldab, 0, ldab * sizeof(double));
+        size_t j0 = i > kl ? i - kl : 0, j1 = min_sz(n - 1, i + ku);
+        for (size_t j = j0; j <= j1; ++j)
+            AB[BAND_IDX(i, j, ldab, kl)] = A[IDX(i, j, lda)];
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 带状 LU ------------------
+ * 第 k 步只涉及行 k..k+kl、列 k..ju，ju 为目前 U 中出现非零的最右列。
+ * 行主序下每行的带内元素连续，行更新直接用 axpy 核。 */
+GAUSSIAN_Err band_lu_decompose(size_t n, size_t kl, size_t ku, double *AB, size_t ldab,
+                               size_t *ipiv) {
+    const double EPS = 1e-12;
+    if (!AB || !ipiv || n == 0 || ldab < BAND_LDAB_LU(kl, ku)) return GAUSSIAN_INVALID_INPUT;
+    const GaussianKernels *K = gaussian_kernels();
+
+    /* 清零填充区 */
+    for (size_t i = 0; i < n; ++i)
+        memset(AB + i * ldab + kl + ku + 1, 0, kl * sizeof(double));
+
+    size_t ju = 0;
+    for (size_t k = 0; k < n; ++k) {
+        const size_t iend = min_sz(n - 1, k + kl);
+        size_t p = k;
+        double maxv = fabs(AB[BAND_IDX(k, k, ldab, kl)]);
+        for (size_t i = k + 1; i <= iend; ++i) {
+            double v = fabs(AB[BAND_IDX(i, k, ldab, kl)]);
+            if (v > maxv) { maxv = v; p = i; }
+        }
+        ipiv[k] = p;
+        if (maxv < EPS) return GAUSSIAN_BAD_MATRIX;
+
+        size_t jp = min_sz(n - 1, p + ku);
+        if (jp > ju) ju = jp;
+        if (p != k) {
+            double *rk = &AB[BAND_IDX(k, k, ldab, kl)], *rp = &AB[BAND_IDX(p, k, ldab, kl)];
+            for (size_t j = 0; j <= ju - k; ++j) {
+                double t = rk[j]; rk[j] = rp[j]; rp[j] = t;
+            }
+        }
+
+        const double *rk = &AB[BAND_IDX(k, k, ldab, kl)];
+        const double inv = 1.0 / rk[0];
+        for (size_t i = k + 1; i <= iend; ++i) {
+            double *ri = &AB[BAND_IDX(i, k, ldab, kl)];
+            double l = ri[0] * inv;
+            ri[0] = l;
+            K->axpy(ju - k, l, rk + 1, ri + 1);
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err band_lu_solve(size_t n, size_t kl, size_t ku, const double *AB, size_t ldab,
+                           const size_t *ipiv, const double *b, double *x) {
+    if (!AB || !ipiv || !b || !x || ldab < BAND_LDAB_LU(kl, ku)) return GAUSSIAN_INVALID_INPUT;
+    if (x != b) memcpy(x, b, n * sizeof(double));
+
+    /* L y = P b：交换与消去按分解时的顺序交替进行 */
+    for (size_t k = 0; k < n; ++k) {
+        size_t p = ipiv[k];
+        if (p != k) { double t = x[k]; x[k] = x[p]; x[p] = t; }
+        const size_t iend = min_sz(n - 1, k + kl);
+        for (size_t i = k + 1; i <= iend; ++i)
+            x[i] -= AB[BAND_IDX(i, k, ldab, kl)] * x[k];
+    }
+    /* U x = y：U 的上带宽为 kl + ku */
+    for (size_t i = n; i-- > 0;) {
+        const double *ri = &AB[BAND_IDX(i, i, ldab, kl)];
+        const size_t jend = min_sz(n - 1, i + kl + ku);
+        double sum = x[i];
+        for (size_t j = i + 1; j <= jend; ++j) sum -= ri[j - i] * x[j];
+        x[i] = sum / ri[0];
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 三对角 Thomas ------------------ */
+GAUSSIAN_Err tridiag_solve(size_t n, const double *dl, const double *d, const double *du,
+                           const double *b, double *x) {
+    const double EPS = 1e-12;
+    if (!d || !b || !x || n == 0 || (n > 1 && (!dl || !du))) return GAUSSIAN_INVALID_INPUT;
+    double *c = (double*)malloc(n * sizeof(double));   /* 消元后的上对角 */
+    if (!c) return GAUSSIAN_NO_MEMORY;
+
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    double w = d[0];
+    if (fabs(w) < EPS) { ret = GAUSSIAN_BAD_MATRIX; goto done; }
+    c[0] = n > 1 ? du[0] / w : 0.0;
+    x[0] = b[0] / w;
+    for (size_t i = 1; i < n; ++i) {
+        w = d[i] - dl[i] * c[i - 1];
+        if (fabs(w) < EPS) { ret = GAUSSIAN_BAD_MATRIX; goto done; }
+        c[i] = i + 1 < n ? du[i] / w : 0.0;
+        x[i] = (b[i] - dl[i] * x[i - 1]) / w;
+    }
+    for (size_t i = n - 1; i-- > 0;)
+        x[i] -= c[i] * x[i + 1];
+done:
+    free(c);
+    return ret;
+}
+
+/* ------------------ 批量三对角：LANES 个系统同时消元 ------------------
+ * 各数组为本组起始指针，元素 i 的 LANES 个 lane 连续；lane 维循环由编译器向量化。
+ * 奇异 lane 以 1 代替主元继续运算（结果无效），返回其位掩码。 */
+static GAUSSIAN_ALWAYS_INLINE unsigned tridiag_group_impl(size_t n, const double *dl,
+        const double *d, const double *du, const double *b, double *x, double *c) {
+    const double EPS = 1e-12;
+    unsigned bad = 0;
+    double inv[LANES];
+
+    for (size_t l = 0; l < LANES; ++l) {
+        double w = d[l];
+        if (fabs(w) < EPS) { bad |= 1u << l; w = 1.0; }
+        inv[l] = 1.0 / w;
+        c[l] = n > 1 ? du[l] * inv[l] : 0.0;
+        x[l] = b[l] * inv[l];
+    }
+    for (size_t i = 1; i < n; ++i) {
+        const double *li = dl + i * LANES, *di = d + i * LANES;
+        const double *ui = du + i * LANES, *bi = b + i * LANES;
+        const double *cp = c + (i - 1) * LANES, *xp = x + (i - 1) * LANES;
+        double *ci = c + i * LANES, *xi = x + i * LANES;
+        for (size_t l = 0; l < LANES; ++l) {
+            double w = di[l] - li[l] * cp[l];
+            int sing = fabs(w) < EPS;
+            bad |= (unsigned)sing << l;
+            inv[l] = 1.0 / (sing ? 1.0 : w);
+        }
+        for (size_t l = 0; l < LANES; ++l) {
+            ci[l] = i + 1 < n ? ui[l] * inv[l] : 0.0;
+            xi[l] = (bi[l] - li[l] * xp[l]) * inv[l];
+        }
+    }
+    for (size_t i = n - 1; i-- > 0;) {
+        const double *ci = c + i * LANES, *xn = x + (i + 1) * LANES;
+        double *xi = x + i * LANES;
+        for (size_t l = 0; l < LANES; ++l) xi[l] -= ci[l] * xn[l];
+    }
+    return bad;
+}
+
+typedef unsigned (*TridiagGroupFn)(size_t n, const double *dl, const double *d,
+                                   const double *du, const double *b, double *x, double *c);
+
+static unsigned tridiag_group_default(size_t n, const double *dl, const double *d,
+                                      const double *du, const double *b, double *x, double *c) {
+    return tridiag_group_impl(n, dl, d, du, b, x, c);
+}
+#ifdef GAUSSIAN_SIMD_X86
+GAUSSIAN_TARGET_AVX2
+static unsigned tridiag_group_avx2(size_t n, const double *dl, const double *d,
+                                   const double *du, const double *b, double *x, double *c) {
+    return tridiag_group_impl(n, dl, d, du, b, x, c);
+}
+GAUSSIAN_TARGET_AVX512
+static unsigned tridiag_group_avx512(size_t n, const double *dl, const double *d,
+                                     const double *du, const double *b, double *x, double *c) {
+    return tridiag_group_impl(n, dl, d, du, b, x, c);
+}
+#endif
+
+typedef struct {
+    size_t n, count;
+    const double *dl, *d, *du, *b;
+    double *x;
+    GAUSSIAN_Err *info;
+    TridiagGroupFn group_fn;
+    atomic_int any_bad;
+    atomic_int no_memory;
+} TridiagJob;
+
+static void tridiag_range(void *p, size_t g0, size_t g1) {
+    TridiagJob *job = (TridiagJob*)p;
+    const size_t n = job->n, gsize = n * LANES;
+    /* c 之后是末组的暂存区：dl, d, du, b, x 各 gsize */
+    const int partial = g1 * LANES > job->count;
+    double *c = (double*)malloc((partial ? 6 : 1) * gsize * sizeof(double));
+    if (!c) { atomic_store(&job->no_memory, 1); return; }
+
+    for (size_t g = g0; g < g1; ++g) {
+        size_t valid = job->count - g * LANES;
+        if (valid > LANES) valid = LANES;
+        const size_t off = g * gsize;
+        unsigned bad;
+        if (valid == LANES) {
+            bad = job->group_fn(n, job->dl + off, job->d + off, job->du + off,
+                                job->b + off, job->x + off, c);
+        } else {
+            /* 末组：空 lane 填单位系统（d = 1，dl = du = 0，b = 0），只读写有效 lane，
+             * 不在（调用者未必初始化的）填充数据上做运算 */
+            double *sdl = c + gsize, *sd = sdl + gsize, *sdu = sd + gsize;
+            double *sb = sdu + gsize, *sx = sb + gsize;
+            for (size_t e = 0; e < gsize; e += LANES)
+                for (size_t l = 0; l < LANES; ++l) {
+                    const int v = l < valid;
+                    sdl[e + l] = v ? job->dl[off + e + l] : 0.0;
+                    sd[e + l] = v ? job->d[off + e + l] : 1.0;
+                    sdu[e + l] = v ? job->du[off + e + l] : 0.0;
+                    sb[e + l] = v ? job->b[off + e + l] : 0.0;
+                }
+            bad = job->group_fn(n, sdl, sd, sdu, sb, sx, c);
+            for (size_t e = 0; e < gsize; e += LANES)
+                memcpy(job->x + off + e, sx + e, valid * sizeof(double));
+        }
+        bad &= (1u << valid) - 1u;
+        if (bad) atomic_store(&job->any_bad, 1);
+        if (job->info)
+            for (size_t l = 0; l < valid; ++l)
+                job->info[g * LANES + l] = (bad >> l) & 1u ? GAUSSIAN_BAD_MATRIX : GAUSSIAN_SUCCESS;
+    }
+    free(c);
+}
+
+GAUSSIAN_Err tridiag_batch_solve(size_t n, size_t count, const double *dl, const double *d,
+                                 const double *du, const double *b, double *x,
+                                 GAUSSIAN_Err *info, size_t nthreads) {
+    if (!dl || !d || !du || !b || !x || n == 0) return GAUSSIAN_INVALID_INPUT;
+    if (count == 0) return GAUSSIAN_SUCCESS;
+
+    TridiagJob job;
+    job.n = n;
+    job.count = count;
+    job.dl = dl; job.d = d; job.du = du; job.b = b;
+    job.x = x;
+    job.info = info;
+    job.group_fn = tridiag_group_default;
+#ifdef GAUSSIAN_SIMD_X86
+    switch (gaussian_kernels()->level) {
+    case GAUSSIAN_SIMD_AVX512: job.group_fn = tridiag_group_avx512; break;
+    case GAUSSIAN_SIMD_AVX2:   job.group_fn = tridiag_group_avx2; break;
+    default: break;
+    }
+#endif
+    atomic_init(&job.any_bad, 0);
+    atomic_init(&job.no_memory, 0);
+
+    const size_t groups = (count + LANES - 1) / LANES;
+    if (nthreads == 1 || groups == 1) {
+        tridiag_range(&job, 0, groups);
+    } else {
+        ThreadPool *pool = thread_pool_create(nthreads);
+        if (!pool) return GAUSSIAN_NO_MEMORY;
+        thread_pool_parallel_for(pool, groups, 0, tridiag_range, &job);
+        thread_pool_destroy(pool);
+    }
+    if (atomic_load(&job.no_memory)) return GAUSSIAN_NO_MEMORY;
+    return atomic_load(&job.any_bad) ? GAUSSIAN_BAD_MATRIX : GAUSSIAN_SUCCESS;
+}
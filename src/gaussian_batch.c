@@ -0,0 +1,222 @@
+#include "gaussian_batch.h"
+#include "gaussian_simd.h"
+#include "thread_pool.h"
+
+#include <math.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#define LANES GAUSSIAN_BATCH_LANES
+
+size_t gauss_batch_size_A(size_t n, size_t count) {
+    size_t groups = (count + LANES - 1) / LANES;
+    return groups * n * (n + 1) * LANES;
+}
+
+size_t gauss_batch_size_x(size_t n, size_t count) {
+    size_t groups = (count + LANES - 1) / LANES;
+    return groups * n * LANES;
+}
+
+GAUSSIAN_Err gauss_batch_pack(size_t n, size_t count, const double *A, size_t lda,
+                              double *A_batch) {
+    if (!A || !A_batch || lda < n + 1) return GAUSSIAN_INVALID_INPUT;
+    for (size_t s = 0; s < count; ++s) {
+        const double *src = A + s * n * lda;
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j <= n; ++j)
+                A_batch[GAUSS_BATCH_AIDX(n, s, i, j)] = src[AIDX(i, j, lda)];
+    }
+    /* 末组的空 lane 填单位阵、右端为 0，使整个缓冲区都有定义 */
+    for (size_t s = count; s % LANES != 0; ++s)
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j <= n; ++j)
+                A_batch[GAUSS_BATCH_AIDX(n, s, i, j)] = (i == j) ? 1.0 : 0.0;
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err gauss_batch_unpack_x(size_t n, size_t count, const double *x_batch, double *x) {
+    if (!x_batch || !x) return GAUSSIAN_INVALID_INPUT;
+    for (size_t s = 0; s < count; ++s)
+        for (size_t i = 0; i < n; ++i)
+            x[s * n + i] = x_batch[GAUSS_BATCH_XIDX(n, s, i)];
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 单组（LANES 个系统）消元 ------------------
+ * a 为本组工作副本：a[(i*(n+1)+j)*LANES + l]；lane 维上的循环长度为常数，
+ * 由编译器向量化。返回奇异 lane 的位掩码。 */
+static GAUSSIAN_ALWAYS_INLINE unsigned batch_group_impl(size_t n, double *a, double *x) {
+    const double EPS = 1e-12;
+    const size_t w = n + 1;
+    double maxv[LANES], pivf[LANES], inv[LANES], f[LANES];
+    unsigned bad = 0;
+
+    for (size_t k = 0; k < n; ++k) {
+        /* 1) 逐 lane 选主元：比较 + 选择 */
+        for (size_t l = 0; l < LANES; ++l) {
+            maxv[l] = fabs(a[(k*w + k)*LANES + l]);
+            pivf[l] = (double)k;
+        }
+        for (size_t i = k + 1; i < n; ++i) {
+            const double *col = &a[(i*w + k)*LANES];
+            for (size_t l = 0; l < LANES; ++l) {
+                double v = fabs(col[l]);
+                int gt = v > maxv[l];
+                maxv[l] = gt ? v : maxv[l];
+                pivf[l] = gt ? (double)i : pivf[l];
+            }
+        }
+        for (size_t l = 0; l < LANES; ++l)
+            if (maxv[l] < EPS) bad |= 1u << l;
+
+        /* 2) 行交换：每个 lane 与自己的主元行交换（主元行为 k 时为自交换） */
+        for (size_t l = 0; l < LANES; ++l) {
+            size_t p = (size_t)pivf[l];
+            for (size_t j = k; j <= n; ++j) {
+                double t = a[(k*w + j)*LANES + l];
+                a[(k*w + j)*LANES + l] = a[(p*w + j)*LANES + l];
+                a[(p*w + j)*LANES + l] = t;
+            }
+        }
+
+        /* 3) 归一化主元行；奇异 lane 以 1 代替主元，避免产生 Inf/NaN */
+        for (size_t l = 0; l < LANES; ++l) {
+            double akk = a[(k*w + k)*LANES + l];
+            inv[l] = 1.0 / (maxv[l] < EPS ? 1.0 : akk);
+        }
+        for (size_t j = k; j <= n; ++j) {
+            double *row = &a[(k*w + j)*LANES];
+            for (size_t l = 0; l < LANES; ++l) row[l] *= inv[l];
+        }
+
+        /* 4) 消去下方各行 */
+        for (size_t i = k + 1; i < n; ++i) {
+            for (size_t l = 0; l < LANES; ++l) f[l] = a[(i*w + k)*LANES + l];
+            for (size_t j = k; j <= n; ++j) {
+                double *dst = &a[(i*w + j)*LANES];
+                const double *src = &a[(k*w + j)*LANES];
+                for (size_t l = 0; l < LANES; ++l) dst[l] -= f[l] * src[l];
+            }
+        }
+    }
+
+    /* 5) 回代（对角已归一） */
+    for (size_t ii = n; ii-- > 0;) {
+        double sum[LANES];
+        for (size_t l = 0; l < LANES; ++l) sum[l] = a[(ii*w + n)*LANES + l];
+        for (size_t j = ii + 1; j < n; ++j) {
+            const double *aij = &a[(ii*w + j)*LANES];
+            const double *xj = &x[j*LANES];
+            for (size_t l = 0; l < LANES; ++l) sum[l] -= aij[l] * xj[l];
+        }
+        for (size_t l = 0; l < LANES; ++l) x[ii*LANES + l] = sum[l];
+    }
+    return bad;
+}
+
+/* 按常数 n 展开：每个 n 生成一份循环边界已知的内核，便于完全向量化/展开 */
+#define BATCH_GROUP_SWITCH(n, a, x)                              \
+    switch (n) {                                                 \
+    case 1:  return batch_group_impl(1, a, x);                   \
+    case 2:  return batch_group_impl(2, a, x);                   \
+    case 3:  return batch_group_impl(3, a, x);                   \
+    case 4:  return batch_group_impl(4, a, x);                   \
+    case 5:  return batch_group_impl(5, a, x);                   \
+    case 6:  return batch_group_impl(6, a, x);                   \
+    case 7:  return batch_group_impl(7, a, x);                   \
+    case 8:  return batch_group_impl(8, a, x);                   \
+    default: return batch_group_impl(n, a, x);                   \
+    }
+
+static unsigned batch_group_default(size_t n, double *a, double *x) {
+    BATCH_GROUP_SWITCH(n, a, x)
+}
+#ifdef GAUSSIAN_SIMD_X86
+GAUSSIAN_TARGET_AVX2
+static unsigned batch_group_avx2(size_t n, double *a, double *x) {
+    BATCH_GROUP_SWITCH(n, a, x)
+}
+GAUSSIAN_TARGET_AVX512
+static unsigned batch_group_avx512(size_t n, double *a, double *x) {
+    BATCH_GROUP_SWITCH(n, a, x)
+}
+#endif
+
+typedef unsigned (*BatchGroupFn)(size_t n, double *a, double *x);
+
+typedef struct {
+    size_t n, count;
+    const double *A;
+    double *x;
+    GAUSSIAN_Err *info;
+    BatchGroupFn group_fn;
+    atomic_int any_bad;
+} BatchJob;
+
+static void batch_range(void *p, size_t g0, size_t g1) {
+    BatchJob *job = (BatchJob*)p;
+    const size_t n = job->n;
+    const size_t gsize = n * (n + 1) * LANES;
+    double a[GAUSSIAN_BATCH_MAX_N * (GAUSSIAN_BATCH_MAX_N + 1) * LANES];
+    double x[GAUSSIAN_BATCH_MAX_N * LANES];
+
+    for (size_t g = g0; g < g1; ++g) {
+        size_t valid = job->count - g * LANES;
+        if (valid > LANES) valid = LANES;
+        if (valid == LANES) {
+            memcpy(a, job->A + g * gsize, gsize * sizeof(double));
+        } else {
+            /* 末组：空 lane 填单位阵、右端为 0，只从输入读有效 lane，
+             * 不在（调用者未必初始化的）填充数据上做运算 */
+            const double *src = job->A + g * gsize;
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j <= n; ++j) {
+                    const size_t e = (i*(n+1) + j)*LANES;
+                    for (size_t l = 0; l < LANES; ++l)
+                        a[e + l] = l < valid ? src[e + l] : (i == j) ? 1.0 : 0.0;
+                }
+        }
+
+        unsigned bad = job->group_fn(n, a, x);
+        memcpy(job->x + g * n * LANES, x, n * LANES * sizeof(double));
+        bad &= (1u << valid) - 1u;
+        if (bad) atomic_store(&job->any_bad, 1);
+        if (job->info)
+            for (size_t l = 0; l < valid; ++l)
+                job->info[g * LANES + l] = (bad >> l) & 1u ? GAUSSIAN_BAD_MATRIX : GAUSSIAN_SUCCESS;
+    }
+}
+
+GAUSSIAN_Err gauss_batch_solve(size_t n, size_t count, const double *A_batch,
+                               double *x_batch, GAUSSIAN_Err *info, size_t nthreads) {
+    if (!A_batch || !x_batch || n == 0 || n > GAUSSIAN_BATCH_MAX_N) return GAUSSIAN_INVALID_INPUT;
+    if (count == 0) return GAUSSIAN_SUCCESS;
+
+    BatchJob job;
+    job.n = n;
+    job.count = count;
+    job.A = A_batch;
+    job.x = x_batch;
+    job.info = info;
+    job.group_fn = batch_group_default;
+#ifdef GAUSSIAN_SIMD_X86
+    switch (gaussian_kernels()->level) {
+    case GAUSSIAN_SIMD_AVX512: job.group_fn = batch_group_avx512; break;
+    case GAUSSIAN_SIMD_AVX2:   job.group_fn = batch_group_avx2; break;
+    default: break;
+    }
+#endif
+    atomic_init(&job.any_bad, 0);
+
+    const size_t groups = (count + LANES - 1) / LANES;
+    if (nthreads == 1 || groups == 1) {
+        batch_range(&job, 0, groups);
+    } else {
+        ThreadPool *pool = thread_pool_create(nthreads);
+        if (!pool) return GAUSSIAN_NO_MEMORY;
+        thread_pool_parallel_for(pool, groups, 0, batch_range, &job);
+        thread_pool_destroy(pool);
+    }
+    return atomic_load(&job.any_bad) ? GAUSSIAN_BAD_MATRIX : GAUSSIAN_SUCCESS;
+}
@@ -0,0 +1,530 @@
+#include "gaussian_eig.h"
+#include "gaussian_gemm.h"
+#include "gaussian_qr.h"
+#include "gaussian_simd.h"
+#include "thread_pool.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef GAUSSIAN_EIG_NB
+#define GAUSSIAN_EIG_NB 32            /* 三对角化面板行数 / 回代的反射块大小 */
+#endif
+#ifndef GAUSSIAN_EIG_TILE
+#define GAUSSIAN_EIG_TILE 128         /* 秩 2nb 更新在上三角上的行块 */
+#endif
+#define EIG_QL_MAX_ITER 60            /* 每个特征值的 QL 迭代上限 */
+#define EIG_INVIT_MAX_ITER 8          /* 三对角反迭代步数上限 */
+
+static double eig_dot(size_t n, const double *x, const double *y) {
+    double s = 0.0;
+    for (size_t i = 0; i < n; ++i) s += x[i] * y[i];
+    return s;
+}
+
+/* 对称矩阵-向量乘的一行（上三角部分）：返回 a . x，同时 y += xi * a；
+ * 三对角化的一半浮点运算在此，受内存带宽限制，点积用四路累加 */
+static double eig_symv_row(size_t r, const double *a, const double *x, double xi, double *y) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    size_t j = 0;
+    for (; j + 4 <= r; j += 4) {
+        s0 += a[j] * x[j];
+        s1 += a[j + 1] * x[j + 1];
+        s2 += a[j + 2] * x[j + 2];
+        s3 += a[j + 3] * x[j + 3];
+        y[j] += xi * a[j];
+        y[j + 1] += xi * a[j + 1];
+        y[j + 2] += xi * a[j + 2];
+        y[j + 3] += xi * a[j + 3];
+    }
+    for (; j < r; ++j) {
+        s0 += a[j] * x[j];
+        y[j] += xi * a[j];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+static unsigned long long eig_seed_next(unsigned long long *s) {
+    *s = *s * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *s;
+}
+static double eig_rand_unit(unsigned long long *s) {
+    return (double)(eig_seed_next(s) >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+}
+
+/* Householder：x（m 个）-> beta e_1，x[1..m) 改写为 v[1..m)（v[0] = 1），返回 beta */
+static double eig_reflector(size_t m, double *x, double *tau) {
+    double scale = 0.0, ssq = 0.0;
+    for (size_t i = 1; i < m; ++i)
+        if (fabs(x[i]) > scale) scale = fabs(x[i]);
+    if (scale > 0.0)
+        for (size_t i = 1; i < m; ++i) {
+            double t = x[i] / scale;
+            ssq += t * t;
+        }
+    const double xnorm = scale * sqrt(ssq), alpha = x[0];
+    if (xnorm == 0.0) { *tau = 0.0; return alpha; }
+    const double beta = -copysign(hypot(alpha, xnorm), alpha);
+    const double s = 1.0 / (alpha - beta);
+    *tau = (beta - alpha) / beta;
+    for (size_t i = 1; i < m; ++i) x[i] *= s;
+    return beta;
+}
+
+/* ------------------ 三对角化 ------------------ */
+/* 面板：行 k0..k0+kb 依次生成反射 v_j，并给出 w_j，使尾部 S 的真实值为
+ *   S_stored - sum_j (v_j w_j^T + w_j v_j^T)
+ * V、W 为 kb x n（行跨度 n，按全局列号存放） */
+static void eig_trd_panel(size_t n, double *A, size_t lda, size_t k0, size_t kb,
+                          double *d, double *e, double *tau, double *V, double *W) {
+    const GaussianKernels *K = gaussian_kernels();
+    for (size_t j = 0; j < kb; ++j) {
+        const size_t k = k0 + j, m = n - k - 1;
+        double *ak = &A[IDX(k,k,lda)];
+        /* 当前行补上面板内之前的秩 2 更新 */
+        for (size_t t = 0; t < j; ++t) {
+            K->axpy(n - k, V[IDX(t,k,n)], &W[IDX(t,k,n)], ak);
+            K->axpy(n - k, W[IDX(t,k,n)], &V[IDX(t,k,n)], ak);
+        }
+        d[k] = ak[0];
+        e[k] = eig_reflector(m, &ak[1], &tau[k]);
+        ak[1] = e[k];
+
+        double *v = &V[IDX(j,0,n)], *w = &W[IDX(j,0,n)];
+        v[k + 1] = 1.0;
+        memcpy(&v[k + 2], &ak[2], (m - 1) * sizeof(double));
+        memset(&w[k + 1], 0, m * sizeof(double));
+        if (tau[k] == 0.0) continue;
+
+        /* w = S v：按行扫描上三角，每行只读一遍 */
+        for (size_t i = k + 1; i < n; ++i) {
+            const double *ai = &A[IDX(i,i,lda)];
+            w[i] += ai[0] * v[i] + eig_symv_row(n - i - 1, &ai[1], &v[i + 1], v[i], &w[i + 1]);
+        }
+        for (size_t t = 0; t < j; ++t) {
+            const double a = eig_dot(m, &W[IDX(t,k+1,n)], &v[k + 1]);
+            const double b = eig_dot(m, &V[IDX(t,k+1,n)], &v[k + 1]);
+            K->axpy(m, a, &V[IDX(t,k+1,n)], &w[k + 1]);
+            K->axpy(m, b, &W[IDX(t,k+1,n)], &w[k + 1]);
+        }
+        /* w = tau S v - (tau^2 / 2)(v^T S v) v */
+        for (size_t i = k + 1; i < n; ++i) w[i] *= tau[k];
+        const double alpha = -0.5 * tau[k] * eig_dot(m, &w[k + 1], &v[k + 1]);
+        K->axpy(m, -alpha, &v[k + 1], &w[k + 1]);
+    }
+}
+
+static GAUSSIAN_Err eig_tridiagonalize_pool(size_t n, double *A, size_t lda, double *d,
+                                            double *e, double *tau, ThreadPool *pool) {
+    const size_t nb = GAUSSIAN_EIG_NB;
+    double *V = (double*)malloc(nb * n * sizeof(double));
+    double *W = (double*)malloc(nb * n * sizeof(double));
+    GAUSSIAN_Err ret = (V && W) ? GAUSSIAN_SUCCESS : GAUSSIAN_NO_MEMORY;
+    for (size_t k0 = 0; ret == GAUSSIAN_SUCCESS && k0 + 1 < n; k0 += nb) {
+        const size_t kb = (n - 1 - k0 < nb) ? n - 1 - k0 : nb;
+        eig_trd_panel(n, A, lda, k0, kb, d, e, tau, V, W);
+        /* 尾部上三角按行块做 S -= V^T W + W^T V（对角块的下三角部分一并更新，不再读取） */
+        for (size_t i0 = k0 + kb; ret == GAUSSIAN_SUCCESS && i0 < n; i0 += GAUSSIAN_EIG_TILE) {
+            const size_t ib = (n - i0 < GAUSSIAN_EIG_TILE) ? n - i0 : GAUSSIAN_EIG_TILE;
+            double *C = &A[IDX(i0,i0,lda)];
+            ret = gaussian_gemm_pool(GEMM_TRANS, GEMM_NO_TRANS, ib, n - i0, kb, -1.0, &V[i0], n,
+                                     &W[i0], n, 1.0, C, lda, pool);
+            if (ret == GAUSSIAN_SUCCESS)
+                ret = gaussian_gemm_pool(GEMM_TRANS, GEMM_NO_TRANS, ib, n - i0, kb, -1.0, &W[i0], n,
+                                         &V[i0], n, 1.0, C, lda, pool);
+        }
+    }
+    if (ret == GAUSSIAN_SUCCESS) d[n - 1] = A[IDX(n-1,n-1,lda)];
+    free(V); free(W);
+    return ret;
+}
+
+GAUSSIAN_Err sym_tridiagonalize(size_t n, double *A, size_t lda, double *d, double *e,
+                                double *tau, size_t nthreads) {
+    if (!A || !d || lda < n || (n > 1 && (!e || !tau))) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0) return GAUSSIAN_SUCCESS;
+    ThreadPool *pool = NULL;
+    if (nthreads != 1 && n > GAUSSIAN_EIG_TILE && !(pool = thread_pool_create(nthreads)))
+        return GAUSSIAN_NO_MEMORY;
+    GAUSSIAN_Err ret = eig_tridiagonalize_pool(n, A, lda, d, e, tau, pool);
+    thread_pool_destroy(pool);
+    return ret;
+}
+
+/* ------------------ 三对角特征值：隐式 QL ------------------ */
+static int eig_cmp_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+GAUSSIAN_Err sym_tridiag_eigvals(size_t n, double *d, double *e) {
+    if (!d || (n > 1 && !e)) return GAUSSIAN_INVALID_INPUT;
+    if (n <= 1) return GAUSSIAN_SUCCESS;
+    /* 工作副本 f：f[i] 连接 i 与 i+1，f[n-1] = 0 */
+    double *f = (double*)malloc(n * sizeof(double));
+    if (!f) return GAUSSIAN_NO_MEMORY;
+    memcpy(f, e, (n - 1) * sizeof(double));
+    f[n - 1] = 0.0;
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    for (size_t l = 0; l < n && ret == GAUSSIAN_SUCCESS; ++l) {
+        size_t iter = 0, m;
+        do {
+            for (m = l; m + 1 < n; ++m) {
+                double dd = fabs(d[m]) + fabs(d[m + 1]);
+                if (fabs(f[m]) <= DBL_EPSILON * dd) break;
+            }
+            if (m == l) break;
+            if (iter++ == EIG_QL_MAX_ITER) { ret = GAUSSIAN_NOT_CONVERGED; break; }
+            /* Wilkinson 位移 */
+            double g = (d[l + 1] - d[l]) / (2.0 * f[l]);
+            double r = hypot(g, 1.0);
+            g = d[m] - d[l] + f[l] / (g + copysign(r, g));
+            double s = 1.0, c = 1.0, p = 0.0;
+            size_t i;
+            int underflow = 0;
+            for (i = m; i-- > l;) {
+                double ff = s * f[i], b = c * f[i];
+                f[i + 1] = (r = hypot(ff, g));
+                if (r == 0.0) {
+                    d[i + 1] -= p;
+                    f[m] = 0.0;
+                    underflow = 1;
+                    break;
+                }
+                s = ff / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + 2.0 * c * b;
+                d[i + 1] = g + (p = s * r);
+                g = c * r - b;
+            }
+            if (underflow) continue;
+            d[l] -= p;
+            f[l] = g;
+            f[m] = 0.0;
+        } while (m != l);
+    }
+    free(f);
+    memset(e, 0, (n - 1) * sizeof(double));
+    qsort(d, n, sizeof(double), eig_cmp_double);
+    return ret;
+}
+
+/* ------------------ 三对角特征向量：反迭代 ------------------ */
+/* T - lambda I 的带部分选主元 LU（dgttrf 式）：dl / dd / du / du2 为 L 与 U 的三条带，
+ * swap[i] 标记第 i 步是否交换行；|u_ii| < pert 时以 pert 代替（反迭代需要的扰动） */
+static void eig_gttrf(size_t n, double *dl, double *dd, double *du, double *du2,
+                      unsigned char *swap, double pert) {
+    for (size_t i = 0; i + 1 < n; ++i) {
+        if (i + 2 < n) du2[i] = 0.0;
+        if (fabs(dd[i]) >= fabs(dl[i])) {
+            swap[i] = 0;
+            if (dd[i] != 0.0) {
+                double fact = dl[i] / dd[i];
+                dl[i] = fact;
+                dd[i + 1] -= fact * du[i];
+            }
+        } else {
+            double fact = dd[i] / dl[i], temp = du[i];
+            swap[i] = 1;
+            dd[i] = dl[i];
+            dl[i] = fact;
+            du[i] = dd[i + 1];
+            dd[i + 1] = temp - fact * dd[i + 1];
+            if (i + 2 < n) {
+                du2[i] = du[i + 1];
+                du[i + 1] = -fact * du[i + 1];
+            }
+        }
+    }
+    for (size_t i = 0; i < n; ++i)
+        if (fabs(dd[i]) < pert) dd[i] = dd[i] < 0.0 ? -pert : pert;
+}
+
+static void eig_gttrs(size_t n, const double *dl, const double *dd, const double *du,
+                      const double *du2, const unsigned char *swap, double *x) {
+    for (size_t i = 0; i + 1 < n; ++i) {
+        if (!swap[i]) {
+            x[i + 1] -= dl[i] * x[i];
+        } else {
+            double t = x[i];
+            x[i] = x[i + 1];
+            x[i + 1] = t - dl[i] * x[i];
+        }
+    }
+    x[n - 1] /= dd[n - 1];
+    if (n > 1) x[n - 2] = (x[n - 2] - du[n - 2] * x[n - 1]) / dd[n - 2];
+    for (size_t i = n - 2; i-- > 0;)
+        x[i] = (x[i] - du[i] * x[i + 1] - du2[i] * x[i + 2]) / dd[i];
+}
+
+GAUSSIAN_Err sym_tridiag_eigvecs(size_t n, const double *d, const double *e,
+                                 size_t k, const double *w, double *Z, size_t ldz) {
+    if (!d || !w || !Z || ldz < n || (n > 1 && !e)) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0 || k == 0) return GAUSSIAN_SUCCESS;
+    if (n == 1) {
+        for (size_t j = 0; j < k; ++j) Z[IDX(j,0,ldz)] = 1.0;
+        return GAUSSIAN_SUCCESS;
+    }
+    double tnorm = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double r = fabs(d[i]) + (i > 0 ? fabs(e[i - 1]) : 0.0) + (i + 1 < n ? fabs(e[i]) : 0.0);
+        if (r > tnorm) tnorm = r;
+    }
+    if (tnorm == 0.0) tnorm = DBL_MIN;
+    const double pert = DBL_EPSILON * tnorm, ortol = 1e-3 * tnorm;
+    const double tolres = (double)(n + 10) * DBL_EPSILON * tnorm;
+
+    double *work = (double*)malloc(5 * n * sizeof(double));
+    unsigned char *swap = (unsigned char*)malloc(n);
+    if (!work || !swap) { free(work); free(swap); return GAUSSIAN_NO_MEMORY; }
+    double *dl = work, *dd = work + n, *du = work + 2 * n, *du2 = work + 3 * n, *x = work + 4 * n;
+    unsigned long long seed = 0x853C49E6748FEA9BULL;
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    size_t c0 = 0;
+    double lam_prev = 0.0;
+    for (size_t j = 0; j < k; ++j) {
+        /* 成簇：与前一个相距不超过 ortol；簇内相同的特征值稍作分离 */
+        double lam = w[j];
+        if (j == 0 || fabs(lam - w[j - 1]) > ortol) c0 = j;
+        else if (lam - lam_prev < 10.0 * pert) lam = lam_prev + 10.0 * pert;
+        lam_prev = lam;
+
+        for (size_t i = 0; i < n; ++i) {
+            dd[i] = d[i] - lam;
+            if (i + 1 < n) dl[i] = du[i] = e[i];
+        }
+        eig_gttrf(n, dl, dd, du, du2, swap, pert);
+        for (size_t i = 0; i < n; ++i) x[i] = eig_rand_unit(&seed);
+
+        int converged = 0, extra = 0;
+        for (size_t it = 0; it < EIG_INVIT_MAX_ITER && !converged; ++it) {
+            eig_gttrs(n, dl, dd, du, du2, swap, x);
+            for (size_t q = c0; q < j; ++q) {
+                const double *zq = &Z[IDX(q,0,ldz)];
+                const double s = eig_dot(n, zq, x);
+                for (size_t i = 0; i < n; ++i) x[i] -= s * zq[i];
+            }
+            double nrm = sqrt(eig_dot(n, x, x));
+            if (nrm == 0.0) {
+                for (size_t i = 0; i < n; ++i) x[i] = eig_rand_unit(&seed);
+                continue;
+            }
+            for (size_t i = 0; i < n; ++i) x[i] /= nrm;
+            /* 残差 ||T x - w_j x||_inf；达标后再多迭代一步 */
+            double res = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                double r = (d[i] - w[j]) * x[i];
+                if (i > 0) r += e[i - 1] * x[i - 1];
+                if (i + 1 < n) r += e[i] * x[i + 1];
+                if (fabs(r) > res) res = fabs(r);
+            }
+            if (res <= tolres && extra++ >= 1) converged = 1;
+        }
+        if (!converged) ret = GAUSSIAN_NOT_CONVERGED;
+        memcpy(&Z[IDX(j,0,ldz)], x, n * sizeof(double));
+    }
+    free(work); free(swap);
+    return ret;
+}
+
+/* ------------------ 回代 ------------------ */
+/* Z（k x n，行为 T 的特征向量）<- Z Q^T = Z H_{n-2} ... H_0：反射块自后向前，
+ * 每块 B = I - V T V^T，z B^T = z - ((z V^T) T^T) V */
+static GAUSSIAN_Err eig_backtransform(size_t n, const double *A, size_t lda, const double *tau,
+                                      size_t k, double *Z, size_t ldz, ThreadPool *pool) {
+    const size_t nb = GAUSSIAN_EIG_NB;
+    double *Vr = (double*)malloc(nb * n * sizeof(double));
+    double *T = (double*)malloc(nb * nb * sizeof(double));
+    double *G = (double*)malloc(nb * nb * sizeof(double));
+    double *M = (double*)malloc(2 * k * nb * sizeof(double));
+    GAUSSIAN_Err ret = (Vr && T && G && M) ? GAUSSIAN_SUCCESS : GAUSSIAN_NO_MEMORY;
+    const size_t nblk = (n - 1 + nb - 1) / nb;
+    for (size_t b = nblk; b-- > 0 && ret == GAUSSIAN_SUCCESS;) {
+        const size_t r0 = b * nb, rb = (n - 1 - r0 < nb) ? n - 1 - r0 : nb;
+        const size_t c0 = r0 + 1, wd = n - c0;
+        for (size_t t = 0; t < rb; ++t) {
+            const size_t r = r0 + t;
+            double *v = &Vr[IDX(t,0,wd)];
+            memset(v, 0, (r + 1 - c0) * sizeof(double));
+            v[r + 1 - c0] = 1.0;
+            memcpy(&v[r + 2 - c0], &A[IDX(r,r+2,lda)], (n - r - 2) * sizeof(double));
+        }
+        ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_TRANS, rb, rb, wd, 1.0, Vr, wd, Vr, wd,
+                                 0.0, G, rb, pool);
+        if (ret != GAUSSIAN_SUCCESS) break;
+        memset(T, 0, rb * rb * sizeof(double));
+        for (size_t c = 0; c < rb; ++c) {
+            T[IDX(c,c,rb)] = tau[r0 + c];
+            for (size_t r = 0; r < c; ++r) {
+                double s = 0.0;
+                for (size_t q = r; q < c; ++q) s += T[IDX(r,q,rb)] * G[IDX(q,c,rb)];
+                T[IDX(r,c,rb)] = -tau[r0 + c] * s;
+            }
+        }
+        double *M1 = M, *M2 = M + k * nb;
+        ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_TRANS, k, rb, wd, 1.0, &Z[c0], ldz, Vr, wd,
+                                 0.0, M1, rb, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_TRANS, k, rb, rb, 1.0, M1, rb, T, rb,
+                                     0.0, M2, rb, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, k, wd, rb, -1.0, M2, rb, Vr, wd,
+                                     1.0, &Z[c0], ldz, pool);
+    }
+    free(Vr); free(T); free(G); free(M);
+    return ret;
+}
+
+GAUSSIAN_Err sym_eig(size_t n, double *A, size_t lda, double *w,
+                     size_t il, size_t iu, double *Z, size_t ldz, size_t nthreads) {
+    if (!A || !w || lda < n) return GAUSSIAN_INVALID_INPUT;
+    if (Z && (il > iu || iu >= n || ldz < n)) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0) return GAUSSIAN_SUCCESS;
+    double *work = (double*)malloc(4 * n * sizeof(double));
+    ThreadPool *pool = NULL;
+    if (!work) return GAUSSIAN_NO_MEMORY;
+    if (nthreads != 1 && n > GAUSSIAN_EIG_TILE && !(pool = thread_pool_create(nthreads))) {
+        free(work);
+        return GAUSSIAN_NO_MEMORY;
+    }
+    double *e = work, *tau = work + n, *d0 = work + 2 * n, *e0 = work + 3 * n;
+    GAUSSIAN_Err ret = eig_tridiagonalize_pool(n, A, lda, w, e, tau, pool);
+    if (ret == GAUSSIAN_SUCCESS && Z) {
+        memcpy(d0, w, n * sizeof(double));
+        memcpy(e0, e, (n - 1) * sizeof(double));
+    }
+    if (ret == GAUSSIAN_SUCCESS) ret = sym_tridiag_eigvals(n, w, e);
+    if (ret == GAUSSIAN_SUCCESS && Z) {
+        const size_t k = iu - il + 1;
+        ret = sym_tridiag_eigvecs(n, d0, e0, k, &w[il], Z, ldz);
+        /* 反迭代未完全收敛时仍回代，返回 GAUSSIAN_NOT_CONVERGED */
+        if (ret == GAUSSIAN_SUCCESS || ret == GAUSSIAN_NOT_CONVERGED) {
+            GAUSSIAN_Err bt = n > 1 ? eig_backtransform(n, A, lda, tau, k, Z, ldz, pool)
+                                    : GAUSSIAN_SUCCESS;
+            if (bt != GAUSSIAN_SUCCESS) ret = bt;
+        }
+    }
+    thread_pool_destroy(pool);
+    free(work);
+    return ret;
+}
+
+/* ------------------ 移位求逆块反迭代 ------------------ */
+void eig_shift_options_default(EigShiftOptions *opts) {
+    if (!opts) return;
+    opts->max_iter = 200;
+    opts->tol = 0.0;
+    opts->nthreads = 0;
+}
+
+typedef struct {
+    double dist;
+    size_t idx;
+} EigOrder;
+
+static int eig_cmp_order(const void *a, const void *b) {
+    const EigOrder *x = (const EigOrder*)a, *y = (const EigOrder*)b;
+    if (x->dist != y->dist) return x->dist < y->dist ? -1 : 1;
+    return (x->idx > y->idx) - (x->idx < y->idx);
+}
+
+GAUSSIAN_Err eig_shift_invert(size_t n, const double *A, size_t lda, double sigma, size_t k,
+                              double *lambda, double *X, size_t ldx,
+                              const EigShiftOptions *opts, EigShiftStatus *status) {
+    EigShiftOptions o;
+    if (opts) o = *opts; else eig_shift_options_default(&o);
+    if (!A || !lambda || !X || k == 0 || k > n || lda < n || ldx < n || !(o.tol >= 0.0)
+        || o.max_iter == 0)
+        return GAUSSIAN_INVALID_INPUT;
+    const double tol = o.tol > 0.0 ? o.tol : 16.0 * sqrt((double)n) * DBL_EPSILON;
+    const size_t p = (2 * k > k + 2 ? 2 * k : k + 2) < n ? (2 * k > k + 2 ? 2 * k : k + 2) : n;
+    if (status) { status->iterations = 0; status->residual = INFINITY; }
+
+    double *LU = (double*)malloc(n * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    double *blk = (double*)malloc(4 * n * p * sizeof(double));
+    double *small = (double*)malloc((2 * p * p + 2 * p) * sizeof(double));
+    EigOrder *ord = (EigOrder*)malloc(p * sizeof(EigOrder));
+    /* 整个迭代共用一个线程池（QR 与 GEMM 每步都要用） */
+    ThreadPool *pool = NULL;
+    GAUSSIAN_Err ret = GAUSSIAN_NO_MEMORY;
+    if (!LU || !piv || !blk || !small || !ord) goto cleanup;
+    if (o.nthreads != 1 && !(pool = thread_pool_create(o.nthreads))) goto cleanup;
+    double *Q = blk, *Y = blk + n * p, *AQ = blk + 2 * n * p, *R = blk + 3 * n * p;
+    double *H = small, *S = small + p * p, *theta = small + 2 * p * p, *tau = theta + p;
+
+    /* (A - sigma I) 只分解一次（分块 LU） */
+    for (size_t i = 0; i < n; ++i) {
+        memcpy(&LU[IDX(i,0,n)], &A[IDX(i,0,lda)], n * sizeof(double));
+        LU[IDX(i,i,n)] -= sigma;
+    }
+    ret = lu_decompose_blocked(n, LU, n, piv);
+    if (ret != GAUSSIAN_SUCCESS) goto cleanup;
+    double anorm = mat_norm1(n, A, lda);
+    if (anorm == 0.0) anorm = 1.0;
+
+    unsigned long long seed = 0x2545F4914F6CDD1DULL;
+    for (size_t i = 0; i < n * p; ++i) Q[i] = eig_rand_unit(&seed);
+    double res = INFINITY;
+    size_t it = 0;
+    while (it < o.max_iter) {
+        ++it;
+        /* Y = (A - sigma I)^{-1} X，正交化为 Q（n x p，列为基向量） */
+        ret = lu_solve_multi(n, LU, n, piv, p, Q, p, Y, p);
+        if (ret == GAUSSIAN_SUCCESS) ret = qr_decompose_pool(n, p, Y, p, tau, pool);
+        if (ret == GAUSSIAN_SUCCESS) ret = qr_form_q_pool(n, p, Y, p, tau, Q, p, pool);
+        /* Rayleigh-Ritz：H = Q^T A Q（对称化），H = S^T diag(theta) S */
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, n, p, n, 1.0, A, lda, Q, p,
+                                     0.0, AQ, p, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_TRANS, GEMM_NO_TRANS, p, p, n, 1.0, Q, p, AQ, p,
+                                     0.0, H, p, NULL);
+        if (ret != GAUSSIAN_SUCCESS) break;
+        for (size_t i = 0; i < p; ++i)
+            for (size_t j = i + 1; j < p; ++j)
+                H[IDX(i,j,p)] = 0.5 * (H[IDX(i,j,p)] + H[IDX(j,i,p)]);
+        ret = sym_eig(p, H, p, theta, 0, p - 1, S, p, 1);
+        /* Ritz 向量 Y = Q S^T 与 A Y = (A Q) S^T */
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_TRANS, n, p, p, 1.0, Q, p, S, p,
+                                     0.0, Y, p, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_TRANS, n, p, p, 1.0, AQ, p, S, p,
+                                     0.0, R, p, pool);
+        if (ret != GAUSSIAN_SUCCESS) break;
+
+        /* 按 |theta - sigma| 排序，重排后的 Ritz 向量作为下一步的起始块 */
+        for (size_t c = 0; c < p; ++c) { ord[c].dist = fabs(theta[c] - sigma); ord[c].idx = c; }
+        qsort(ord, p, sizeof(EigOrder), eig_cmp_order);
+        for (size_t i = 0; i < n; ++i)
+            for (size_t c = 0; c < p; ++c) Q[IDX(i,c,p)] = Y[IDX(i,ord[c].idx,p)];
+        res = 0.0;
+        for (size_t c = 0; c < k; ++c) {
+            const size_t j = ord[c].idx;
+            double s = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                double r = R[IDX(i,j,p)] - theta[j] * Y[IDX(i,j,p)];
+                s += r * r;
+            }
+            if (sqrt(s) / anorm > res) res = sqrt(s) / anorm;
+        }
+        if (res <= tol) break;
+    }
+    if (ret == GAUSSIAN_SUCCESS) {
+        for (size_t c = 0; c < k; ++c) {
+            lambda[c] = theta[ord[c].idx];
+            for (size_t i = 0; i < n; ++i) X[IDX(c,i,ldx)] = Q[IDX(i,c,p)];
+        }
+        if (res > tol) ret = GAUSSIAN_NOT_CONVERGED;
+    }
+    if (status) { status->iterations = it; status->residual = res; }
+
+cleanup:
+    thread_pool_destroy(pool);
+    free(LU); free(piv); free(blk); free(small); free(ord);
+    return ret;
+}
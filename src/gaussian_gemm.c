@@ -0,0 +1,350 @@
+#include "gaussian_gemm.h"
+#include "gaussian_simd.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef GAUSSIAN_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/* ------------------ 微核：C(MR x NR) += Ap * Bp ------------------
+ * Ap：kc 列，每列 MR 个连续元素（a[p*MR + i]）；Bp：kc 行，每行 NR 个连续元素。
+ * 累加器全程驻留寄存器，每步 p 只读 MR + NR 个元素，做 MR * NR 次乘加 */
+typedef void (*GemmMicroFn)(size_t kc, const double *a, const double *b, double *c, size_t ldc);
+
+typedef struct GemmKernel {
+    size_t mr, nr;
+    size_t kc, mc, nc;      /* KC x NR 的 B 面板驻留 L1，MC x KC 的 A 块驻留 L2 */
+    GemmMicroFn fn;
+} GemmKernel;
+
+#define GEMM_MR_MAX 8
+#define GEMM_NR_MAX 16
+
+static void gemm_micro_scalar(size_t kc, const double *a, const double *b,
+                              double *c, size_t ldc) {
+    double t[4][4] = {{0}};
+    for (size_t p = 0; p < kc; ++p, a += 4, b += 4)
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t j = 0; j < 4; ++j)
+                t[i][j] += a[i] * b[j];
+    for (size_t i = 0; i < 4; ++i)
+        for (size_t j = 0; j < 4; ++j)
+            c[IDX(i,j,ldc)] += t[i][j];
+}
+
+#ifdef GAUSSIAN_SIMD_X86
+/* 6 x 8：12 个 ymm 累加器 + 2 个 B + 1 个广播 */
+GAUSSIAN_TARGET_AVX2
+static void gemm_micro_avx2(size_t kc, const double *a, const double *b,
+                            double *c, size_t ldc) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+    for (size_t p = 0; p < kc; ++p, a += 6, b += 8) {
+        __m256d b0 = _mm256_loadu_pd(b), b1 = _mm256_loadu_pd(b + 4);
+        __m256d t;
+        t = _mm256_broadcast_sd(a + 0);
+        c00 = _mm256_fmadd_pd(t, b0, c00); c01 = _mm256_fmadd_pd(t, b1, c01);
+        t = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(t, b0, c10); c11 = _mm256_fmadd_pd(t, b1, c11);
+        t = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(t, b0, c20); c21 = _mm256_fmadd_pd(t, b1, c21);
+        t = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(t, b0, c30); c31 = _mm256_fmadd_pd(t, b1, c31);
+        t = _mm256_broadcast_sd(a + 4);
+        c40 = _mm256_fmadd_pd(t, b0, c40); c41 = _mm256_fmadd_pd(t, b1, c41);
+        t = _mm256_broadcast_sd(a + 5);
+        c50 = _mm256_fmadd_pd(t, b0, c50); c51 = _mm256_fmadd_pd(t, b1, c51);
+    }
+#define GEMM_STORE_ROW_AVX2(r, x0, x1) do { \
+        double *cr = c + (r) * ldc; \
+        _mm256_storeu_pd(cr, _mm256_add_pd(_mm256_loadu_pd(cr), x0)); \
+        _mm256_storeu_pd(cr + 4, _mm256_add_pd(_mm256_loadu_pd(cr + 4), x1)); \
+    } while (0)
+    GEMM_STORE_ROW_AVX2(0, c00, c01);
+    GEMM_STORE_ROW_AVX2(1, c10, c11);
+    GEMM_STORE_ROW_AVX2(2, c20, c21);
+    GEMM_STORE_ROW_AVX2(3, c30, c31);
+    GEMM_STORE_ROW_AVX2(4, c40, c41);
+    GEMM_STORE_ROW_AVX2(5, c50, c51);
+#undef GEMM_STORE_ROW_AVX2
+}
+
+/* 8 x 16：16 个 zmm 累加器，每步 2 次 B 读 + 8 次广播对 16 次 FMA */
+GAUSSIAN_TARGET_AVX512
+static void gemm_micro_avx512(size_t kc, const double *a, const double *b,
+                              double *c, size_t ldc) {
+    __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+    __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+    __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+    __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+    __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+    __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+    __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd();
+    __m512d c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+    for (size_t p = 0; p < kc; ++p, a += 8, b += 16) {
+        __m512d b0 = _mm512_loadu_pd(b), b1 = _mm512_loadu_pd(b + 8);
+        __m512d t;
+        t = _mm512_set1_pd(a[0]);
+        c00 = _mm512_fmadd_pd(t, b0, c00); c01 = _mm512_fmadd_pd(t, b1, c01);
+        t = _mm512_set1_pd(a[1]);
+        c10 = _mm512_fmadd_pd(t, b0, c10); c11 = _mm512_fmadd_pd(t, b1, c11);
+        t = _mm512_set1_pd(a[2]);
+        c20 = _mm512_fmadd_pd(t, b0, c20); c21 = _mm512_fmadd_pd(t, b1, c21);
+        t = _mm512_set1_pd(a[3]);
+        c30 = _mm512_fmadd_pd(t, b0, c30); c31 = _mm512_fmadd_pd(t, b1, c31);
+        t = _mm512_set1_pd(a[4]);
+        c40 = _mm512_fmadd_pd(t, b0, c40); c41 = _mm512_fmadd_pd(t, b1, c41);
+        t = _mm512_set1_pd(a[5]);
+        c50 = _mm512_fmadd_pd(t, b0, c50); c51 = _mm512_fmadd_pd(t, b1, c51);
+        t = _mm512_set1_pd(a[6]);
+        c60 = _mm512_fmadd_pd(t, b0, c60); c61 = _mm512_fmadd_pd(t, b1, c61);
+        t = _mm512_set1_pd(a[7]);
+        c70 = _mm512_fmadd_pd(t, b0, c70); c71 = _mm512_fmadd_pd(t, b1, c71);
+    }
+#define GEMM_STORE_ROW_AVX512(r, x0, x1) do { \
+        double *cr = c + (r) * ldc; \
+        _mm512_storeu_pd(cr, _mm512_add_pd(_mm512_loadu_pd(cr), x0)); \
+        _mm512_storeu_pd(cr + 8, _mm512_add_pd(_mm512_loadu_pd(cr + 8), x1)); \
+    } while (0)
+    GEMM_STORE_ROW_AVX512(0, c00, c01);
+    GEMM_STORE_ROW_AVX512(1, c10, c11);
+    GEMM_STORE_ROW_AVX512(2, c20, c21);
+    GEMM_STORE_ROW_AVX512(3, c30, c31);
+    GEMM_STORE_ROW_AVX512(4, c40, c41);
+    GEMM_STORE_ROW_AVX512(5, c50, c51);
+    GEMM_STORE_ROW_AVX512(6, c60, c61);
+    GEMM_STORE_ROW_AVX512(7, c70, c71);
+#undef GEMM_STORE_ROW_AVX512
+}
+#endif
+
+static const GemmKernel *gemm_kernel(void) {
+    static const GemmKernel scalar = { 4, 4, 256, 128, 2048, gemm_micro_scalar };
+#ifdef GAUSSIAN_SIMD_X86
+    static const GemmKernel avx2 = { 6, 8, 256, 96, 2048, gemm_micro_avx2 };
+    static const GemmKernel avx512 = { 8, 16, 384, 64, 2048, gemm_micro_avx512 };
+    switch (gaussian_kernels()->level) {
+    case GAUSSIAN_SIMD_AVX512: return &avx512;
+    case GAUSSIAN_SIMD_AVX2: return &avx2;
+    default: break;
+    }
+#endif
+    return &scalar;
+}
+
+/* ------------------ 打包 ------------------ */
+/* op(A)[i0 .. i0+mc, p0 .. p0+kc) * alpha -> MR 行一条的面板，不足 MR 的尾条补零 */
+static void gemm_pack_a(GemmTrans ta, size_t mc, size_t kc, double alpha,
+                        const double *A, size_t lda, size_t i0, size_t p0,
+                        size_t mr, double *Ap) {
+    for (size_t ir = 0; ir < mc; ir += mr) {
+        size_t mb = (mc - ir < mr) ? mc - ir : mr;
+        double *dst = Ap + ir * kc;
+        if (ta == GEMM_NO_TRANS) {
+            for (size_t i = 0; i < mb; ++i) {
+                const double *src = &A[IDX(i0 + ir + i, p0, lda)];
+                for (size_t p = 0; p < kc; ++p) dst[p * mr + i] = alpha * src[p];
+            }
+        } else {
+            for (size_t p = 0; p < kc; ++p) {
+                const double *src = &A[IDX(p0 + p, i0 + ir, lda)];
+                for (size_t i = 0; i < mb; ++i) dst[p * mr + i] = alpha * src[i];
+            }
+        }
+        if (mb < mr)
+            for (size_t p = 0; p < kc; ++p)
+                for (size_t i = mb; i < mr; ++i) dst[p * mr + i] = 0.0;
+    }
+}
+
+/* op(B)[p0 .. p0+kc, j0+jr .. ) 的一条 NR 列面板，不足 NR 列补零 */
+static void gemm_pack_b_panel(GemmTrans tb, size_t kc, size_t nb,
+                              const double *B, size_t ldb, size_t p0, size_t j0,
+                              size_t nr, double *dst) {
+    if (tb == GEMM_NO_TRANS) {
+        for (size_t p = 0; p < kc; ++p) {
+            const double *src = &B[IDX(p0 + p, j0, ldb)];
+            double *d = dst + p * nr;
+            memcpy(d, src, nb * sizeof(double));
+            for (size_t j = nb; j < nr; ++j) d[j] = 0.0;
+        }
+    } else {
+        for (size_t j = 0; j < nb; ++j) {
+            const double *src = &B[IDX(j0 + j, p0, ldb)];
+            for (size_t p = 0; p < kc; ++p) dst[p * nr + j] = src[p];
+        }
+        if (nb < nr)
+            for (size_t p = 0; p < kc; ++p)
+                for (size_t j = nb; j < nr; ++j) dst[p * nr + j] = 0.0;
+    }
+}
+
+/* ------------------ 一个 (jc, pc) 块上的并行工作 ------------------ */
+typedef struct GemmJob {
+    const GemmKernel *K;
+    GemmTrans ta, tb;
+    double alpha;
+    const double *A, *B;
+    size_t lda, ldb, ldc;
+    double *C;
+    size_t m, jc, nc, pc, kc;
+    double *Bp;
+    double *Ap;             /* 每个工作线程 ap_stride 个 double */
+    size_t ap_stride;
+    size_t mblocks, nseg, seg;  /* 工作单元 = 行块 x 列段，seg 为 NR 的倍数 */
+    atomic_size_t next;
+} GemmJob;
+
+static void gemm_pack_b_range(void *ctx, size_t begin, size_t end) {
+    GemmJob *job = (GemmJob*)ctx;
+    size_t nr = job->K->nr;
+    for (size_t q = begin; q < end; ++q) {
+        size_t jr = q * nr;
+        size_t nb = (job->nc - jr < nr) ? job->nc - jr : nr;
+        gemm_pack_b_panel(job->tb, job->kc, nb, job->B, job->ldb, job->pc, job->jc + jr,
+                          nr, job->Bp + jr * job->kc);
+    }
+}
+
+static void gemm_macro_worker(void *ctx, size_t worker) {
+    GemmJob *job = (GemmJob*)ctx;
+    const GemmKernel *K = job->K;
+    const size_t mr = K->mr, nr = K->nr, kc = job->kc;
+    double *Ap = job->Ap + worker * job->ap_stride;
+    size_t packed = (size_t)-1;
+    double tile[GEMM_MR_MAX * GEMM_NR_MAX];
+
+    for (;;) {
+        size_t u = atomic_fetch_add(&job->next, 1);
+        if (u >= job->mblocks * job->nseg) break;
+        size_t ib = u / job->nseg, s = u % job->nseg;
+        size_t ic = ib * K->mc;
+        size_t mc = (job->m - ic < K->mc) ? job->m - ic : K->mc;
+        size_t js = s * job->seg;
+        size_t je = (job->nc - js < job->seg) ? job->nc : js + job->seg;
+
+        if (packed != ib) {
+            gemm_pack_a(job->ta, mc, kc, job->alpha, job->A, job->lda, ic, job->pc, mr, Ap);
+            packed = ib;
+        }
+        for (size_t jr = js; jr < je; jr += nr) {
+            size_t nb = (je - jr < nr) ? je - jr : nr;
+            const double *bp = job->Bp + jr * kc;
+            for (size_t ir = 0; ir < mc; ir += mr) {
+                size_t mb = (mc - ir < mr) ? mc - ir : mr;
+                double *c = &job->C[IDX(ic + ir, job->jc + jr, job->ldc)];
+                if (mb == mr && nb == nr) {
+                    K->fn(kc, Ap + ir * kc, bp, c, job->ldc);
+                } else {
+                    memset(tile, 0, mr * nr * sizeof(double));
+                    K->fn(kc, Ap + ir * kc, bp, tile, nr);
+                    for (size_t i = 0; i < mb; ++i)
+                        for (size_t j = 0; j < nb; ++j)
+                            c[IDX(i,j,job->ldc)] += tile[IDX(i,j,nr)];
+                }
+            }
+        }
+    }
+}
+
+static void gemm_scale(size_t m, size_t n, double beta, double *C, size_t ldc) {
+    if (beta == 1.0) return;
+    for (size_t i = 0; i < m; ++i) {
+        double *c = &C[IDX(i,0,ldc)];
+        if (beta == 0.0) memset(c, 0, n * sizeof(double));
+        else for (size_t j = 0; j < n; ++j) c[j] *= beta;
+    }
+}
+
+#ifndef GAUSSIAN_GEMM_MT_FLOPS
+#define GAUSSIAN_GEMM_MT_FLOPS (1u << 21)   /* m*n*k 低于此值时单线程更快 */
+#endif
+
+GAUSSIAN_Err gaussian_gemm_pool(GemmTrans ta, GemmTrans tb, size_t m, size_t n, size_t k,
+                                double alpha, const double *A, size_t lda,
+                                const double *B, size_t ldb,
+                                double beta, double *C, size_t ldc, ThreadPool *pool) {
+    if (m == 0 || n == 0) return GAUSSIAN_SUCCESS;
+    if (!C || ldc < n) return GAUSSIAN_INVALID_INPUT;
+    if (k > 0 && alpha != 0.0) {
+        if (!A || !B) return GAUSSIAN_INVALID_INPUT;
+        if (lda < (ta == GEMM_NO_TRANS ? k : m)) return GAUSSIAN_INVALID_INPUT;
+        if (ldb < (tb == GEMM_NO_TRANS ? n : k)) return GAUSSIAN_INVALID_INPUT;
+    }
+
+    gemm_scale(m, n, beta, C, ldc);
+    if (k == 0 || alpha == 0.0) return GAUSSIAN_SUCCESS;
+    if ((double)m * (double)n * (double)k < GAUSSIAN_GEMM_MT_FLOPS) pool = NULL;
+
+    const GemmKernel *K = gemm_kernel();
+    const size_t nt = thread_pool_size(pool);
+    const size_t kcmax = (k < K->kc) ? k : K->kc;
+    const size_t ncmax = (n < K->nc) ? n : K->nc;
+    const size_t mcmax = (m < K->mc) ? m : K->mc;
+    const size_t ncpad = (ncmax + K->nr - 1) / K->nr * K->nr;
+    const size_t mcpad = (mcmax + K->mr - 1) / K->mr * K->mr;
+
+    double *Bp = (double*)malloc(kcmax * ncpad * sizeof(double));
+    double *Ap = (double*)malloc(nt * mcpad * kcmax * sizeof(double));
+    if (!Bp || !Ap) { free(Bp); free(Ap); return GAUSSIAN_NO_MEMORY; }
+
+    GemmJob job;
+    job.K = K;
+    job.ta = ta; job.tb = tb;
+    job.alpha = alpha;
+    job.A = A; job.B = B; job.C = C;
+    job.lda = lda; job.ldb = ldb; job.ldc = ldc;
+    job.m = m;
+    job.Bp = Bp; job.Ap = Ap;
+    job.ap_stride = mcpad * kcmax;
+    job.mblocks = (m + K->mc - 1) / K->mc;
+
+    for (size_t jc = 0; jc < n; jc += K->nc) {
+        size_t nc = (n - jc < K->nc) ? n - jc : K->nc;
+        size_t npanel = (nc + K->nr - 1) / K->nr;
+        /* 行块少于线程数时再把列切成段，使每个线程都有工作 */
+        size_t nseg = 1;
+        if (job.mblocks < nt) {
+            nseg = (nt + job.mblocks - 1) / job.mblocks;
+            if (nseg > npanel) nseg = npanel;
+        }
+        job.jc = jc; job.nc = nc;
+        job.nseg = nseg;
+        job.seg = (npanel + nseg - 1) / nseg * K->nr;
+        job.nseg = (nc + job.seg - 1) / job.seg;
+
+        for (size_t pc = 0; pc < k; pc += K->kc) {
+            job.pc = pc;
+            job.kc = (k - pc < K->kc) ? k - pc : K->kc;
+            thread_pool_parallel_for(pool, npanel, 0, gemm_pack_b_range, &job);
+            atomic_init(&job.next, 0);
+            thread_pool_run(pool, gemm_macro_worker, &job);
+        }
+    }
+
+    free(Bp);
+    free(Ap);
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err gaussian_gemm(GemmTrans ta, GemmTrans tb, size_t m, size_t n, size_t k,
+                           double alpha, const double *A, size_t lda,
+                           const double *B, size_t ldb,
+                           double beta, double *C, size_t ldc, size_t nthreads) {
+    ThreadPool *pool = NULL;
+    if (nthreads != 1 && (double)m * (double)n * (double)k >= GAUSSIAN_GEMM_MT_FLOPS) {
+        pool = thread_pool_create(nthreads);
+        if (!pool) return GAUSSIAN_NO_MEMORY;
+    }
+    GAUSSIAN_Err ret = gaussian_gemm_pool(ta, tb, m, n, k, alpha, A, lda, B, ldb,
+                                          beta, C, ldc, pool);
+    thread_pool_destroy(pool);
+    return ret;
+}
@@ -0,0 +1,169 @@
+#include "gaussian_matfile.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define GMAT_MAGIC "GAUSMAT1"
+#define GMAT_HEADER 64
+#define GMAT_BOM 0x01020304u
+#define GMAT_DEFAULT_ALIGN 64
+#define GMAT_MAX_ALIGN 4096
+
+typedef struct {
+    char magic[8];
+    uint32_t bom, dtype;
+    uint64_t rows, cols, lda, align, offset;
+    unsigned char reserved[GMAT_HEADER - 56];
+} GMatHeader;
+
+static size_t gmat_esize(GMatDtype dtype) {
+    switch (dtype) {
+    case GMAT_F64: return sizeof(double);
+    case GMAT_F32: return sizeof(float);
+    default: return 0;
+    }
+}
+
+static int gmat_align_ok(size_t align, size_t esize) {
+    return esize && align >= esize && align <= GMAT_MAX_ALIGN && (align & (align - 1)) == 0;
+}
+
+static size_t gmat_round_up(size_t x, size_t a) { return (x + a - 1) / a * a; }
+
+size_t gmat_aligned_lda(size_t cols, GMatDtype dtype, size_t align) {
+    size_t es = gmat_esize(dtype);
+    if (align == 0) align = GMAT_DEFAULT_ALIGN;
+    if (!gmat_align_ok(align, es) || cols > SIZE_MAX / es - align) return 0;
+    return gmat_round_up(cols, align / es);
+}
+
+GAUSSIAN_Err gmat_write(const char *path, size_t rows, size_t cols, const double *A, size_t lda,
+                        GMatDtype dtype, size_t align) {
+    if (align == 0) align = GMAT_DEFAULT_ALIGN;
+    const size_t es = gmat_esize(dtype), ldo = gmat_aligned_lda(cols, dtype, align);
+    if (!path || !A || rows == 0 || cols == 0 || lda < cols || ldo == 0)
+        return GAUSSIAN_INVALID_INPUT;
+
+    GMatHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, GMAT_MAGIC, 8);
+    h.bom = GMAT_BOM;
+    h.dtype = (uint32_t)dtype;
+    h.rows = rows; h.cols = cols; h.lda = ldo;
+    h.align = align;
+    h.offset = gmat_round_up(GMAT_HEADER, align);
+
+    unsigned char *row = (unsigned char*)calloc(ldo, es);
+    FILE *fp = row ? fopen(path, "wb") : NULL;
+    if (!row) return GAUSSIAN_NO_MEMORY;
+    if (!fp) { free(row); return GAUSSIAN_INVALID_INPUT; }
+    int ok = fwrite(&h, sizeof(h), 1, fp) == 1;
+    /* 文件头到数据起点之间填零 */
+    for (size_t pad = (size_t)h.offset - GMAT_HEADER; ok && pad > 0;) {
+        size_t c = pad < ldo * es ? pad : ldo * es;
+        ok = fwrite(row, 1, c, fp) == c;
+        pad -= c;
+    }
+    for (size_t i = 0; ok && i < rows; ++i) {
+        const double *a = &A[IDX(i,0,lda)];
+        if (dtype == GMAT_F64) memcpy(row, a, cols * sizeof(double));
+        else for (size_t j = 0; j < cols; ++j) ((float*)row)[j] = (float)a[j];
+        ok = fwrite(row, es, ldo, fp) == ldo;
+    }
+    if (fclose(fp) != 0) ok = 0;
+    free(row);
+    return ok ? GAUSSIAN_SUCCESS : GAUSSIAN_INVALID_INPUT;
+}
+
+/* 校验文件头与文件长度，填好 m 的几何信息 */
+static int gmat_parse(const void *base, size_t len, GMatMap *m) {
+    GMatHeader h;
+    if (len < GMAT_HEADER) return 0;
+    memcpy(&h, base, sizeof(h));
+    if (memcmp(h.magic, GMAT_MAGIC, 8) != 0 || h.bom != GMAT_BOM) return 0;
+    const size_t es = gmat_esize((GMatDtype)h.dtype);
+    if (!gmat_align_ok((size_t)h.align, es) || h.rows == 0 || h.cols == 0 || h.lda < h.cols
+        || h.offset < GMAT_HEADER || h.offset % h.align != 0 || (h.lda * es) % h.align != 0)
+        return 0;
+    if (h.offset > len || h.lda > (len - h.offset) / es || h.rows > (len - h.offset) / es / h.lda)
+        return 0;
+    m->rows = (size_t)h.rows; m->cols = (size_t)h.cols; m->lda = (size_t)h.lda;
+    m->dtype = (GMatDtype)h.dtype;
+    m->align = (size_t)h.align;
+    m->cdata = (const unsigned char*)base + h.offset;
+    return 1;
+}
+
+GAUSSIAN_Err gmat_map(const char *path, GMatMode mode, GMatMap *m) {
+    if (!path || !m || (mode != GMAT_MAP_READONLY && mode != GMAT_MAP_COPY_ON_WRITE))
+        return GAUSSIAN_INVALID_INPUT;
+    memset(m, 0, sizeof(*m));
+    const int cow = mode == GMAT_MAP_COPY_ON_WRITE;
+#ifdef _WIN32
+    HANDLE hf = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER sz;
+    if (hf == INVALID_HANDLE_VALUE) return GAUSSIAN_INVALID_INPUT;
+    if (!GetFileSizeEx(hf, &sz) || sz.QuadPart < GMAT_HEADER
+        || (unsigned long long)sz.QuadPart > SIZE_MAX) {
+        CloseHandle(hf);
+        return GAUSSIAN_INVALID_INPUT;
+    }
+    /* PAGE_WRITECOPY + FILE_MAP_COPY：写入的页得到进程私有副本 */
+    HANDLE hm = CreateFileMappingA(hf, NULL, cow ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(hf);
+    if (!hm) return GAUSSIAN_NO_MEMORY;
+    void *base = MapViewOfFile(hm, cow ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    if (!base) { CloseHandle(hm); return GAUSSIAN_NO_MEMORY; }
+    m->handle = hm;
+    m->len = (size_t)sz.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    struct stat sb;
+    if (fd < 0) return GAUSSIAN_INVALID_INPUT;
+    if (fstat(fd, &sb) != 0 || sb.st_size < GMAT_HEADER
+        || (unsigned long long)sb.st_size > SIZE_MAX) {
+        close(fd);
+        return GAUSSIAN_INVALID_INPUT;
+    }
+    /* MAP_PRIVATE：写入触发缺页复制，文件与其他映射者看不到修改 */
+    void *base = mmap(NULL, (size_t)sb.st_size, cow ? PROT_READ | PROT_WRITE : PROT_READ,
+                      cow ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return GAUSSIAN_NO_MEMORY;
+    m->len = (size_t)sb.st_size;
+#endif
+    m->base = base;
+    if (!gmat_parse(base, m->len, m)) {
+        gmat_unmap(m);
+        return GAUSSIAN_INVALID_INPUT;
+    }
+#ifndef _WIN32
+    posix_madvise(base, m->len, POSIX_MADV_WILLNEED);
+#endif
+    if (cow) m->data = (void*)m->cdata;
+    return GAUSSIAN_SUCCESS;
+}
+
+void gmat_unmap(GMatMap *m) {
+    if (!m) return;
+    if (m->base) {
+#ifdef _WIN32
+        UnmapViewOfFile(m->base);
+        CloseHandle((HANDLE)m->handle);
+#else
+        munmap(m->base, m->len);
+#endif
+    }
+    memset(m, 0, sizeof(*m));
+}
@@ -0,0 +1,255 @@
+#include "gaussian_mixed.h"
+#include "gaussian_simd.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 单精度分块 LU 的面板宽度与 Schur 更新列分块宽度（列块字节数与双精度版本相同） */
+#ifndef GAUSSIAN_MIXED_NB
+#define GAUSSIAN_MIXED_NB 64
+#endif
+#ifndef GAUSSIAN_MIXED_JB
+#define GAUSSIAN_MIXED_JB 512
+#endif
+
+void mixed_options_default(MixedOptions *opts) {
+    if (!opts) return;
+    opts->max_iter = 30;
+    opts->tol = 0.0;
+    opts->allow_fallback = 1;
+}
+
+/* ------------------ 单精度 LU（结构同 lu_decompose_blocked） ------------------ */
+static GAUSSIAN_Err lu_panel_f32(size_t n, float *A, size_t lda, size_t *piv,
+                                 size_t k0, size_t kb, float eps) {
+    const GaussianKernels *K = gaussian_kernels();
+    const size_t k1 = k0 + kb;
+    for (size_t k = k0; k < k1; ++k) {
+        size_t r = k;
+        float maxv = fabsf(A[IDX(k,k,lda)]);
+        for (size_t i = k + 1; i < n; ++i) {
+            float v = fabsf(A[IDX(i,k,lda)]);
+            if (v > maxv) { maxv = v; r = i; }
+        }
+        if (!(maxv >= eps)) return GAUSSIAN_BAD_MATRIX;
+
+        if (r != k) {
+            for (size_t j = 0; j < n; ++j) {
+                float tmp = A[IDX(k,j,lda)];
+                A[IDX(k,j,lda)] = A[IDX(r,j,lda)];
+                A[IDX(r,j,lda)] = tmp;
+            }
+            size_t tp = piv[k]; piv[k] = piv[r]; piv[r] = tp;
+        }
+
+        float akk = A[IDX(k,k,lda)];
+        for (size_t i = k + 1; i < n; ++i) {
+            A[IDX(i,k,lda)] /= akk;
+            K->saxpy(k1 - k - 1, A[IDX(i,k,lda)], &A[IDX(k,k+1,lda)], &A[IDX(i,k+1,lda)]);
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* C(m x nc) -= L(m x kb) * U(kb x nc) */
+static void schur_update_f32(size_t m, size_t nc, size_t kb,
+                             const float *L, size_t ldl,
+                             const float *U, size_t ldu,
+                             float *C, size_t ldc) {
+    const GaussianKernels *K = gaussian_kernels();
+    for (size_t j0 = 0; j0 < nc; j0 += GAUSSIAN_MIXED_JB) {
+        size_t jb = (nc - j0 < GAUSSIAN_MIXED_JB) ? nc - j0 : GAUSSIAN_MIXED_JB;
+        size_t i = 0;
+        for (; i + 4 <= m; i += 4) {
+            float *c0 = &C[IDX(i,j0,ldc)],   *c1 = &C[IDX(i+1,j0,ldc)];
+            float *c2 = &C[IDX(i+2,j0,ldc)], *c3 = &C[IDX(i+3,j0,ldc)];
+            for (size_t p = 0; p < kb; ++p) {
+                const float l[4] = { L[IDX(i,p,ldl)],   L[IDX(i+1,p,ldl)],
+                                     L[IDX(i+2,p,ldl)], L[IDX(i+3,p,ldl)] };
+                K->saxpy4(jb, l, &U[IDX(p,j0,ldu)], c0, c1, c2, c3);
+            }
+        }
+        for (; i < m; ++i) {
+            float *c = &C[IDX(i,j0,ldc)];
+            for (size_t p = 0; p < kb; ++p)
+                K->saxpy(jb, L[IDX(i,p,ldl)], &U[IDX(p,j0,ldu)], c);
+        }
+    }
+}
+
+GAUSSIAN_Err lu_decompose_pp_f32(size_t n, float *A, size_t lda, size_t *piv) {
+    if (!A || !piv || lda < n) return GAUSSIAN_INVALID_INPUT;
+    const float EPS = 1e-12f;
+    const GaussianKernels *K = gaussian_kernels();
+
+    for (size_t i = 0; i < n; ++i) piv[i] = i;
+
+    for (size_t k0 = 0; k0 < n; k0 += GAUSSIAN_MIXED_NB) {
+        size_t kb = (n - k0 < GAUSSIAN_MIXED_NB) ? n - k0 : GAUSSIAN_MIXED_NB;
+        size_t k1 = k0 + kb;
+
+        GAUSSIAN_Err ret = lu_panel_f32(n, A, lda, piv, k0, kb, EPS);
+        if (ret != GAUSSIAN_SUCCESS) return ret;
+        if (k1 == n) break;
+
+        for (size_t r = k0 + 1; r < k1; ++r)
+            for (size_t p = k0; p < r; ++p)
+                K->saxpy(n - k1, A[IDX(r,p,lda)], &A[IDX(p,k1,lda)], &A[IDX(r,k1,lda)]);
+
+        schur_update_f32(n - k1, n - k1, kb,
+                         &A[IDX(k1,k0,lda)], lda, &A[IDX(k0,k1,lda)], lda,
+                         &A[IDX(k1,k1,lda)], lda);
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err lu_solve_f32(size_t n, const float *LU, size_t lda, const size_t *piv,
+                          const float *b, float *x) {
+    if (!LU || !piv || !b || !x || lda < n || b == x) return GAUSSIAN_INVALID_INPUT;
+
+    for (size_t i = 0; i < n; ++i) {
+        const float *row = &LU[IDX(i,0,lda)];
+        float sum = b[piv[i]];
+        for (size_t j = 0; j < i; ++j) sum -= row[j] * x[j];
+        x[i] = sum;
+    }
+    for (ptrdiff_t i = (ptrdiff_t)n - 1; i >= 0; --i) {
+        const float *row = &LU[IDX((size_t)i,0,lda)];
+        float sum = x[i];
+        for (size_t j = (size_t)i + 1; j < n; ++j) sum -= row[j] * x[j];
+        x[i] = sum / row[i];
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 双精度残差与后向误差 ------------------ */
+static double vec_norm_inf(size_t n, const double *v) {
+    double m = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double a = fabs(v[i]);
+        if (a > m || a != a) m = a;     /* NaN 向上传播 */
+    }
+    return m;
+}
+
+/* r = b - A x，返回 berr */
+static double residual_berr(size_t n, const double *A, size_t lda, const double *b,
+                            const double *x, double anorm, double bnorm, double *r) {
+    for (size_t i = 0; i < n; ++i) {
+        const double *row = &A[IDX(i,0,lda)];
+        double s = 0.0;
+        for (size_t j = 0; j < n; ++j) s += row[j] * x[j];
+        r[i] = b[i] - s;
+    }
+    double den = anorm * vec_norm_inf(n, x) + bnorm;
+    double rn = vec_norm_inf(n, r);
+    if (den == 0.0) return rn == 0.0 ? 0.0 : INFINITY;
+    return rn / den;
+}
+
+/* d = A^{-1} v，用单精度因子；v 先按 ||v||_inf 缩放到 float 的安全范围 */
+static void solve_scaled_f32(size_t n, const float *LU, const size_t *piv,
+                             const double *v, double *d, float *vf, float *df) {
+    double s = vec_norm_inf(n, v);
+    if (s == 0.0 || !isfinite(s)) {
+        for (size_t i = 0; i < n; ++i) d[i] = s == 0.0 ? 0.0 : NAN;
+        return;
+    }
+    double inv = 1.0 / s;
+    for (size_t i = 0; i < n; ++i) vf[i] = (float)(v[i] * inv);
+    lu_solve_f32(n, LU, n, piv, vf, df);
+    for (size_t i = 0; i < n; ++i) d[i] = (double)df[i] * s;
+}
+
+static GAUSSIAN_Err solve_double(size_t n, const double *A, size_t lda, const double *b,
+                                 double *x, size_t *piv, double anorm, double bnorm,
+                                 double *r, double *berr) {
+    double *LU = (double*)malloc(n * n * sizeof(double));
+    if (!LU) return GAUSSIAN_NO_MEMORY;
+    for (size_t i = 0; i < n; ++i)
+        memcpy(&LU[IDX(i,0,n)], &A[IDX(i,0,lda)], n * sizeof(double));
+    GAUSSIAN_Err ret = lu_decompose_blocked(n, LU, n, piv);
+    if (ret == GAUSSIAN_SUCCESS) ret = lu_solve(n, LU, n, piv, b, x);
+    if (ret == GAUSSIAN_SUCCESS) *berr = residual_berr(n, A, lda, b, x, anorm, bnorm, r);
+    free(LU);
+    return ret;
+}
+
+GAUSSIAN_Err mixed_lu_solve(size_t n, const double *A, size_t lda,
+                            const double *b, double *x,
+                            const MixedOptions *opts, MixedStatus *status) {
+    if (!A || !b || !x || lda < n || b == x) return GAUSSIAN_INVALID_INPUT;
+    MixedOptions o;
+    if (opts) o = *opts; else mixed_options_default(&o);
+    if (o.tol < 0.0) return GAUSSIAN_INVALID_INPUT;
+    const double tol = o.tol > 0.0 ? o.tol : sqrt((double)n) * DBL_EPSILON;
+    if (status) { status->iterations = 0; status->backward_error = 0.0; status->fallback = 0; }
+    if (n == 0) return GAUSSIAN_SUCCESS;
+
+    float *Af = (float*)malloc(n * n * sizeof(float));
+    float *vf = (float*)malloc(2 * n * sizeof(float));
+    double *work = (double*)malloc(3 * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    if (!Af || !vf || !work || !piv) {
+        free(Af); free(vf); free(work); free(piv);
+        return GAUSSIAN_NO_MEMORY;
+    }
+    double *r = work, *d = work + n, *xbest = work + 2 * n;
+    float *df = vf + n;
+
+    /* ||A||_inf 与单精度副本；超出 float 范围（含非有限值）直接走双精度 */
+    double anorm = 0.0;
+    int in_range = 1;
+    for (size_t i = 0; i < n; ++i) {
+        const double *row = &A[IDX(i,0,lda)];
+        float *rowf = &Af[IDX(i,0,n)];
+        double s = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            double a = fabs(row[j]);
+            s += a;
+            if (!(a <= FLT_MAX)) in_range = 0;
+            rowf[j] = (float)row[j];
+        }
+        if (s > anorm) anorm = s;
+    }
+    const double bnorm = vec_norm_inf(n, b);
+
+    GAUSSIAN_Err ret = GAUSSIAN_NOT_CONVERGED;
+    size_t it = 0;
+    double berr = INFINITY, best = INFINITY;
+    GAUSSIAN_Err fret = in_range ? lu_decompose_pp_f32(n, Af, n, piv) : GAUSSIAN_NOT_CONVERGED;
+    if (fret != GAUSSIAN_SUCCESS) {
+        ret = fret;
+    } else {
+        solve_scaled_f32(n, Af, piv, b, x, vf, df);
+        for (;;) {
+            berr = residual_berr(n, A, lda, b, x, anorm, bnorm, r);
+            if (berr <= tol) { ret = GAUSSIAN_SUCCESS; best = berr; break; }
+            /* 停滞：后向误差未减半（或出现非有限值） */
+            if (!(berr <= 0.5 * best) || it >= o.max_iter) {
+                if (berr < best) { best = berr; memcpy(xbest, x, n * sizeof(double)); }
+                break;
+            }
+            best = berr;
+            memcpy(xbest, x, n * sizeof(double));
+            solve_scaled_f32(n, Af, piv, r, d, vf, df);
+            for (size_t i = 0; i < n; ++i) x[i] += d[i];
+            ++it;
+        }
+        if (ret != GAUSSIAN_SUCCESS && isfinite(best)) {
+            memcpy(x, xbest, n * sizeof(double));
+            berr = best;
+        }
+    }
+
+    int fallback = 0;
+    if (ret != GAUSSIAN_SUCCESS && o.allow_fallback) {
+        fallback = 1;
+        ret = solve_double(n, A, lda, b, x, piv, anorm, bnorm, r, &berr);
+    }
+    if (status) { status->iterations = it; status->backward_error = berr; status->fallback = fallback; }
+
+    free(Af); free(vf); free(work); free(piv);
+    return ret;
+}
@@ -0,0 +1,500 @@
+#if !defined(_WIN32) && !defined(_FILE_OFFSET_BITS)
+#define _FILE_OFFSET_BITS 64
+#endif
+#include "gaussian_ooc.h"
+#include "gaussian_gemm.h"
+#include "gaussian_simd.h"
+#include "thread_pool.h"
+#include "thread_sync.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#define ooc_fseek(fp, off) _fseeki64((fp), (long long)(off), SEEK_SET)
+#else
+#define ooc_fseek(fp, off) fseeko((fp), (off_t)(off), SEEK_SET)
+#endif
+
+#define OOC_MAGIC "GAUSOOC1"
+#define OOC_HEADER 64ULL
+#define OOC_DEFAULT_BUDGET ((size_t)256 << 20)
+#ifndef GAUSSIAN_OOC_TRSM_BASE
+#define GAUSSIAN_OOC_TRSM_BASE 64     /* 三角求解 / 面板分解递归的基本块 */
+#endif
+
+static double now_sec(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* ------------------ 文件布局 ------------------ */
+static size_t ooc_npanel(const OocMatrix *M) { return (M->n + M->w - 1) / M->w; }
+static size_t ooc_wb(const OocMatrix *M, size_t k) {
+    size_t c0 = k * M->w;
+    return (M->n - c0 < M->w) ? M->n - c0 : M->w;
+}
+static unsigned long long ooc_panel_offset(const OocMatrix *M, size_t k) {
+    return OOC_HEADER + 8ULL * (unsigned long long)M->n * (unsigned long long)(k * M->w);
+}
+static unsigned long long ooc_piv_offset(const OocMatrix *M) {
+    return OOC_HEADER + 8ULL * (unsigned long long)M->n * (unsigned long long)M->n;
+}
+
+static int ooc_write_header(OocMatrix *M) {
+    unsigned char h[OOC_HEADER];
+    uint64_t v[3] = { M->n, M->w, (uint64_t)M->factored };
+    memset(h, 0, sizeof(h));
+    memcpy(h, OOC_MAGIC, 8);
+    memcpy(h + 8, v, sizeof(v));
+    return ooc_fseek(M->fp, 0) == 0 && fwrite(h, 1, sizeof(h), M->fp) == sizeof(h);
+}
+
+size_t ooc_panel_width(size_t n, size_t mem_budget) {
+    if (n == 0) return 1;
+    if (mem_budget == 0) mem_budget = OOC_DEFAULT_BUDGET;
+    size_t w = mem_budget / (3 * n * sizeof(double));
+    return w > n ? n : w;
+}
+
+GAUSSIAN_Err ooc_create(const char *path, size_t n, size_t w, OocMatrix *M) {
+    if (!path || !M || n == 0) return GAUSSIAN_INVALID_INPUT;
+    if (w == 0) w = ooc_panel_width(n, 0);
+    if (w == 0) return GAUSSIAN_NO_MEMORY;
+    if (w > n) w = n;
+    memset(M, 0, sizeof(*M));
+    M->n = n; M->w = w;
+    M->fp = fopen(path, "w+b");
+    if (!M->fp) return GAUSSIAN_INVALID_INPUT;
+    /* 写最后一个字节把文件扩展到全长（POSIX 上为稀疏文件），其余部分读出为零 */
+    const unsigned char zero = 0;
+    if (!ooc_write_header(M) || ooc_fseek(M->fp, ooc_piv_offset(M) - 1) != 0
+        || fwrite(&zero, 1, 1, M->fp) != 1 || fflush(M->fp) != 0) {
+        ooc_close(M);
+        return GAUSSIAN_INVALID_INPUT;
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err ooc_open(const char *path, OocMatrix *M) {
+    if (!path || !M) return GAUSSIAN_INVALID_INPUT;
+    memset(M, 0, sizeof(*M));
+    M->fp = fopen(path, "r+b");
+    if (!M->fp) return GAUSSIAN_INVALID_INPUT;
+    unsigned char h[OOC_HEADER];
+    uint64_t v[3];
+    if (fread(h, 1, sizeof(h), M->fp) != sizeof(h) || memcmp(h, OOC_MAGIC, 8) != 0) {
+        ooc_close(M);
+        return GAUSSIAN_INVALID_INPUT;
+    }
+    memcpy(v, h + 8, sizeof(v));
+    if (v[0] == 0 || v[1] == 0 || v[1] > v[0] || v[2] > 1 || v[0] > SIZE_MAX / 8) {
+        ooc_close(M);
+        return GAUSSIAN_INVALID_INPUT;
+    }
+    M->n = (size_t)v[0]; M->w = (size_t)v[1]; M->factored = (int)v[2];
+    if (M->factored) {
+        uint64_t *p = (uint64_t*)malloc(M->n * sizeof(uint64_t));
+        M->piv = (size_t*)malloc(M->n * sizeof(size_t));
+        int ok = p && M->piv && ooc_fseek(M->fp, ooc_piv_offset(M)) == 0
+              && fread(p, sizeof(uint64_t), M->n, M->fp) == M->n;
+        for (size_t i = 0; ok && i < M->n; ++i) {
+            if (p[i] >= M->n) ok = 0;
+            else M->piv[i] = (size_t)p[i];
+        }
+        free(p);
+        if (!ok) { ooc_close(M); return GAUSSIAN_INVALID_INPUT; }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+void ooc_close(OocMatrix *M) {
+    if (!M) return;
+    if (M->fp) fclose(M->fp);
+    free(M->piv);
+    memset(M, 0, sizeof(*M));
+}
+
+GAUSSIAN_Err ooc_write_panel(OocMatrix *M, size_t k, const double *buf) {
+    if (!M || !M->fp || !buf || k >= ooc_npanel(M)) return GAUSSIAN_INVALID_INPUT;
+    size_t cnt = M->n * ooc_wb(M, k);
+    if (ooc_fseek(M->fp, ooc_panel_offset(M, k)) != 0
+        || fwrite(buf, sizeof(double), cnt, M->fp) != cnt)
+        return GAUSSIAN_INVALID_INPUT;
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err ooc_read_panel(const OocMatrix *M, size_t k, double *buf) {
+    if (!M || !M->fp || !buf || k >= ooc_npanel(M)) return GAUSSIAN_INVALID_INPUT;
+    size_t cnt = M->n * ooc_wb(M, k);
+    if (ooc_fseek(M->fp, ooc_panel_offset(M, k)) != 0
+        || fread(buf, sizeof(double), cnt, M->fp) != cnt)
+        return GAUSSIAN_INVALID_INPUT;
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err ooc_write_rows(OocMatrix *M, size_t i0, size_t m, const double *A, size_t lda) {
+    if (!M || !M->fp || !A || lda < M->n || i0 > M->n || m > M->n - i0)
+        return GAUSSIAN_INVALID_INPUT;
+    for (size_t k = 0; k < ooc_npanel(M); ++k) {
+        size_t c0 = k * M->w, wb = ooc_wb(M, k);
+        unsigned long long off = ooc_panel_offset(M, k) + 8ULL * (unsigned long long)(i0 * wb);
+        if (ooc_fseek(M->fp, off) != 0) return GAUSSIAN_INVALID_INPUT;
+        for (size_t i = 0; i < m; ++i)
+            if (fwrite(&A[IDX(i,c0,lda)], sizeof(double), wb, M->fp) != wb)
+                return GAUSSIAN_INVALID_INPUT;
+    }
+    return fflush(M->fp) == 0 ? GAUSSIAN_SUCCESS : GAUSSIAN_INVALID_INPUT;
+}
+
+/* ------------------ I/O 线程：按提交顺序执行的读写队列 ------------------
+ * 同一缓冲区上"先写回、后读入"的两个请求按顺序完成，计算线程只需等待票号 */
+#define OOC_QCAP 4
+
+typedef struct {
+    int write;
+    size_t panel;
+    double *buf;
+} OocReq;
+
+typedef struct {
+    OocMatrix *M;
+    ThreadHandle thread;
+    ThreadMutex lock;
+    ThreadCond cond;
+    OocReq q[OOC_QCAP];
+    unsigned long long issued, done;
+    int stop, error;
+    OocStats st;
+} OocIo;
+
+static ThreadRet THREAD_CALL ooc_io_main(void *p) {
+    OocIo *io = (OocIo*)p;
+    thread_mutex_lock(&io->lock);
+    for (;;) {
+        while (io->done == io->issued && !io->stop)
+            thread_cond_wait(&io->cond, &io->lock);
+        if (io->done == io->issued) break;
+        OocReq r = io->q[io->done % OOC_QCAP];
+        thread_mutex_unlock(&io->lock);
+
+        GAUSSIAN_Err ret = r.write ? ooc_write_panel(io->M, r.panel, r.buf)
+                                   : ooc_read_panel(io->M, r.panel, r.buf);
+        unsigned long long bytes = 8ULL * io->M->n * ooc_wb(io->M, r.panel);
+
+        thread_mutex_lock(&io->lock);
+        if (ret != GAUSSIAN_SUCCESS) io->error = 1;
+        if (r.write) io->st.bytes_written += bytes;
+        else io->st.bytes_read += bytes;
+        io->done++;
+        thread_cond_broadcast(&io->cond);
+    }
+    thread_mutex_unlock(&io->lock);
+    return (ThreadRet)0;
+}
+
+static int ooc_io_start(OocIo *io, OocMatrix *M) {
+    memset(io, 0, sizeof(*io));
+    io->M = M;
+    if (thread_mutex_init(&io->lock) != 0) return 0;
+    if (thread_cond_init(&io->cond) != 0) {
+        thread_mutex_destroy(&io->lock);
+        return 0;
+    }
+    if (thread_create(&io->thread, ooc_io_main, io) != 0) {
+        thread_cond_destroy(&io->cond);
+        thread_mutex_destroy(&io->lock);
+        return 0;
+    }
+    return 1;
+}
+
+/* 返回票号；队列满时阻塞 */
+static unsigned long long ooc_io_submit(OocIo *io, int write, size_t panel, double *buf) {
+    thread_mutex_lock(&io->lock);
+    while (io->issued - io->done >= OOC_QCAP)
+        thread_cond_wait(&io->cond, &io->lock);
+    OocReq r = { write, panel, buf };
+    io->q[io->issued % OOC_QCAP] = r;
+    unsigned long long ticket = ++io->issued;
+    thread_cond_broadcast(&io->cond);
+    thread_mutex_unlock(&io->lock);
+    return ticket;
+}
+
+/* 等待票号 ticket 及之前的请求完成；任一请求失败返回 0 */
+static int ooc_io_wait(OocIo *io, unsigned long long ticket) {
+    double t0 = now_sec();
+    thread_mutex_lock(&io->lock);
+    while (io->done < ticket)
+        thread_cond_wait(&io->cond, &io->lock);
+    int ok = !io->error;
+    thread_mutex_unlock(&io->lock);
+    io->st.io_wait += now_sec() - t0;
+    return ok;
+}
+
+/* 等待全部请求后退出；返回是否全部成功 */
+static int ooc_io_stop(OocIo *io, OocStats *stats) {
+    thread_mutex_lock(&io->lock);
+    io->stop = 1;
+    thread_cond_broadcast(&io->cond);
+    thread_mutex_unlock(&io->lock);
+    thread_join(io->thread);
+    thread_cond_destroy(&io->cond);
+    thread_mutex_destroy(&io->lock);
+    if (stats) *stats = io->st;
+    return !io->error;
+}
+
+/* ------------------ 内存内核 ------------------ */
+/* B(k x m) = L^{-1} B，L 为 k x k 单位下三角；对半递归，非对角块走 GEMM */
+static GAUSSIAN_Err ooc_trsm_unit_lower(size_t k, size_t m, const double *L, size_t ldl,
+                                        double *B, size_t ldb, ThreadPool *pool) {
+    if (k == 0 || m == 0) return GAUSSIAN_SUCCESS;
+    if (k > GAUSSIAN_OOC_TRSM_BASE) {
+        size_t h = k / 2;
+        GAUSSIAN_Err ret = ooc_trsm_unit_lower(h, m, L, ldl, B, ldb, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, k - h, m, h, -1.0,
+                                     &L[IDX(h,0,ldl)], ldl, B, ldb, 1.0, &B[IDX(h,0,ldb)], ldb,
+                                     pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = ooc_trsm_unit_lower(k - h, m, &L[IDX(h,h,ldl)], ldl, &B[IDX(h,0,ldb)], ldb, pool);
+        return ret;
+    }
+    const GaussianKernels *K = gaussian_kernels();
+    for (size_t r = 1; r < k; ++r)
+        for (size_t p = 0; p < r; ++p)
+            K->axpy(m, L[IDX(r,p,ldl)], &B[IDX(p,0,ldb)], &B[IDX(r,0,ldb)]);
+    return GAUSSIAN_SUCCESS;
+}
+
+/* 按 LAPACK 式交换序列 ipiv[from..to) 交换 P（行跨度 wb）的行 */
+static void ooc_apply_swaps(double *P, size_t wb, const size_t *ipiv, size_t from, size_t to) {
+    for (size_t c = from; c < to; ++c) {
+        size_t r = ipiv[c];
+        if (r == c) continue;
+        double *x = &P[IDX(c,0,wb)], *y = &P[IDX(r,0,wb)];
+        for (size_t j = 0; j < wb; ++j) { double t = x[j]; x[j] = y[j]; y[j] = t; }
+    }
+}
+
+/* 面板内列 [c0, c1) 的递归部分选主元分解：列 c 的对角行为 a0 + c，行交换作用于整个面板宽度 */
+static GAUSSIAN_Err ooc_panel_lu(size_t n, double *P, size_t wb, size_t a0,
+                                 size_t c0, size_t c1, size_t *ipiv, double eps,
+                                 ThreadPool *pool) {
+    if (c1 - c0 > GAUSSIAN_OOC_TRSM_BASE) {
+        size_t h = (c1 - c0) / 2, cm = c0 + h;
+        size_t d0 = a0 + c0, dm = a0 + cm;
+        GAUSSIAN_Err ret = ooc_panel_lu(n, P, wb, a0, c0, cm, ipiv, eps, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = ooc_trsm_unit_lower(h, c1 - cm, &P[IDX(d0,c0,wb)], wb, &P[IDX(d0,cm,wb)], wb,
+                                      pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, n - dm, c1 - cm, h, -1.0,
+                                     &P[IDX(dm,c0,wb)], wb, &P[IDX(d0,cm,wb)], wb,
+                                     1.0, &P[IDX(dm,cm,wb)], wb, pool);
+        return ret == GAUSSIAN_SUCCESS ? ooc_panel_lu(n, P, wb, a0, cm, c1, ipiv, eps, pool) : ret;
+    }
+    const GaussianKernels *K = gaussian_kernels();
+    for (size_t c = c0; c < c1; ++c) {
+        size_t d = a0 + c, r = d;
+        double maxv = fabs(P[IDX(d,c,wb)]);
+        for (size_t i = d + 1; i < n; ++i) {
+            double v = fabs(P[IDX(i,c,wb)]);
+            if (v > maxv) { maxv = v; r = i; }
+        }
+        if (maxv < eps) return GAUSSIAN_BAD_MATRIX;
+        ipiv[d] = r;
+        ooc_apply_swaps(P, wb, ipiv, d, d + 1);
+        double akk = P[IDX(d,c,wb)];
+        for (size_t i = d + 1; i < n; ++i) {
+            double lik = P[IDX(i,c,wb)] /= akk;
+            K->axpy(c1 - c - 1, lik, &P[IDX(d,c+1,wb)], &P[IDX(i,c+1,wb)]);
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 分解 ------------------ */
+GAUSSIAN_Err ooc_lu_factor(OocMatrix *M, const OocOptions *opts, OocStats *stats) {
+    if (!M || !M->fp || M->factored || M->w == 0 || M->w > M->n) return GAUSSIAN_INVALID_INPUT;
+    const double EPS = 1e-12;
+    const size_t n = M->n, w = M->w, np = ooc_npanel(M);
+    size_t budget = (opts && opts->mem_budget) ? opts->mem_budget : OOC_DEFAULT_BUDGET;
+    size_t nthreads = opts ? opts->nthreads : 0;
+    if (ooc_panel_width(n, budget) < w) return GAUSSIAN_NO_MEMORY;
+
+    double *buf[3] = { NULL, NULL, NULL };
+    size_t *ipiv = (size_t*)malloc(n * sizeof(size_t));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    uint64_t *pout = (uint64_t*)malloc(n * sizeof(uint64_t));
+    for (int b = 0; b < 3; ++b) buf[b] = (double*)malloc(n * w * sizeof(double));
+    ThreadPool *pool = NULL;
+    OocIo io;
+    int io_started = 0;
+    GAUSSIAN_Err ret = GAUSSIAN_NO_MEMORY;
+    if (!ipiv || !piv || !pout || !buf[0] || !buf[1] || !buf[2]) goto cleanup;
+    if (nthreads != 1) {
+        pool = thread_pool_create(nthreads);
+        if (!pool) goto cleanup;
+    }
+    if (!ooc_io_start(&io, M)) goto cleanup;
+    io_started = 1;
+
+    ret = GAUSSIAN_SUCCESS;
+    size_t cur = 0;
+    unsigned long long t_cur = ooc_io_submit(&io, 0, 0, buf[cur]);
+    for (size_t j = 0; j < np && ret == GAUSSIAN_SUCCESS; ++j) {
+        const size_t a0j = j * w, wj = ooc_wb(M, j);
+        const size_t s[2] = { (cur + 1) % 3, (cur + 2) % 3 };
+        unsigned long long tk = j > 0 ? ooc_io_submit(&io, 0, 0, buf[s[0]]) : 0;
+
+        if (!ooc_io_wait(&io, t_cur)) { ret = GAUSSIAN_INVALID_INPUT; break; }
+        double *P = buf[cur];
+        ooc_apply_swaps(P, wj, ipiv, 0, a0j);
+
+        /* 流入已分解的面板：计算面板 k 时 I/O 线程读入面板 k+1 */
+        for (size_t k = 0; k < j; ++k) {
+            if (!ooc_io_wait(&io, tk)) { ret = GAUSSIAN_INVALID_INPUT; break; }
+            if (k + 1 < j) tk = ooc_io_submit(&io, 0, k + 1, buf[s[(k + 1) % 2]]);
+            double *L = buf[s[k % 2]];
+            const size_t a0k = k * w, wk = ooc_wb(M, k), a1k = a0k + wk;
+            ooc_apply_swaps(L, wk, ipiv, a1k, a0j);
+            ret = ooc_trsm_unit_lower(wk, wj, &L[IDX(a0k,0,wk)], wk, &P[IDX(a0k,0,wj)], wj, pool);
+            if (ret == GAUSSIAN_SUCCESS)
+                ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, n - a1k, wj, wk, -1.0,
+                                         &L[IDX(a1k,0,wk)], wk, &P[IDX(a0k,0,wj)], wj,
+                                         1.0, &P[IDX(a1k,0,wj)], wj, pool);
+            if (ret != GAUSSIAN_SUCCESS) break;
+        }
+        if (ret != GAUSSIAN_SUCCESS) break;
+
+        /* 分解当前面板的同时预取下一面板；写回与下一轮的读取在队列中排在其后 */
+        if (j + 1 < np) t_cur = ooc_io_submit(&io, 0, j + 1, buf[s[0]]);
+        ret = ooc_panel_lu(n, P, wj, a0j, 0, wj, ipiv, EPS, pool);
+        if (ret != GAUSSIAN_SUCCESS) break;
+        ooc_io_submit(&io, 1, j, P);
+        cur = s[0];
+    }
+
+    /* 后续面板的行交换补做到各面板的 L 上：读 k+2、处理 k、写回 k 流水进行 */
+    if (ret == GAUSSIAN_SUCCESS) {
+        unsigned long long tr[3] = { 0, 0, 0 };
+        tr[0] = ooc_io_submit(&io, 0, 0, buf[0]);
+        if (np > 1) tr[1] = ooc_io_submit(&io, 0, 1, buf[1]);
+        for (size_t k = 0; k < np; ++k) {
+            if (!ooc_io_wait(&io, tr[k % 3])) { ret = GAUSSIAN_INVALID_INPUT; break; }
+            if (k + 2 < np) tr[(k + 2) % 3] = ooc_io_submit(&io, 0, k + 2, buf[(k + 2) % 3]);
+            const size_t wk = ooc_wb(M, k);
+            ooc_apply_swaps(buf[k % 3], wk, ipiv, k * w + wk, n);
+            ooc_io_submit(&io, 1, k, buf[k % 3]);
+        }
+    }
+    if (!ooc_io_stop(&io, stats) && ret == GAUSSIAN_SUCCESS) ret = GAUSSIAN_INVALID_INPUT;
+    io_started = 0;
+
+    if (ret == GAUSSIAN_SUCCESS) {
+        for (size_t i = 0; i < n; ++i) piv[i] = i;
+        for (size_t c = 0; c < n; ++c) {
+            size_t t = piv[c]; piv[c] = piv[ipiv[c]]; piv[ipiv[c]] = t;
+        }
+        for (size_t i = 0; i < n; ++i) pout[i] = piv[i];
+        M->factored = 1;
+        if (ooc_fseek(M->fp, ooc_piv_offset(M)) != 0
+            || fwrite(pout, sizeof(uint64_t), n, M->fp) != n
+            || !ooc_write_header(M) || fflush(M->fp) != 0) {
+            M->factored = 0;
+            ret = GAUSSIAN_INVALID_INPUT;
+        } else {
+            M->piv = piv;
+            piv = NULL;
+        }
+    }
+
+cleanup:
+    if (io_started) ooc_io_stop(&io, stats);
+    thread_pool_destroy(pool);
+    for (int b = 0; b < 3; ++b) free(buf[b]);
+    free(ipiv); free(piv); free(pout);
+    return ret;
+}
+
+/* ------------------ 求解 ------------------ */
+GAUSSIAN_Err ooc_lu_solve(const OocMatrix *M, size_t nrhs, const double *B, size_t ldb,
+                          double *X, size_t ldx, const OocOptions *opts) {
+    if (!M || !M->fp || !M->factored || !M->piv || !B || !X || ldb < nrhs || ldx < nrhs)
+        return GAUSSIAN_INVALID_INPUT;
+    if (nrhs == 0) return GAUSSIAN_SUCCESS;
+    const size_t n = M->n, w = M->w, np = ooc_npanel(M);
+    size_t budget = (opts && opts->mem_budget) ? opts->mem_budget : OOC_DEFAULT_BUDGET;
+    size_t nthreads = opts ? opts->nthreads : 0;
+    if (ooc_panel_width(n, budget) < w) return GAUSSIAN_NO_MEMORY;
+
+    double *buf[2] = { (double*)malloc(n * w * sizeof(double)),
+                       (double*)malloc(n * w * sizeof(double)) };
+    double *Y = (double*)malloc(n * nrhs * sizeof(double));
+    ThreadPool *pool = NULL;
+    OocIo io;
+    GAUSSIAN_Err ret = GAUSSIAN_NO_MEMORY;
+    if (!buf[0] || !buf[1] || !Y) goto cleanup;
+    if (nthreads != 1 && nrhs > 1) {
+        pool = thread_pool_create(nthreads);
+        if (!pool) goto cleanup;
+    }
+    if (!ooc_io_start(&io, (OocMatrix*)M)) goto cleanup;
+
+    for (size_t i = 0; i < n; ++i)
+        memcpy(&Y[IDX(i,0,nrhs)], &B[IDX(M->piv[i],0,ldb)], nrhs * sizeof(double));
+    ret = GAUSSIAN_SUCCESS;
+
+    /* 前代 L Y = P B：面板 k 的 L_kk 与其下方的 L 块 */
+    unsigned long long t = ooc_io_submit(&io, 0, 0, buf[0]);
+    for (size_t k = 0; k < np; ++k) {
+        if (!ooc_io_wait(&io, t)) { ret = GAUSSIAN_INVALID_INPUT; break; }
+        t = ooc_io_submit(&io, 0, k + 1 < np ? k + 1 : np - 1, buf[(k + 1) % 2]);
+        const double *L = buf[k % 2];
+        const size_t a0 = k * w, wk = ooc_wb(M, k), a1 = a0 + wk;
+        ret = ooc_trsm_unit_lower(wk, nrhs, &L[IDX(a0,0,wk)], wk, &Y[IDX(a0,0,nrhs)], nrhs, pool);
+        if (ret == GAUSSIAN_SUCCESS && a1 < n)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, n - a1, nrhs, wk, -1.0,
+                                     &L[IDX(a1,0,wk)], wk, &Y[IDX(a0,0,nrhs)], nrhs,
+                                     1.0, &Y[IDX(a1,0,nrhs)], nrhs, pool);
+        if (ret != GAUSSIAN_SUCCESS) break;
+    }
+
+    /* 回代 U X = Y：末面板已在上一遍最后读入 buf[np % 2] */
+    const GaussianKernels *K = gaussian_kernels();
+    for (size_t k = np; k-- > 0 && ret == GAUSSIAN_SUCCESS;) {
+        if (!ooc_io_wait(&io, t)) { ret = GAUSSIAN_INVALID_INPUT; break; }
+        const double *U = buf[(np - 1 - k + np) % 2];
+        if (k > 0) t = ooc_io_submit(&io, 0, k - 1, buf[(np - k + np) % 2]);
+        const size_t a0 = k * w, wk = ooc_wb(M, k);
+        for (size_t c = wk; c-- > 0;) {
+            const double *row = &U[IDX(a0 + c,0,wk)];
+            double *y = &Y[IDX(a0 + c,0,nrhs)];
+            const double inv = 1.0 / row[c];
+            for (size_t r = 0; r < nrhs; ++r) y[r] *= inv;
+            for (size_t i = a0; i < a0 + c; ++i)
+                K->axpy(nrhs, U[IDX(i,c,wk)], y, &Y[IDX(i,0,nrhs)]);
+        }
+        if (a0 > 0)
+            ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, a0, nrhs, wk, -1.0,
+                                     U, wk, &Y[IDX(a0,0,nrhs)], nrhs,
+                                     1.0, Y, nrhs, pool);
+    }
+    if (!ooc_io_stop(&io, NULL) && ret == GAUSSIAN_SUCCESS) ret = GAUSSIAN_INVALID_INPUT;
+    if (ret == GAUSSIAN_SUCCESS)
+        for (size_t i = 0; i < n; ++i)
+            memcpy(&X[IDX(i,0,ldx)], &Y[IDX(i,0,nrhs)], nrhs * sizeof(double));
+
+cleanup:
+    thread_pool_destroy(pool);
+    free(buf[0]); free(buf[1]); free(Y);
+    return ret;
+}
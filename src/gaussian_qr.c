@@ -0,0 +1,377 @@
+#include "gaussian_qr.h"
+#include "gaussian_gemm.h"
+#include "gaussian_simd.h"
+#include "gaussian_tri.h"
+#include "thread_pool.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef GAUSSIAN_QR_NB
+#define GAUSSIAN_QR_NB 32             /* 面板宽度（紧凑 WY 的块大小） */
+#endif
+#ifndef GAUSSIAN_QR_PANEL_BASE
+#define GAUSSIAN_QR_PANEL_BASE 8      /* 面板递归的基本块列数 */
+#endif
+#ifndef GAUSSIAN_QR_TSQR_RATIO
+#define GAUSSIAN_QR_TSQR_RATIO 4      /* TSQR 行块至少 RATIO * n 行 */
+#endif
+#ifndef GAUSSIAN_QR_TSQR_LEAF
+#define GAUSSIAN_QR_TSQR_LEAF (1u << 20)  /* TSQR 行块的字节数上限（约为 L2 的一半） */
+#endif
+
+/* 工作区：V（mr x nb，显式单位下梯形）、T / G（nb x nb）、W / W2（nb x nc） */
+typedef struct {
+    double *V, *T, *G, *W, *W2;
+} QrWork;
+
+static void qr_work_free(QrWork *w) {
+    free(w->V); free(w->T); free(w->G); free(w->W); free(w->W2);
+    memset(w, 0, sizeof(*w));
+}
+
+static int qr_work_alloc(QrWork *w, size_t m, size_t nc) {
+    const size_t nb = GAUSSIAN_QR_NB;
+    w->V = (double*)malloc(m * nb * sizeof(double));
+    w->T = (double*)malloc(nb * nb * sizeof(double));
+    w->G = (double*)malloc(nb * nb * sizeof(double));
+    w->W = (double*)malloc(nb * nc * sizeof(double));
+    w->W2 = (double*)malloc(nb * nc * sizeof(double));
+    if (w->V && w->T && w->G && w->W && w->W2) return 1;
+    qr_work_free(w);
+    return 0;
+}
+
+/* 面板基本块（jb <= GAUSSIAN_QR_PANEL_BASE 列）逐列 Householder，每列两遍扫描：
+ * 第一遍缩放 v 并累加 w = v^T P(:, c+1:jb)，第二遍做秩 1 更新并顺带累加下一列的平方和 */
+static void qr_panel_base(size_t mr, size_t jb, double *P, size_t lda, double *tau) {
+    double w[GAUSSIAN_QR_PANEL_BASE];
+    double ssq = 0.0;
+    for (size_t i = 1; i < mr; ++i) ssq += P[IDX(i,0,lda)] * P[IDX(i,0,lda)];
+    for (size_t c = 0; c < jb; ++c) {
+        /* 平方和上溢 / 下溢时按最大元缩放重算 */
+        if (!(ssq < 1e300) || (ssq > 0.0 && ssq < 1e-290)) {
+            double scale = 0.0, t = 0.0;
+            for (size_t i = c + 1; i < mr; ++i)
+                if (fabs(P[IDX(i,c,lda)]) > scale) scale = fabs(P[IDX(i,c,lda)]);
+            for (size_t i = c + 1; i < mr; ++i) {
+                double r = P[IDX(i,c,lda)] / scale;
+                t += r * r;
+            }
+            ssq = t * scale * scale;
+        }
+        const double xnorm = sqrt(ssq);
+        const size_t nr = jb - c - 1;
+        if (xnorm == 0.0) {
+            tau[c] = 0.0;
+            ssq = 0.0;
+            for (size_t i = c + 2; nr > 0 && i < mr; ++i)
+                ssq += P[IDX(i,c+1,lda)] * P[IDX(i,c+1,lda)];
+            continue;
+        }
+        const double alpha = P[IDX(c,c,lda)];
+        const double beta = -copysign(hypot(alpha, xnorm), alpha);
+        const double s = 1.0 / (alpha - beta), t = (beta - alpha) / beta;
+        tau[c] = t;
+        P[IDX(c,c,lda)] = beta;
+
+        double *pc = &P[IDX(c,c+1,lda)];
+        for (size_t q = 0; q < nr; ++q) w[q] = pc[q];
+        for (size_t i = c + 1; i < mr; ++i) {
+            double *pi = &P[IDX(i,c,lda)];
+            const double v = (pi[0] *= s);
+            for (size_t q = 0; q < nr; ++q) w[q] += v * pi[q + 1];
+        }
+        for (size_t q = 0; q < nr; ++q) { w[q] *= t; pc[q] -= w[q]; }
+        ssq = 0.0;
+        for (size_t i = c + 1; i < mr; ++i) {
+            double *pi = &P[IDX(i,c,lda)];
+            const double v = pi[0];
+            for (size_t q = 0; q < nr; ++q) pi[q + 1] -= v * w[q];
+            if (nr > 0 && i > c + 1) ssq += pi[1] * pi[1];
+        }
+    }
+}
+
+static GAUSSIAN_Err qr_build_vt(size_t mr, size_t jb, const double *P, size_t lda,
+                                const double *tau, QrWork *ws, ThreadPool *pool);
+static GAUSSIAN_Err qr_larfb(int trans, size_t mr, size_t nc, size_t jb,
+                             double *C, size_t ldc, QrWork *ws, ThreadPool *pool);
+
+/* 面板（mr x jb，起点为对角元）按列对半递归：左半分解后以紧凑 WY 更新右半（GEMM），
+ * 再分解右半的下方部分 */
+static GAUSSIAN_Err qr_panel(size_t mr, size_t jb, double *P, size_t lda, double *tau,
+                             QrWork *ws, ThreadPool *pool) {
+    if (jb <= GAUSSIAN_QR_PANEL_BASE) {
+        qr_panel_base(mr, jb, P, lda, tau);
+        return GAUSSIAN_SUCCESS;
+    }
+    const size_t h = jb / 2;
+    GAUSSIAN_Err ret = qr_panel(mr, h, P, lda, tau, ws, pool);
+    if (ret == GAUSSIAN_SUCCESS) ret = qr_build_vt(mr, h, P, lda, tau, ws, pool);
+    if (ret == GAUSSIAN_SUCCESS) ret = qr_larfb(1, mr, jb - h, h, &P[h], lda, ws, pool);
+    if (ret == GAUSSIAN_SUCCESS)
+        ret = qr_panel(mr - h, jb - h, &P[IDX(h,h,lda)], lda, &tau[h], ws, pool);
+    return ret;
+}
+
+/* 由面板中的反射向量生成显式 V 与上三角 T：H_0 ... H_{jb-1} = I - V T V^T
+ * T(0:c, c) = -tau_c T(0:c, 0:c) V(:, 0:c)^T v_c，V^T V 由一次 GEMM 得到 */
+static GAUSSIAN_Err qr_build_vt(size_t mr, size_t jb, const double *P, size_t lda,
+                                const double *tau, QrWork *ws, ThreadPool *pool) {
+    double *V = ws->V, *T = ws->T, *G = ws->G;
+    for (size_t i = 0; i < mr; ++i) {
+        double *v = &V[IDX(i,0,jb)];
+        size_t c1 = i < jb ? i : jb;
+        memcpy(v, &P[IDX(i,0,lda)], c1 * sizeof(double));
+        if (i < jb) {
+            v[i] = 1.0;
+            memset(&v[i + 1], 0, (jb - i - 1) * sizeof(double));
+        }
+    }
+    GAUSSIAN_Err ret = gaussian_gemm_pool(GEMM_TRANS, GEMM_NO_TRANS, jb, jb, mr, 1.0, V, jb, V, jb,
+                                          0.0, G, jb, pool);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+    memset(T, 0, jb * jb * sizeof(double));
+    for (size_t c = 0; c < jb; ++c) {
+        T[IDX(c,c,jb)] = tau[c];
+        for (size_t r = 0; r < c; ++r) {
+            double s = 0.0;
+            for (size_t q = r; q < c; ++q) s += T[IDX(r,q,jb)] * G[IDX(q,c,jb)];
+            T[IDX(r,c,jb)] = -tau[c] * s;
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* C（mr x nc）<- (I - V op(T) V^T) C，op(T) = T^T 即作用 H^T（trans = 1），否则作用 H */
+static GAUSSIAN_Err qr_larfb(int trans, size_t mr, size_t nc, size_t jb,
+                             double *C, size_t ldc, QrWork *ws, ThreadPool *pool) {
+    GAUSSIAN_Err ret = gaussian_gemm_pool(GEMM_TRANS, GEMM_NO_TRANS, jb, nc, mr, 1.0, ws->V, jb,
+                                          C, ldc, 0.0, ws->W, nc, pool);
+    if (ret == GAUSSIAN_SUCCESS)
+        ret = gaussian_gemm_pool(trans ? GEMM_TRANS : GEMM_NO_TRANS, GEMM_NO_TRANS, jb, nc, jb, 1.0,
+                                 ws->T, jb, ws->W, nc, 0.0, ws->W2, nc, pool);
+    if (ret == GAUSSIAN_SUCCESS)
+        ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, mr, nc, jb, -1.0, ws->V, jb,
+                                 ws->W2, nc, 1.0, C, ldc, pool);
+    return ret;
+}
+
+static GAUSSIAN_Err qr_factor_ws(size_t m, size_t n, double *A, size_t lda, double *tau,
+                                 QrWork *ws, ThreadPool *pool) {
+    for (size_t j0 = 0; j0 < n; j0 += GAUSSIAN_QR_NB) {
+        const size_t jb = (n - j0 < GAUSSIAN_QR_NB) ? n - j0 : GAUSSIAN_QR_NB;
+        const size_t mr = m - j0;
+        double *P = &A[IDX(j0,j0,lda)];
+        GAUSSIAN_Err ret = qr_panel(mr, jb, P, lda, &tau[j0], ws, pool);
+        if (ret != GAUSSIAN_SUCCESS) return ret;
+        if (j0 + jb < n) {
+            ret = qr_build_vt(mr, jb, P, lda, &tau[j0], ws, pool);
+            if (ret == GAUSSIAN_SUCCESS)
+                ret = qr_larfb(1, mr, n - j0 - jb, jb, &P[jb], lda, ws, pool);
+            if (ret != GAUSSIAN_SUCCESS) return ret;
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* C（m x nc）<- Q^T C：按面板顺序作用各块反射的转置 */
+static GAUSSIAN_Err qr_apply_qt_ws(size_t m, size_t n, const double *QR, size_t lda,
+                                   const double *tau, size_t nc, double *C, size_t ldc,
+                                   QrWork *ws, ThreadPool *pool) {
+    for (size_t j0 = 0; j0 < n; j0 += GAUSSIAN_QR_NB) {
+        const size_t jb = (n - j0 < GAUSSIAN_QR_NB) ? n - j0 : GAUSSIAN_QR_NB;
+        GAUSSIAN_Err ret = qr_build_vt(m - j0, jb, &QR[IDX(j0,j0,lda)], lda, &tau[j0], ws, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = qr_larfb(1, m - j0, nc, jb, &C[IDX(j0,0,ldc)], ldc, ws, pool);
+        if (ret != GAUSSIAN_SUCCESS) return ret;
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+static int qr_args_ok(size_t m, size_t n, const double *A, size_t lda, const double *tau) {
+    return A && tau && m >= n && lda >= n;
+}
+
+GAUSSIAN_Err qr_decompose_pool(size_t m, size_t n, double *A, size_t lda, double *tau,
+                               ThreadPool *pool) {
+    if (!qr_args_ok(m, n, A, lda, tau)) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0) return GAUSSIAN_SUCCESS;
+    QrWork ws;
+    if (!qr_work_alloc(&ws, m, n)) return GAUSSIAN_NO_MEMORY;
+    GAUSSIAN_Err ret = qr_factor_ws(m, n, A, lda, tau, &ws, pool);
+    qr_work_free(&ws);
+    return ret;
+}
+
+GAUSSIAN_Err qr_decompose(size_t m, size_t n, double *A, size_t lda, double *tau,
+                          size_t nthreads) {
+    if (!qr_args_ok(m, n, A, lda, tau)) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0) return GAUSSIAN_SUCCESS;
+    ThreadPool *pool = NULL;
+    if (nthreads != 1 && !(pool = thread_pool_create(nthreads))) return GAUSSIAN_NO_MEMORY;
+    GAUSSIAN_Err ret = qr_decompose_pool(m, n, A, lda, tau, pool);
+    thread_pool_destroy(pool);
+    return ret;
+}
+
+GAUSSIAN_Err qr_apply_qt(size_t m, size_t n, const double *QR, size_t lda, const double *tau,
+                         size_t nrhs, double *B, size_t ldb, size_t nthreads) {
+    if (!qr_args_ok(m, n, QR, lda, tau) || !B || ldb < nrhs) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0 || nrhs == 0) return GAUSSIAN_SUCCESS;
+    QrWork ws;
+    ThreadPool *pool = NULL;
+    if (!qr_work_alloc(&ws, m, nrhs)) return GAUSSIAN_NO_MEMORY;
+    if (nthreads != 1 && !(pool = thread_pool_create(nthreads))) {
+        qr_work_free(&ws);
+        return GAUSSIAN_NO_MEMORY;
+    }
+    GAUSSIAN_Err ret = qr_apply_qt_ws(m, n, QR, lda, tau, nrhs, B, ldb, &ws, pool);
+    thread_pool_destroy(pool);
+    qr_work_free(&ws);
+    return ret;
+}
+
+/* Q [I; 0]：各块按逆序作用；块 j0 只影响第 j0 行起、第 j0 列起的部分 */
+GAUSSIAN_Err qr_form_q_pool(size_t m, size_t n, const double *QR, size_t lda, const double *tau,
+                            double *Q, size_t ldq, ThreadPool *pool) {
+    if (!qr_args_ok(m, n, QR, lda, tau) || !Q || ldq < n) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0) return GAUSSIAN_SUCCESS;
+    QrWork ws;
+    if (!qr_work_alloc(&ws, m, n)) return GAUSSIAN_NO_MEMORY;
+    for (size_t i = 0; i < m; ++i) {
+        memset(&Q[IDX(i,0,ldq)], 0, n * sizeof(double));
+        if (i < n) Q[IDX(i,i,ldq)] = 1.0;
+    }
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    const size_t nblk = (n + GAUSSIAN_QR_NB - 1) / GAUSSIAN_QR_NB;
+    for (size_t b = nblk; b-- > 0 && ret == GAUSSIAN_SUCCESS;) {
+        const size_t j0 = b * GAUSSIAN_QR_NB;
+        const size_t jb = (n - j0 < GAUSSIAN_QR_NB) ? n - j0 : GAUSSIAN_QR_NB;
+        ret = qr_build_vt(m - j0, jb, &QR[IDX(j0,j0,lda)], lda, &tau[j0], &ws, pool);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = qr_larfb(0, m - j0, n - j0, jb, &Q[IDX(j0,j0,ldq)], ldq, &ws, pool);
+    }
+    qr_work_free(&ws);
+    return ret;
+}
+
+GAUSSIAN_Err qr_form_q(size_t m, size_t n, const double *QR, size_t lda, const double *tau,
+                       double *Q, size_t ldq, size_t nthreads) {
+    if (!qr_args_ok(m, n, QR, lda, tau) || !Q || ldq < n) return GAUSSIAN_INVALID_INPUT;
+    if (n == 0) return GAUSSIAN_SUCCESS;
+    ThreadPool *pool = NULL;
+    if (nthreads != 1 && !(pool = thread_pool_create(nthreads))) return GAUSSIAN_NO_MEMORY;
+    GAUSSIAN_Err ret = qr_form_q_pool(m, n, QR, lda, tau, Q, ldq, pool);
+    thread_pool_destroy(pool);
+    return ret;
+}
+
+/* ------------------ 最小二乘 ------------------ */
+typedef struct {
+    size_t m, n, nrhs, nblk;
+    double *A, *B;
+    size_t lda, ldb;
+    double *S, *Sb;         /* 叠起来的 R（nblk n x n）与右端（nblk n x nrhs） */
+    GAUSSIAN_Err *err;
+} TsqrJob;
+
+/* 行块 [b0, b1)：各自 QR、变换右端，R 与右端前 n 行放入叠块的对应段 */
+static void tsqr_leaf_range(void *ctx, size_t b0, size_t b1) {
+    TsqrJob *job = (TsqrJob*)ctx;
+    const size_t n = job->n, nrhs = job->nrhs;
+    const size_t rmax = job->m / job->nblk + 1;
+    double *tau = (double*)malloc(n * sizeof(double));
+    QrWork ws;
+    if (!tau || !qr_work_alloc(&ws, rmax, n > nrhs ? n : nrhs)) {
+        for (size_t w = b0; w < b1; ++w) job->err[w] = GAUSSIAN_NO_MEMORY;
+        free(tau);
+        return;
+    }
+    for (size_t w = b0; w < b1; ++w) {
+        const size_t r0 = w * job->m / job->nblk, r1 = (w + 1) * job->m / job->nblk;
+        double *A = &job->A[IDX(r0,0,job->lda)], *B = &job->B[IDX(r0,0,job->ldb)];
+        GAUSSIAN_Err ret = qr_factor_ws(r1 - r0, n, A, job->lda, tau, &ws, NULL);
+        if (ret == GAUSSIAN_SUCCESS)
+            ret = qr_apply_qt_ws(r1 - r0, n, A, job->lda, tau, nrhs, B, job->ldb, &ws, NULL);
+        job->err[w] = ret;
+        if (ret != GAUSSIAN_SUCCESS) continue;
+        for (size_t i = 0; i < n; ++i) {
+            double *s = &job->S[IDX(w * n + i,0,n)];
+            memset(s, 0, i * sizeof(double));
+            memcpy(&s[i], &A[IDX(i,i,job->lda)], (n - i) * sizeof(double));
+            memcpy(&job->Sb[IDX(w * n + i,0,nrhs)], &B[IDX(i,0,job->ldb)], nrhs * sizeof(double));
+        }
+    }
+    qr_work_free(&ws);
+    free(tau);
+}
+
+/* 行块数：至少每线程一块，且每块不超过 GAUSSIAN_QR_TSQR_LEAF 字节（块内 QR 在缓存中完成）；
+ * 每块至少 GAUSSIAN_QR_TSQR_RATIO * n 行，不足两块时返回 1（直接法） */
+static size_t tsqr_blocks(size_t m, size_t n, size_t p) {
+    size_t nblk = (size_t)(((double)m * (double)n * sizeof(double) + GAUSSIAN_QR_TSQR_LEAF - 1)
+                           / GAUSSIAN_QR_TSQR_LEAF);
+    size_t maxblk = m / (GAUSSIAN_QR_TSQR_RATIO * n);
+    if (nblk < p) nblk = p;
+    if (nblk > maxblk) nblk = maxblk;
+    return nblk < 2 ? 1 : nblk;
+}
+
+static GAUSSIAN_Err qr_lstsq_pool(size_t m, size_t n, double *A, size_t lda,
+                                  size_t nrhs, double *B, size_t ldb,
+                                  double *X, size_t ldx, ThreadPool *pool) {
+    const size_t nblk = tsqr_blocks(m, n, thread_pool_size(pool));
+
+    /* 直接法：就地 QR，R 与 Q^T B 都在 A / B 中 */
+    if (nblk == 1) {
+        QrWork ws;
+        double *tau = (double*)malloc(n * sizeof(double));
+        GAUSSIAN_Err ret = GAUSSIAN_NO_MEMORY;
+        if (tau && qr_work_alloc(&ws, m, n > nrhs ? n : nrhs)) {
+            ret = qr_factor_ws(m, n, A, lda, tau, &ws, pool);
+            if (ret == GAUSSIAN_SUCCESS)
+                ret = qr_apply_qt_ws(m, n, A, lda, tau, nrhs, B, ldb, &ws, pool);
+            qr_work_free(&ws);
+        }
+        free(tau);
+        if (ret != GAUSSIAN_SUCCESS) return ret;
+        for (size_t i = 0; i < n; ++i)
+            memcpy(&X[IDX(i,0,ldx)], &B[IDX(i,0,ldb)], nrhs * sizeof(double));
+        TriMatrix R = tri_view(n, A, lda, TRI_UPPER, TRI_NON_UNIT);
+        return tri_solve(&R, nrhs, X, ldx);
+    }
+
+    /* TSQR：各行块并行分解，叠起来的 nblk 个 R（nblk n <= m / RATIO 行）递归求解 */
+    TsqrJob job;
+    job.m = m; job.n = n; job.nrhs = nrhs; job.nblk = nblk;
+    job.A = A; job.B = B; job.lda = lda; job.ldb = ldb;
+    job.S = (double*)malloc(nblk * n * n * sizeof(double));
+    job.Sb = (double*)malloc(nblk * n * nrhs * sizeof(double));
+    job.err = (GAUSSIAN_Err*)malloc(nblk * sizeof(GAUSSIAN_Err));
+    GAUSSIAN_Err ret = GAUSSIAN_NO_MEMORY;
+    if (job.S && job.Sb && job.err) {
+        thread_pool_parallel_for(pool, nblk, 1, tsqr_leaf_range, &job);
+        ret = GAUSSIAN_SUCCESS;
+        for (size_t w = 0; w < nblk && ret == GAUSSIAN_SUCCESS; ++w) ret = job.err[w];
+    }
+    if (ret == GAUSSIAN_SUCCESS)
+        ret = qr_lstsq_pool(nblk * n, n, job.S, n, nrhs, job.Sb, nrhs, X, ldx, pool);
+    free(job.S); free(job.Sb); free(job.err);
+    return ret;
+}
+
+GAUSSIAN_Err qr_lstsq(size_t m, size_t n, double *A, size_t lda,
+                      size_t nrhs, double *B, size_t ldb,
+                      double *X, size_t ldx, size_t nthreads) {
+    if (!A || !B || !X || m < n || lda < n || ldb < nrhs || ldx < nrhs)
+        return GAUSSIAN_INVALID_INPUT;
+    if (n == 0 || nrhs == 0) return GAUSSIAN_SUCCESS;
+    ThreadPool *pool = NULL;
+    if (nthreads != 1 && !(pool = thread_pool_create(nthreads))) return GAUSSIAN_NO_MEMORY;
+    GAUSSIAN_Err ret = qr_lstsq_pool(m, n, A, lda, nrhs, B, ldb, X, ldx, pool);
+    thread_pool_destroy(pool);
+    return ret;
+}
@@ -0,0 +1,283 @@
+#include "gaussian_simd.h"
+
+#include <math.h>
+#include <stdatomic.h>
+
+#ifdef GAUSSIAN_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/* ------------------ 标量核（与原有循环逐位一致） ------------------ */
+static void axpy_scalar(size_t len, double a, const double *x, double *y) {
+    for (size_t j = 0; j < len; ++j)
+        y[j] -= a * x[j];
+}
+
+static void axpy4_scalar(size_t len, const double a[4], const double *x,
+                         double *y0, double *y1, double *y2, double *y3) {
+    const double a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    for (size_t j = 0; j < len; ++j) {
+        double xj = x[j];
+        y0[j] -= a0 * xj; y1[j] -= a1 * xj;
+        y2[j] -= a2 * xj; y3[j] -= a3 * xj;
+    }
+}
+
+static void saxpy_scalar(size_t len, float a, const float *x, float *y) {
+    for (size_t j = 0; j < len; ++j)
+        y[j] -= a * x[j];
+}
+
+static void saxpy4_scalar(size_t len, const float a[4], const float *x,
+                          float *y0, float *y1, float *y2, float *y3) {
+    const float a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    for (size_t j = 0; j < len; ++j) {
+        float xj = x[j];
+        y0[j] -= a0 * xj; y1[j] -= a1 * xj;
+        y2[j] -= a2 * xj; y3[j] -= a3 * xj;
+    }
+}
+
+static const GaussianKernels kernels_scalar = {
+    GAUSSIAN_SIMD_SCALAR, "scalar", axpy_scalar, axpy4_scalar,
+    saxpy_scalar, saxpy4_scalar
+};
+
+#ifdef GAUSSIAN_SIMD_X86
+/* ------------------ AVX2 + FMA ------------------ */
+/* 尾部同样用 fma，保证同一元素无论落在向量段还是尾部结果都相同 */
+GAUSSIAN_TARGET_AVX2
+static void axpy_avx2(size_t len, double a, const double *x, double *y) {
+    const __m256d va = _mm256_set1_pd(a);
+    size_t j = 0;
+    for (; j + 8 <= len; j += 8) {
+        __m256d y0 = _mm256_loadu_pd(y + j), y1 = _mm256_loadu_pd(y + j + 4);
+        y0 = _mm256_fnmadd_pd(va, _mm256_loadu_pd(x + j), y0);
+        y1 = _mm256_fnmadd_pd(va, _mm256_loadu_pd(x + j + 4), y1);
+        _mm256_storeu_pd(y + j, y0);
+        _mm256_storeu_pd(y + j + 4, y1);
+    }
+    for (; j + 4 <= len; j += 4)
+        _mm256_storeu_pd(y + j, _mm256_fnmadd_pd(va, _mm256_loadu_pd(x + j),
+                                                 _mm256_loadu_pd(y + j)));
+    for (; j < len; ++j) y[j] = fma(-a, x[j], y[j]);
+}
+
+GAUSSIAN_TARGET_AVX2
+static void axpy4_avx2(size_t len, const double a[4], const double *x,
+                       double *y0, double *y1, double *y2, double *y3) {
+    const __m256d a0 = _mm256_set1_pd(a[0]), a1 = _mm256_set1_pd(a[1]);
+    const __m256d a2 = _mm256_set1_pd(a[2]), a3 = _mm256_set1_pd(a[3]);
+    size_t j = 0;
+    for (; j + 4 <= len; j += 4) {
+        __m256d xv = _mm256_loadu_pd(x + j);
+        _mm256_storeu_pd(y0 + j, _mm256_fnmadd_pd(a0, xv, _mm256_loadu_pd(y0 + j)));
+        _mm256_storeu_pd(y1 + j, _mm256_fnmadd_pd(a1, xv, _mm256_loadu_pd(y1 + j)));
+        _mm256_storeu_pd(y2 + j, _mm256_fnmadd_pd(a2, xv, _mm256_loadu_pd(y2 + j)));
+        _mm256_storeu_pd(y3 + j, _mm256_fnmadd_pd(a3, xv, _mm256_loadu_pd(y3 + j)));
+    }
+    for (; j < len; ++j) {
+        double xj = x[j];
+        y0[j] = fma(-a[0], xj, y0[j]); y1[j] = fma(-a[1], xj, y1[j]);
+        y2[j] = fma(-a[2], xj, y2[j]); y3[j] = fma(-a[3], xj, y3[j]);
+    }
+}
+
+GAUSSIAN_TARGET_AVX2
+static void saxpy_avx2(size_t len, float a, const float *x, float *y) {
+    const __m256 va = _mm256_set1_ps(a);
+    size_t j = 0;
+    for (; j + 16 <= len; j += 16) {
+        __m256 y0 = _mm256_loadu_ps(y + j), y1 = _mm256_loadu_ps(y + j + 8);
+        y0 = _mm256_fnmadd_ps(va, _mm256_loadu_ps(x + j), y0);
+        y1 = _mm256_fnmadd_ps(va, _mm256_loadu_ps(x + j + 8), y1);
+        _mm256_storeu_ps(y + j, y0);
+        _mm256_storeu_ps(y + j + 8, y1);
+    }
+    for (; j + 8 <= len; j += 8)
+        _mm256_storeu_ps(y + j, _mm256_fnmadd_ps(va, _mm256_loadu_ps(x + j),
+                                                 _mm256_loadu_ps(y + j)));
+    for (; j < len; ++j) y[j] = fmaf(-a, x[j], y[j]);
+}
+
+GAUSSIAN_TARGET_AVX2
+static void saxpy4_avx2(size_t len, const float a[4], const float *x,
+                        float *y0, float *y1, float *y2, float *y3) {
+    const __m256 a0 = _mm256_set1_ps(a[0]), a1 = _mm256_set1_ps(a[1]);
+    const __m256 a2 = _mm256_set1_ps(a[2]), a3 = _mm256_set1_ps(a[3]);
+    size_t j = 0;
+    for (; j + 8 <= len; j += 8) {
+        __m256 xv = _mm256_loadu_ps(x + j);
+        _mm256_storeu_ps(y0 + j, _mm256_fnmadd_ps(a0, xv, _mm256_loadu_ps(y0 + j)));
+        _mm256_storeu_ps(y1 + j, _mm256_fnmadd_ps(a1, xv, _mm256_loadu_ps(y1 + j)));
+        _mm256_storeu_ps(y2 + j, _mm256_fnmadd_ps(a2, xv, _mm256_loadu_ps(y2 + j)));
+        _mm256_storeu_ps(y3 + j, _mm256_fnmadd_ps(a3, xv, _mm256_loadu_ps(y3 + j)));
+    }
+    for (; j < len; ++j) {
+        float xj = x[j];
+        y0[j] = fmaf(-a[0], xj, y0[j]); y1[j] = fmaf(-a[1], xj, y1[j]);
+        y2[j] = fmaf(-a[2], xj, y2[j]); y3[j] = fmaf(-a[3], xj, y3[j]);
+    }
+}
+
+/* ------------------ AVX-512F ------------------ */
+GAUSSIAN_TARGET_AVX512
+static void axpy_avx512(size_t len, double a, const double *x, double *y) {
+    const __m512d va = _mm512_set1_pd(a);
+    size_t j = 0;
+    for (; j + 16 <= len; j += 16) {
+        __m512d y0 = _mm512_loadu_pd(y + j), y1 = _mm512_loadu_pd(y + j + 8);
+        y0 = _mm512_fnmadd_pd(va, _mm512_loadu_pd(x + j), y0);
+        y1 = _mm512_fnmadd_pd(va, _mm512_loadu_pd(x + j + 8), y1);
+        _mm512_storeu_pd(y + j, y0);
+        _mm512_storeu_pd(y + j + 8, y1);
+    }
+    if (j < len) {   /* 掩码处理剩余 1..15 个元素 */
+        for (; j < len; j += 8) {
+            size_t rem = len - j;
+            __mmask8 m = (__mmask8)(rem >= 8 ? 0xFF : (1u << rem) - 1u);
+            __m512d yv = _mm512_maskz_loadu_pd(m, y + j);
+            yv = _mm512_fnmadd_pd(va, _mm512_maskz_loadu_pd(m, x + j), yv);
+            _mm512_mask_storeu_pd(y + j, m, yv);
+        }
+    }
+}
+
+GAUSSIAN_TARGET_AVX512
+static void axpy4_avx512(size_t len, const double a[4], const double *x,
+                         double *y0, double *y1, double *y2, double *y3) {
+    const __m512d a0 = _mm512_set1_pd(a[0]), a1 = _mm512_set1_pd(a[1]);
+    const __m512d a2 = _mm512_set1_pd(a[2]), a3 = _mm512_set1_pd(a[3]);
+    for (size_t j = 0; j < len; j += 8) {
+        size_t rem = len - j;
+        __mmask8 m = (__mmask8)(rem >= 8 ? 0xFF : (1u << rem) - 1u);
+        __m512d xv = _mm512_maskz_loadu_pd(m, x + j);
+        _mm512_mask_storeu_pd(y0 + j, m, _mm512_fnmadd_pd(a0, xv, _mm512_maskz_loadu_pd(m, y0 + j)));
+        _mm512_mask_storeu_pd(y1 + j, m, _mm512_fnmadd_pd(a1, xv, _mm512_maskz_loadu_pd(m, y1 + j)));
+        _mm512_mask_storeu_pd(y2 + j, m, _mm512_fnmadd_pd(a2, xv, _mm512_maskz_loadu_pd(m, y2 + j)));
+        _mm512_mask_storeu_pd(y3 + j, m, _mm512_fnmadd_pd(a3, xv, _mm512_maskz_loadu_pd(m, y3 + j)));
+    }
+}
+
+GAUSSIAN_TARGET_AVX512
+static void saxpy_avx512(size_t len, float a, const float *x, float *y) {
+    const __m512 va = _mm512_set1_ps(a);
+    size_t j = 0;
+    for (; j + 32 <= len; j += 32) {
+        __m512 y0 = _mm512_loadu_ps(y + j), y1 = _mm512_loadu_ps(y + j + 16);
+        y0 = _mm512_fnmadd_ps(va, _mm512_loadu_ps(x + j), y0);
+        y1 = _mm512_fnmadd_ps(va, _mm512_loadu_ps(x + j + 16), y1);
+        _mm512_storeu_ps(y + j, y0);
+        _mm512_storeu_ps(y + j + 16, y1);
+    }
+    for (; j < len; j += 16) {   /* 掩码处理剩余 1..31 个元素 */
+        size_t rem = len - j;
+        __mmask16 m = (__mmask16)(rem >= 16 ? 0xFFFF : (1u << rem) - 1u);
+        __m512 yv = _mm512_maskz_loadu_ps(m, y + j);
+        yv = _mm512_fnmadd_ps(va, _mm512_maskz_loadu_ps(m, x + j), yv);
+        _mm512_mask_storeu_ps(y + j, m, yv);
+    }
+}
+
+GAUSSIAN_TARGET_AVX512
+static void saxpy4_avx512(size_t len, const float a[4], const float *x,
+                          float *y0, float *y1, float *y2, float *y3) {
+    const __m512 a0 = _mm512_set1_ps(a[0]), a1 = _mm512_set1_ps(a[1]);
+    const __m512 a2 = _mm512_set1_ps(a[2]), a3 = _mm512_set1_ps(a[3]);
+    for (size_t j = 0; j < len; j += 16) {
+        size_t rem = len - j;
+        __mmask16 m = (__mmask16)(rem >= 16 ? 0xFFFF : (1u << rem) - 1u);
+        __m512 xv = _mm512_maskz_loadu_ps(m, x + j);
+        _mm512_mask_storeu_ps(y0 + j, m, _mm512_fnmadd_ps(a0, xv, _mm512_maskz_loadu_ps(m, y0 + j)));
+        _mm512_mask_storeu_ps(y1 + j, m, _mm512_fnmadd_ps(a1, xv, _mm512_maskz_loadu_ps(m, y1 + j)));
+        _mm512_mask_storeu_ps(y2 + j, m, _mm512_fnmadd_ps(a2, xv, _mm512_maskz_loadu_ps(m, y2 + j)));
+        _mm512_mask_storeu_ps(y3 + j, m, _mm512_fnmadd_ps(a3, xv, _mm512_maskz_loadu_ps(m, y3 + j)));
+    }
+}
+
+static const GaussianKernels kernels_avx2 = {
+    GAUSSIAN_SIMD_AVX2, "avx2+fma", axpy_avx2, axpy4_avx2,
+    saxpy_avx2, saxpy4_avx2
+};
+static const GaussianKernels kernels_avx512 = {
+    GAUSSIAN_SIMD_AVX512, "avx512f", axpy_avx512, axpy4_avx512,
+    saxpy_avx512, saxpy4_avx512
+};
+
+/* ------------------ CPUID / XGETBV 检测 ------------------ */
+static void cpuid_ex(unsigned leaf, unsigned sub, unsigned r[4]) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuidex(regs, (int)leaf, (int)sub);
+    for (int i = 0; i < 4; ++i) r[i] = (unsigned)regs[i];
+#else
+    __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+static unsigned long long read_xcr0(void) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    unsigned lo, hi;
+    __asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((unsigned long long)hi << 32) | lo;
+#endif
+}
+
+GaussianSimdLevel gaussian_simd_detect(void) {
+    unsigned r[4];
+    cpuid_ex(0, 0, r);
+    if (r[0] < 7) return GAUSSIAN_SIMD_SCALAR;
+
+    cpuid_ex(1, 0, r);
+    const int osxsave = (r[2] >> 27) & 1, fma3 = (r[2] >> 12) & 1;
+    if (!osxsave || !fma3) return GAUSSIAN_SIMD_SCALAR;
+    const unsigned long long xcr0 = read_xcr0();
+    if ((xcr0 & 0x6) != 0x6) return GAUSSIAN_SIMD_SCALAR;     /* XMM|YMM 状态 */
+
+    cpuid_ex(7, 0, r);
+    const int avx2 = (r[1] >> 5) & 1, avx512f = (r[1] >> 16) & 1;
+    if (!avx2) return GAUSSIAN_SIMD_SCALAR;
+    if (avx512f && (xcr0 & 0xE6) == 0xE6) return GAUSSIAN_SIMD_AVX512;  /* opmask|ZMM */
+    return GAUSSIAN_SIMD_AVX2;
+}
+#else
+GaussianSimdLevel gaussian_simd_detect(void) {
+    return GAUSSIAN_SIMD_SCALAR;
+}
+#endif
+
+static const GaussianKernels *kernels_for(GaussianSimdLevel level) {
+#ifdef GAUSSIAN_SIMD_X86
+    if (level >= GAUSSIAN_SIMD_AVX512) return &kernels_avx512;
+    if (level == GAUSSIAN_SIMD_AVX2) return &kernels_avx2;
+#endif
+    (void)level;
+    return &kernels_scalar;
+}
+
+static _Atomic(const GaussianKernels *) active_kernels = NULL;
+
+const GaussianKernels *gaussian_kernels(void) {
+    const GaussianKernels *k = atomic_load_explicit(&active_kernels, memory_order_acquire);
+    if (!k) {
+        /* 并发首次调用会得到同一结果，重复写入无害 */
+        k = kernels_for(gaussian_simd_detect());
+        atomic_store_explicit(&active_kernels, k, memory_order_release);
+    }
+    return k;
+}
+
+GaussianSimdLevel gaussian_simd_set_level(GaussianSimdLevel level) {
+    GaussianSimdLevel cap = gaussian_simd_detect();
+    if (level > cap) level = cap;
+    const GaussianKernels *k = kernels_for(level);
+    atomic_store_explicit(&active_kernels, k, memory_order_release);
+    return k->level;
+}
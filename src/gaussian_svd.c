@@ -0,0 +1,390 @@
+#include "gaussian_svd.h"
+#include "gaussian_gemm.h"
+#include "gaussian_qr.h"
+#include "gaussian_tri.h"
+#include "thread_pool.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef GAUSSIAN_SVD_MT_MIN_N
+#define GAUSSIAN_SVD_MT_MIN_N 128     /* 行数低于此值时每轮的行对太少，不进线程池 */
+#endif
+
+/* ------------------ 单边 Jacobi 核心 ------------------ */
+typedef struct {
+    size_t n;
+    double *G;                  /* n x n，行为被正交化的向量 */
+    double *Jt;                 /* n x n 累积旋转，可为 NULL */
+    double tol;
+    double tol_rest;            /* 截断时两行都不在 top 中的行对的阈值 */
+    const size_t *pi, *pj;      /* 本轮的行对 */
+    const unsigned char *top;   /* 截断：扫描开始时范数最大的 k 行 */
+    double *gersh;              /* 非 top 行之间 |g_i . g_j| 的累加 */
+    unsigned char *rot;         /* 每个行对：1 = 旋转，2 = 旋转且涉及 top 行 */
+} SvdRoundCtx;
+
+/* 行对 (i, j)：一遍求 |g_i|^2、|g_j|^2、g_i . g_j，超过阈值则旋转 G 与 Jt 的两行 */
+static void svd_round_range(void *arg, size_t b, size_t e) {
+    SvdRoundCtx *c = (SvdRoundCtx*)arg;
+    const size_t n = c->n;
+    for (size_t q = b; q < e; ++q) {
+        const size_t i = c->pi[q], j = c->pj[q];
+        double *gi = &c->G[IDX(i,0,n)], *gj = &c->G[IDX(j,0,n)];
+        double a0 = 0.0, a1 = 0.0, b0 = 0.0, b1 = 0.0, p0 = 0.0, p1 = 0.0;
+        size_t t = 0;
+        for (; t + 2 <= n; t += 2) {
+            a0 += gi[t] * gi[t];         a1 += gi[t + 1] * gi[t + 1];
+            b0 += gj[t] * gj[t];         b1 += gj[t + 1] * gj[t + 1];
+            p0 += gi[t] * gj[t];         p1 += gi[t + 1] * gj[t + 1];
+        }
+        if (t < n) { a0 += gi[t] * gi[t]; b0 += gj[t] * gj[t]; p0 += gi[t] * gj[t]; }
+        const double aa = a0 + a1, bb = b0 + b1, ab = p0 + p1;
+        double tol = c->tol;
+        c->rot[q] = 0;
+        if (c->top && !c->top[i] && !c->top[j]) {
+            /* 两行都不在 top 中：旋转不改变它们张成的子空间，也就不影响 top 行的收敛，
+             * 只需正交到足以给出 Gershgorin 估计 */
+            c->gersh[i] += fabs(ab);
+            c->gersh[j] += fabs(ab);
+            tol = c->tol_rest;
+        }
+        if (aa == 0.0 || bb == 0.0) continue;
+        if (c->top && c->top[i] != c->top[j]) {
+            /* top 行与其余行：看旋转角 ~ |g_i . g_j| / max(|g|^2)，小行里残留的舍入噪声
+             * 不再迫使 top 行反复旋转；top 三元组的误差仍为 tol * s_i 量级 */
+            if (fabs(ab) <= tol * (aa > bb ? aa : bb)) continue;
+        } else if (fabs(ab) <= tol * sqrt(aa) * sqrt(bb)) {
+            continue;
+        }
+
+        const double zeta = (bb - aa) / (2.0 * ab);
+        const double tn = copysign(1.0, zeta) / (fabs(zeta) + hypot(1.0, zeta));
+        const double cs = 1.0 / sqrt(1.0 + tn * tn), sn = cs * tn;
+        for (size_t r = 0; r < n; ++r) {
+            const double x = gi[r], y = gj[r];
+            gi[r] = cs * x - sn * y;
+            gj[r] = sn * x + cs * y;
+        }
+        if (c->Jt) {
+            double *ji = &c->Jt[IDX(i,0,n)], *jj = &c->Jt[IDX(j,0,n)];
+            for (size_t r = 0; r < n; ++r) {
+                const double x = ji[r], y = jj[r];
+                ji[r] = cs * x - sn * y;
+                jj[r] = sn * x + cs * y;
+            }
+        }
+        c->rot[q] = (c->top && (c->top[i] || c->top[j])) ? 2 : 1;
+    }
+}
+
+static double svd_row_norm2(size_t n, const double *g) {
+    double s = 0.0;
+    for (size_t t = 0; t < n; ++t) s += g[t] * g[t];
+    return s;
+}
+
+typedef struct {
+    double d;
+    size_t idx;
+} SvdOrder;
+
+/* 范数降序，相同时按下标 */
+static int svd_cmp_order(const void *a, const void *b) {
+    const SvdOrder *x = (const SvdOrder*)a, *y = (const SvdOrder*)b;
+    if (x->d != y->d) return x->d > y->d ? -1 : 1;
+    return (x->idx > y->idx) - (x->idx < y->idx);
+}
+
+static void svd_sort_rows(size_t n, const double *G, SvdOrder *ord) {
+    for (size_t i = 0; i < n; ++i) {
+        ord[i].d = svd_row_norm2(n, &G[IDX(i,0,n)]);
+        ord[i].idx = i;
+    }
+    qsort(ord, n, sizeof(SvdOrder), svd_cmp_order);
+}
+
+/* G 的行两两正交化（k < n 时只要求最大的 k 行收敛），ord 返回按范数降序的行序 */
+static GAUSSIAN_Err svd_jacobi_rows(size_t n, double *G, double *Jt, size_t k, double tol,
+                                    size_t max_sweeps, ThreadPool *pool, SvdOrder *ord,
+                                    SvdStatus *st) {
+    const size_t np = n + (n & 1), half = np / 2;   /* n 为奇数时补一个轮空位 n */
+    size_t *pos = (size_t*)malloc(np * sizeof(size_t));
+    size_t *pi = (size_t*)malloc(half * sizeof(size_t));
+    size_t *pj = (size_t*)malloc(half * sizeof(size_t));
+    unsigned char *rot = (unsigned char*)malloc(half);
+    unsigned char *top = k < n ? (unsigned char*)malloc(n) : NULL;
+    double *gersh = k < n ? (double*)malloc(n * sizeof(double)) : NULL;
+    GAUSSIAN_Err ret = GAUSSIAN_NOT_CONVERGED;
+    st->sweeps = st->rotations = 0;
+    if (!pos || !pi || !pj || !rot || (k < n && (!top || !gersh))) {
+        ret = GAUSSIAN_NO_MEMORY;
+        goto cleanup;
+    }
+    if (n < 2) {
+        svd_sort_rows(n, G, ord);
+        ret = GAUSSIAN_SUCCESS;
+        goto cleanup;
+    }
+    if (n < GAUSSIAN_SVD_MT_MIN_N) pool = NULL;
+
+    SvdRoundCtx ctx = { n, G, Jt, tol, sqrt(tol), pi, pj, top, gersh, rot };
+    while (st->sweeps < max_sweeps) {
+        st->sweeps++;
+        if (top) {
+            svd_sort_rows(n, G, ord);
+            memset(top, 0, n);
+            for (size_t c = 0; c < k; ++c) top[ord[c].idx] = 1;
+            memset(gersh, 0, n * sizeof(double));
+        }
+        size_t nrot = 0, ntop = 0;
+        /* 循环赛：0 号位固定，其余 np - 1 个位置每轮轮转一格；位置 q 与 np - 1 - q 配对 */
+        for (size_t r = 0; r + 1 < np; ++r) {
+            pos[0] = 0;
+            for (size_t t = 1; t < np; ++t) pos[t] = 1 + (t - 1 + r) % (np - 1);
+            size_t npair = 0;
+            for (size_t q = 0; q < half; ++q) {
+                size_t i = pos[q], j = pos[np - 1 - q];
+                if (i >= n || j >= n) continue;
+                pi[npair] = i < j ? i : j;
+                pj[npair] = i < j ? j : i;
+                ++npair;
+            }
+            thread_pool_parallel_for(pool, npair, 1, svd_round_range, &ctx);
+            for (size_t q = 0; q < npair; ++q) {
+                nrot += rot[q] != 0;
+                ntop += rot[q] == 2;
+            }
+        }
+        st->rotations += nrot;
+        if (nrot == 0) { ret = GAUSSIAN_SUCCESS; break; }
+        if (top && ntop == 0) {
+            /* top 行已与其余各行正交：排名不变，且其余部分的最大奇异值
+             * （Gershgorin：d_i + sum_j |g_i . g_j|）不超过第 k 大的范数 */
+            svd_sort_rows(n, G, ord);
+            int same = 1;
+            for (size_t c = 0; c < k && same; ++c) same = top[ord[c].idx];
+            double rest = 0.0;
+            for (size_t c = k; c < n; ++c) {
+                double b = ord[c].d + gersh[ord[c].idx];
+                if (b > rest) rest = b;
+            }
+            if (same && rest <= ord[k - 1].d) { ret = GAUSSIAN_SUCCESS; break; }
+        }
+    }
+    svd_sort_rows(n, G, ord);
+
+cleanup:
+    free(pos); free(pi); free(pj); free(rot); free(top); free(gersh);
+    return ret;
+}
+
+/* ------------------ 公共接口 ------------------ */
+void svd_options_default(SvdOptions *opts) {
+    if (!opts) return;
+    opts->k = 0;
+    opts->tol = 0.0;
+    opts->max_sweeps = 30;
+    opts->nthreads = 0;
+}
+
+static double svd_default_tol(size_t n) {
+    return (double)(n > 16 ? n : 16) * DBL_EPSILON;
+}
+
+GAUSSIAN_Err svd_jacobi(size_t m, size_t n, const double *A, size_t lda, double *s,
+                        double *U, size_t ldu, double *V, size_t ldv,
+                        const SvdOptions *opts, SvdStatus *status) {
+    SvdOptions o;
+    if (opts) o = *opts; else svd_options_default(&o);
+    const size_t k = o.k ? o.k : n;
+    if (!A || !s || n == 0 || m < n || lda < n || k > n || !(o.tol >= 0.0)
+        || o.max_sweeps == 0 || (U && ldu < m) || (V && ldv < n))
+        return GAUSSIAN_INVALID_INPUT;
+    const double tol = o.tol > 0.0 ? o.tol : svd_default_tol(n);
+
+    double *W = (double*)malloc(m * n * sizeof(double));
+    double *tau = (double*)malloc(n * sizeof(double));
+    double *G = (double*)calloc(n * n, sizeof(double));
+    double *Jt = U ? (double*)calloc(n * n, sizeof(double)) : NULL;
+    double *Q = U ? (double*)malloc(m * n * sizeof(double)) : NULL;
+    SvdOrder *ord = (SvdOrder*)malloc(n * sizeof(SvdOrder));
+    ThreadPool *pool = NULL;
+    SvdStatus st = { 0, 0 };
+    GAUSSIAN_Err ret = GAUSSIAN_NO_MEMORY;
+    if (!W || !tau || !G || !ord || (U && (!Jt || !Q))) goto cleanup;
+    if (o.nthreads != 1 && n >= GAUSSIAN_SVD_MT_MIN_N && !(pool = thread_pool_create(o.nthreads)))
+        goto cleanup;
+
+    for (size_t i = 0; i < m; ++i) memcpy(&W[IDX(i,0,n)], &A[IDX(i,0,lda)], n * sizeof(double));
+    ret = qr_decompose(m, n, W, n, tau, o.nthreads);
+    if (ret == GAUSSIAN_SUCCESS && U) ret = qr_form_q(m, n, W, n, tau, Q, n, o.nthreads);
+    if (ret != GAUSSIAN_SUCCESS) goto cleanup;
+    for (size_t i = 0; i < n; ++i) {
+        memcpy(&G[IDX(i,i,n)], &W[IDX(i,i,n)], (n - i) * sizeof(double));
+        if (Jt) Jt[IDX(i,i,n)] = 1.0;
+    }
+
+    ret = svd_jacobi_rows(n, G, Jt, k, tol, o.max_sweeps, pool, ord, &st);
+    if (ret != GAUSSIAN_SUCCESS && ret != GAUSSIAN_NOT_CONVERGED) goto cleanup;
+    for (size_t c = 0; c < k; ++c) s[c] = sqrt(ord[c].d);
+    if (V) {
+        for (size_t c = 0; c < k; ++c) {
+            double *v = &V[IDX(c,0,ldv)];
+            if (s[c] > 0.0) {
+                const double *g = &G[IDX(ord[c].idx,0,n)];
+                for (size_t t = 0; t < n; ++t) v[t] = g[t] / s[c];
+                continue;
+            }
+            /* 零奇异值：取与前面各行正交的单位向量（对 e_j 做两遍 Gram-Schmidt） */
+            for (size_t j = 0; j < n; ++j) {
+                memset(v, 0, n * sizeof(double));
+                v[j] = 1.0;
+                for (int pass = 0; pass < 2; ++pass)
+                    for (size_t p = 0; p < c; ++p) {
+                        const double *vp = &V[IDX(p,0,ldv)];
+                        double d = 0.0;
+                        for (size_t t = 0; t < n; ++t) d += vp[t] * v[t];
+                        for (size_t t = 0; t < n; ++t) v[t] -= d * vp[t];
+                    }
+                double nv = sqrt(svd_row_norm2(n, v));
+                if (nv > 0.5) {
+                    for (size_t t = 0; t < n; ++t) v[t] /= nv;
+                    break;
+                }
+            }
+        }
+    }
+    if (U) {
+        /* U 的第 c 行 = Jt 的第 ord[c] 行乘以 Q^T；先把选中的行按序挪到 G 中 */
+        for (size_t c = 0; c < k; ++c)
+            memcpy(&G[IDX(c,0,n)], &Jt[IDX(ord[c].idx,0,n)], n * sizeof(double));
+        GAUSSIAN_Err e2 = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_TRANS, k, m, n, 1.0, G, n,
+                                             Q, n, 0.0, U, ldu, pool);
+        if (e2 != GAUSSIAN_SUCCESS) ret = e2;
+    }
+
+cleanup:
+    if (status) *status = st;
+    thread_pool_destroy(pool);
+    free(W); free(tau); free(G); free(Jt); free(Q); free(ord);
+    return ret;
+}
+
+/* inv_norm1_est 的回调：R x = b 用 tri_solve；R^T x = b 为下三角，按 R 的行做前代 */
+typedef struct {
+    TriMatrix T;
+    const double *R;
+    size_t n, ldr;
+} SvdRSolveCtx;
+
+static GAUSSIAN_Err svd_r_solve(void *ctx, int trans, const double *b, double *x) {
+    const SvdRSolveCtx *c = (const SvdRSolveCtx*)ctx;
+    memcpy(x, b, c->n * sizeof(double));
+    if (!trans) return tri_solve(&c->T, 1, x, 1);
+    for (size_t j = 0; j < c->n; ++j) {
+        const double *row = &c->R[IDX(j,0,c->ldr)];
+        x[j] /= row[j];
+        for (size_t k = j + 1; k < c->n; ++k) x[k] -= row[k] * x[j];
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err svd_pinv_solve(size_t m, size_t n, double *A, size_t lda,
+                            size_t nrhs, double *B, size_t ldb,
+                            double *X, size_t ldx, double rcond, size_t *rank,
+                            size_t nthreads) {
+    if (!A || !B || !X || n == 0 || m < n || nrhs == 0 || lda < n || ldb < nrhs || ldx < nrhs
+        || !(rcond >= 0.0))
+        return GAUSSIAN_INVALID_INPUT;
+    const double rtol = rcond > 0.0 ? rcond : (double)m * DBL_EPSILON;
+    double *tau = (double*)malloc(n * sizeof(double));
+    double *R = (double*)calloc(n * n, sizeof(double));
+    double *Jt = NULL, *Y = NULL;
+    SvdOrder *ord = NULL;
+    ThreadPool *pool = NULL;
+    GAUSSIAN_Err ret = GAUSSIAN_NO_MEMORY;
+    if (!tau || !R) goto cleanup;
+
+    ret = qr_decompose(m, n, A, lda, tau, nthreads);
+    if (ret == GAUSSIAN_SUCCESS) ret = qr_apply_qt(m, n, A, lda, tau, nrhs, B, ldb, nthreads);
+    if (ret != GAUSSIAN_SUCCESS) goto cleanup;
+    double rnorm = 0.0;
+    for (size_t j = 0; j < n; ++j) {
+        double c = 0.0;
+        for (size_t i = 0; i <= j; ++i) c += fabs(A[IDX(i,j,lda)]);
+        if (c > rnorm) rnorm = c;
+    }
+    for (size_t i = 0; i < n; ++i)
+        memcpy(&R[IDX(i,i,n)], &A[IDX(i,i,lda)], (n - i) * sizeof(double));
+
+    /* 良态：与 qr_lstsq 相同，R X = (Q^T B)(0:n)。
+     * |r_ii| 是 R 的特征值，max|r_ii| / min|r_ii| <= cond(R)：先用它廉价排除明显病态，
+     * 再用 Hager 估计（与 lu_condest 共用 inv_norm1_est）确认 */
+    const double rc_min = 10.0 * (double)n * rtol;
+    double dmax = 0.0, dmin = INFINITY;
+    for (size_t i = 0; i < n; ++i) {
+        const double d = fabs(R[IDX(i,i,n)]);
+        if (d > dmax) dmax = d;
+        if (d < dmin) dmin = d;
+    }
+    double rc = 0.0;
+    if (rnorm > 0.0 && dmin > rc_min * dmax) {
+        SvdRSolveCtx c = { tri_view(n, R, n, TRI_UPPER, TRI_NON_UNIT), R, n, n };
+        double est;
+        ret = inv_norm1_est(n, svd_r_solve, &c, &est);
+        if (ret == GAUSSIAN_NO_MEMORY) goto cleanup;
+        /* R 数值奇异（tri_solve 拒绝）时 rc = 0，走 SVD */
+        if (ret == GAUSSIAN_SUCCESS && est > 0.0 && isfinite(est)) rc = 1.0 / (rnorm * est);
+    }
+    if (rc > rc_min) {
+        const TriMatrix T = tri_view(n, R, n, TRI_UPPER, TRI_NON_UNIT);
+        for (size_t i = 0; i < n; ++i) memcpy(&X[IDX(i,0,ldx)], &B[IDX(i,0,ldb)], nrhs * sizeof(double));
+        ret = tri_solve(&T, nrhs, X, ldx);
+        if (ret == GAUSSIAN_SUCCESS && rank) *rank = n;
+        goto cleanup;
+    }
+
+    /* 病态 / 秩亏：对 R 做 Jacobi SVD（R = sum_i j_i g_i，g_i 两两正交，|g_i| = s_i），
+     * X = sum_{s_i > rtol s_max} g_i^T (j_i . c) / s_i^2 */
+    Jt = (double*)calloc(n * n, sizeof(double));
+    Y = (double*)malloc(2 * n * nrhs * sizeof(double));
+    ord = (SvdOrder*)malloc(n * sizeof(SvdOrder));
+    ret = GAUSSIAN_NO_MEMORY;
+    if (!Jt || !Y || !ord) goto cleanup;
+    if (nthreads != 1 && n >= GAUSSIAN_SVD_MT_MIN_N && !(pool = thread_pool_create(nthreads)))
+        goto cleanup;
+    for (size_t i = 0; i < n; ++i) Jt[IDX(i,i,n)] = 1.0;
+    SvdStatus st;
+    const GAUSSIAN_Err conv = svd_jacobi_rows(n, R, Jt, n, svd_default_tol(n), 30, pool, ord, &st);
+    if (conv != GAUSSIAN_SUCCESS && conv != GAUSSIAN_NOT_CONVERGED) { ret = conv; goto cleanup; }
+    size_t r = 0;
+    const double smax = sqrt(ord[0].d);
+    while (r < n && sqrt(ord[r].d) > rtol * smax) ++r;
+    /* Y = Jt c（c 为 Q^T B 的前 n 行）；保留的 r 行按序除以 s_i^2 挪到 Y 的后半，
+     * 对应的 G 行挪到 Jt 的前 r 行 */
+    double *Ys = Y + n * nrhs;
+    ret = gaussian_gemm_pool(GEMM_NO_TRANS, GEMM_NO_TRANS, n, nrhs, n, 1.0, Jt, n, B, ldb,
+                             0.0, Y, nrhs, pool);
+    if (ret != GAUSSIAN_SUCCESS) goto cleanup;
+    for (size_t c = 0; c < r; ++c) {
+        const size_t i = ord[c].idx;
+        for (size_t q = 0; q < nrhs; ++q) Ys[IDX(c,q,nrhs)] = Y[IDX(i,q,nrhs)] / ord[c].d;
+        memcpy(&Jt[IDX(c,0,n)], &R[IDX(i,0,n)], n * sizeof(double));
+    }
+    if (r == 0) {
+        for (size_t i = 0; i < n; ++i) memset(&X[IDX(i,0,ldx)], 0, nrhs * sizeof(double));
+    } else {
+        ret = gaussian_gemm_pool(GEMM_TRANS, GEMM_NO_TRANS, n, nrhs, r, 1.0, Jt, n, Ys, nrhs,
+                                 0.0, X, ldx, pool);
+    }
+    if (ret == GAUSSIAN_SUCCESS && rank) *rank = r;
+    if (ret == GAUSSIAN_SUCCESS) ret = conv;
+
+cleanup:
+    thread_pool_destroy(pool);
+    free(tau); free(R); free(Jt); free(Y); free(ord);
+    return ret;
+}
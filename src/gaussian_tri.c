@@ -0,0 +1,199 @@
+#include "gaussian_tri.h"
+#include "gaussian_simd.h"
+#include <math.h>
+
+TriMatrix tri_view(size_t n, const double *A, size_t ld, TriUplo uplo, TriDiag diag) {
+    TriMatrix T = { n, A, ld, uplo, diag, TRI_FULL };
+    return T;
+}
+
+TriMatrix lu_view_L(size_t n, const double *LU, size_t lda) {
+    return tri_view(n, LU, lda, TRI_LOWER, TRI_UNIT);
+}
+
+TriMatrix lu_view_U(size_t n, const double *LU, size_t lda) {
+    return tri_view(n, LU, lda, TRI_UPPER, TRI_NON_UNIT);
+}
+
+size_t tri_packed_size(size_t n) {
+    return n * (n + 1) / 2;
+}
+
+static int tri_valid(const TriMatrix *T) {
+    return T && T->data && (T->layout == TRI_PACKED || T->ld >= T->n);
+}
+
+/* 行 i 三角部分的列范围 [lo, hi)（含对角） */
+static void tri_span(const TriMatrix *T, size_t i, size_t *lo, size_t *hi) {
+    if (T->uplo == TRI_LOWER) { *lo = 0; *hi = i + 1; }
+    else { *lo = i; *hi = T->n; }
+}
+
+GAUSSIAN_Err tri_pack(const TriMatrix *T, double *AP, TriMatrix *P) {
+    if (!tri_valid(T) || !AP || !P) return GAUSSIAN_INVALID_INPUT;
+    TriMatrix out = { T->n, AP, 0, T->uplo, T->diag, TRI_PACKED };
+    for (size_t i = 0; i < T->n; ++i) {
+        const double *src = tri_row(T, i);
+        double *dst = AP + (tri_row(&out, i) - AP);
+        size_t lo, hi;
+        tri_span(T, i, &lo, &hi);
+        for (size_t j = lo; j < hi; ++j) dst[j] = src[j];
+        if (T->diag == TRI_UNIT) dst[i] = 1.0;
+    }
+    *P = out;
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err tri_unpack(const TriMatrix *T, double *B, size_t ldb) {
+    if (!tri_valid(T) || !B || ldb < T->n) return GAUSSIAN_INVALID_INPUT;
+    for (size_t i = 0; i < T->n; ++i)
+        for (size_t j = 0; j < T->n; ++j)
+            B[IDX(i,j,ldb)] = tri_get(T, i, j);
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 单右端：按行内积 ------------------ */
+static void solve_vec(const TriMatrix *T, double *b, size_t ldb) {
+    const size_t n = T->n;
+    const int unit = T->diag == TRI_UNIT;
+    if (T->uplo == TRI_LOWER) {
+        for (size_t i = 0; i < n; ++i) {
+            const double *row = tri_row(T, i);
+            double s = b[i * ldb];
+            for (size_t j = 0; j < i; ++j) s -= row[j] * b[j * ldb];
+            b[i * ldb] = unit ? s : s / row[i];
+        }
+    } else {
+        for (size_t i = n; i-- > 0;) {
+            const double *row = tri_row(T, i);
+            double s = b[i * ldb];
+            for (size_t j = i + 1; j < n; ++j) s -= row[j] * b[j * ldb];
+            b[i * ldb] = unit ? s : s / row[i];
+        }
+    }
+}
+
+/* 下三角自下而上、上三角自上而下：参与运算的其余分量尚未被改写 */
+static void mult_vec(const TriMatrix *T, double *b, size_t ldb) {
+    const size_t n = T->n;
+    const int unit = T->diag == TRI_UNIT;
+    if (T->uplo == TRI_LOWER) {
+        for (size_t i = n; i-- > 0;) {
+            const double *row = tri_row(T, i);
+            double s = unit ? b[i * ldb] : row[i] * b[i * ldb];
+            for (size_t j = 0; j < i; ++j) s += row[j] * b[j * ldb];
+            b[i * ldb] = s;
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            const double *row = tri_row(T, i);
+            double s = unit ? b[i * ldb] : row[i] * b[i * ldb];
+            for (size_t j = i + 1; j < n; ++j) s += row[j] * b[j * ldb];
+            b[i * ldb] = s;
+        }
+    }
+}
+
+/* ------------------ 多右端：4 行一组 ------------------
+ * 组外部分为 B_g -= T(g, 组外) B(组外)：B 的每一行以 axpy4 被 4 行复用；
+ * 组内三角部分逐行处理。sign = 1 为求解（减），-1 为乘法（加） */
+static void group_outer(const TriMatrix *T, size_t g0, size_t g1, size_t j0, size_t j1,
+                        double sign, size_t nrhs, double *B, size_t ldb) {
+    const GaussianKernels *K = gaussian_kernels();
+    if (g1 - g0 == 4) {
+        const double *r0 = tri_row(T, g0),     *r1 = tri_row(T, g0 + 1);
+        const double *r2 = tri_row(T, g0 + 2), *r3 = tri_row(T, g0 + 3);
+        double *y0 = &B[IDX(g0,0,ldb)],   *y1 = &B[IDX(g0+1,0,ldb)];
+        double *y2 = &B[IDX(g0+2,0,ldb)], *y3 = &B[IDX(g0+3,0,ldb)];
+        for (size_t j = j0; j < j1; ++j) {
+            const double a[4] = { sign * r0[j], sign * r1[j], sign * r2[j], sign * r3[j] };
+            K->axpy4(nrhs, a, &B[IDX(j,0,ldb)], y0, y1, y2, y3);
+        }
+    } else {
+        for (size_t i = g0; i < g1; ++i) {
+            const double *ri = tri_row(T, i);
+            for (size_t j = j0; j < j1; ++j)
+                K->axpy(nrhs, sign * ri[j], &B[IDX(j,0,ldb)], &B[IDX(i,0,ldb)]);
+        }
+    }
+}
+
+static void scale_row(size_t nrhs, double s, double *y) {
+    for (size_t c = 0; c < nrhs; ++c) y[c] *= s;
+}
+
+GAUSSIAN_Err tri_solve(const TriMatrix *T, size_t nrhs, double *B, size_t ldb) {
+    if (!tri_valid(T) || !B || ldb < nrhs) return GAUSSIAN_INVALID_INPUT;
+    const double EPS = 1e-12;
+    const size_t n = T->n;
+    const int unit = T->diag == TRI_UNIT;
+    if (!unit)
+        for (size_t i = 0; i < n; ++i)
+            if (fabs(tri_row(T, i)[i]) < EPS) return GAUSSIAN_BAD_MATRIX;
+    if (n == 0 || nrhs == 0) return GAUSSIAN_SUCCESS;
+    if (nrhs == 1) { solve_vec(T, B, ldb); return GAUSSIAN_SUCCESS; }
+
+    const GaussianKernels *K = gaussian_kernels();
+    if (T->uplo == TRI_LOWER) {
+        for (size_t g0 = 0; g0 < n; g0 += 4) {
+            size_t g1 = (n - g0 < 4) ? n : g0 + 4;
+            group_outer(T, g0, g1, 0, g0, 1.0, nrhs, B, ldb);
+            for (size_t i = g0; i < g1; ++i) {
+                const double *ri = tri_row(T, i);
+                double *yi = &B[IDX(i,0,ldb)];
+                for (size_t j = g0; j < i; ++j) K->axpy(nrhs, ri[j], &B[IDX(j,0,ldb)], yi);
+                if (!unit) scale_row(nrhs, 1.0 / ri[i], yi);
+            }
+        }
+    } else {
+        size_t ng = (n + 3) / 4;
+        for (size_t g = ng; g-- > 0;) {
+            size_t g0 = g * 4, g1 = (n - g0 < 4) ? n : g0 + 4;
+            group_outer(T, g0, g1, g1, n, 1.0, nrhs, B, ldb);
+            for (size_t i = g1; i-- > g0;) {
+                const double *ri = tri_row(T, i);
+                double *yi = &B[IDX(i,0,ldb)];
+                for (size_t j = i + 1; j < g1; ++j) K->axpy(nrhs, ri[j], &B[IDX(j,0,ldb)], yi);
+                if (!unit) scale_row(nrhs, 1.0 / ri[i], yi);
+            }
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* 乘法：下三角按组自下而上、上三角按组自上而下；组内先做对角与组内三角部分
+ * （只用到组内尚未改写的行），再加组外部分 */
+GAUSSIAN_Err tri_mult(const TriMatrix *T, size_t nrhs, double *B, size_t ldb) {
+    if (!tri_valid(T) || !B || ldb < nrhs) return GAUSSIAN_INVALID_INPUT;
+    const size_t n = T->n;
+    const int unit = T->diag == TRI_UNIT;
+    if (n == 0 || nrhs == 0) return GAUSSIAN_SUCCESS;
+    if (nrhs == 1) { mult_vec(T, B, ldb); return GAUSSIAN_SUCCESS; }
+
+    const GaussianKernels *K = gaussian_kernels();
+    const size_t ng = (n + 3) / 4;
+    if (T->uplo == TRI_LOWER) {
+        for (size_t g = ng; g-- > 0;) {
+            size_t g0 = g * 4, g1 = (n - g0 < 4) ? n : g0 + 4;
+            for (size_t i = g1; i-- > g0;) {
+                const double *ri = tri_row(T, i);
+                double *yi = &B[IDX(i,0,ldb)];
+                if (!unit) scale_row(nrhs, ri[i], yi);
+                for (size_t j = g0; j < i; ++j) K->axpy(nrhs, -ri[j], &B[IDX(j,0,ldb)], yi);
+            }
+            group_outer(T, g0, g1, 0, g0, -1.0, nrhs, B, ldb);
+        }
+    } else {
+        for (size_t g0 = 0; g0 < n; g0 += 4) {
+            size_t g1 = (n - g0 < 4) ? n : g0 + 4;
+            for (size_t i = g0; i < g1; ++i) {
+                const double *ri = tri_row(T, i);
+                double *yi = &B[IDX(i,0,ldb)];
+                if (!unit) scale_row(nrhs, ri[i], yi);
+                for (size_t j = i + 1; j < g1; ++j) K->axpy(nrhs, -ri[j], &B[IDX(j,0,ldb)], yi);
+            }
+            group_outer(T, g0, g1, g1, n, -1.0, nrhs, B, ldb);
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
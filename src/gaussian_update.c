@@ -0,0 +1,163 @@
+#include "gaussian_update.h"
+#include "gaussian_simd.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef GAUSSIAN_UPDATE_MAX_RANK
+#define GAUSSIAN_UPDATE_MAX_RANK 64
+#endif
+
+static double dot(size_t n, const double *a, const double *b) {
+    double s = 0.0;
+    for (size_t i = 0; i < n; ++i) s += a[i] * b[i];
+    return s;
+}
+
+void lu_update_free(LuUpdate *S) {
+    if (!S) return;
+    free(S->A); free(S->LU); free(S->piv);
+    free(S->Zt); free(S->Vt); free(S->C); free(S->Clu); free(S->cpiv);
+    free(S->work);
+    memset(S, 0, sizeof(*S));
+}
+
+GAUSSIAN_Err lu_update_refactor(LuUpdate *S) {
+    if (!S || !S->A) return GAUSSIAN_INVALID_INPUT;
+    const size_t n = S->n;
+    memcpy(S->LU, S->A, n * n * sizeof(double));
+    S->rank = 0;
+    S->crcond = 1.0;
+    S->berr = 0.0;
+    GAUSSIAN_Err ret = lu_decompose_blocked(n, S->LU, n, S->piv);
+    S->singular = ret != GAUSSIAN_SUCCESS;
+    S->refactorizations++;
+    return ret;
+}
+
+GAUSSIAN_Err lu_update_init(LuUpdate *S, size_t n, const double *A, size_t lda,
+                            const LuUpdateOptions *opts) {
+    if (!S || !A || lda < n || n == 0) return GAUSSIAN_INVALID_INPUT;
+    memset(S, 0, sizeof(*S));
+    size_t mr = opts ? opts->max_rank : 0;
+    if (mr == 0) mr = n < GAUSSIAN_UPDATE_MAX_RANK ? n : GAUSSIAN_UPDATE_MAX_RANK;
+    double rc = opts ? opts->min_rcond : 0.0;
+    double be = opts ? opts->max_berr : 0.0;
+    if (!(rc >= 0.0) || !(be >= 0.0)) return GAUSSIAN_INVALID_INPUT;
+    S->n = n;
+    S->max_rank = mr;
+    S->min_rcond = rc > 0.0 ? rc : 1e-8;
+    S->max_berr = be > 0.0 ? be : 1e-11;
+
+    S->A = (double*)malloc(n * n * sizeof(double));
+    S->LU = (double*)malloc(n * n * sizeof(double));
+    S->piv = (size_t*)malloc(n * sizeof(size_t));
+    S->Zt = (double*)malloc(mr * n * sizeof(double));
+    S->Vt = (double*)malloc(mr * n * sizeof(double));
+    S->C = (double*)malloc(mr * mr * sizeof(double));
+    S->Clu = (double*)malloc(mr * mr * sizeof(double));
+    S->cpiv = (size_t*)malloc(mr * sizeof(size_t));
+    S->work = (double*)malloc(2 * mr * sizeof(double));
+    if (!S->A || !S->LU || !S->piv || !S->Zt || !S->Vt || !S->C || !S->Clu
+        || !S->cpiv || !S->work) {
+        lu_update_free(S);
+        return GAUSSIAN_NO_MEMORY;
+    }
+    for (size_t i = 0; i < n; ++i)
+        memcpy(&S->A[IDX(i,0,n)], &A[IDX(i,0,lda)], n * sizeof(double));
+    GAUSSIAN_Err ret = lu_update_refactor(S);
+    if (ret != GAUSSIAN_SUCCESS) lu_update_free(S);
+    else S->refactorizations = 0;
+    return ret;
+}
+
+GAUSSIAN_Err lu_update_rank_k(LuUpdate *S, size_t k, const double *U, size_t ldu,
+                              const double *V, size_t ldv) {
+    if (!S || !S->A || !U || !V || ldu < k || ldv < k) return GAUSSIAN_INVALID_INPUT;
+    if (k == 0) return GAUSSIAN_SUCCESS;
+    const size_t n = S->n, r0 = S->rank, r1 = r0 + k, mr = S->max_rank;
+    const GaussianKernels *K = gaussian_kernels();
+
+    /* U、V 的列转为连续的行：Ut / Vt 各 k x n */
+    double *T = (double*)malloc(2 * k * n * sizeof(double));
+    if (!T) return GAUSSIAN_NO_MEMORY;
+    double *Ut = T, *Vt = T + k * n;
+    for (size_t i = 0; i < n; ++i)
+        for (size_t c = 0; c < k; ++c) {
+            Ut[IDX(c,i,n)] = U[IDX(i,c,ldu)];
+            Vt[IDX(c,i,n)] = V[IDX(i,c,ldv)];
+        }
+
+    /* 显式 A += U V^T：第 i 行 += sum_c u_ic v_c^T */
+    for (size_t i = 0; i < n; ++i)
+        for (size_t c = 0; c < k; ++c)
+            K->axpy(n, -Ut[IDX(c,i,n)], &Vt[IDX(c,0,n)], &S->A[IDX(i,0,n)]);
+
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    if (S->singular || r1 > mr) {
+        ret = lu_update_refactor(S);
+        goto done;
+    }
+
+    /* z_c = A0^{-1} u_c，v_c 追加到 Vt */
+    for (size_t c = 0; c < k; ++c) {
+        ret = lu_solve(n, S->LU, n, S->piv, &Ut[IDX(c,0,n)], &S->Zt[IDX(r0 + c,0,n)]);
+        if (ret != GAUSSIAN_SUCCESS) goto done;
+        memcpy(&S->Vt[IDX(r0 + c,0,n)], &Vt[IDX(c,0,n)], n * sizeof(double));
+    }
+    /* C 扩展新行新列：C_ij = delta_ij + v_i . z_j */
+    for (size_t i = 0; i < r1; ++i)
+        for (size_t j = (i < r0 ? r0 : 0); j < r1; ++j)
+            S->C[IDX(i,j,mr)] = (i == j ? 1.0 : 0.0)
+                              + dot(n, &S->Vt[IDX(i,0,n)], &S->Zt[IDX(j,0,n)]);
+    for (size_t i = 0; i < r1; ++i)
+        memcpy(&S->Clu[IDX(i,0,mr)], &S->C[IDX(i,0,mr)], r1 * sizeof(double));
+    double rc = 0.0;
+    if (lu_decompose_pp_rcond(r1, S->Clu, mr, S->cpiv, &rc) != GAUSSIAN_SUCCESS
+        || rc < S->min_rcond) {
+        ret = lu_update_refactor(S);
+        goto done;
+    }
+    S->rank = r1;
+    S->crcond = rc;
+
+    /* 探测：p = A 1，检查 SMW 求解的后向误差（T 此时已不再需要） */
+    double *p = T, *x = T + n, anorm = 0.0, pnorm = 0.0, xnorm = 0.0, rnorm = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        const double *row = &S->A[IDX(i,0,n)];
+        double sum = 0.0, asum = 0.0;
+        for (size_t j = 0; j < n; ++j) { sum += row[j]; asum += fabs(row[j]); }
+        p[i] = sum;
+        if (asum > anorm) anorm = asum;
+        if (fabs(sum) > pnorm) pnorm = fabs(sum);
+    }
+    ret = lu_update_solve(S, p, x);
+    if (ret != GAUSSIAN_SUCCESS) goto done;
+    for (size_t i = 0; i < n; ++i) {
+        double rr = fabs(p[i] - dot(n, &S->A[IDX(i,0,n)], x));
+        if (rr > rnorm || rr != rr) rnorm = rr;
+        if (fabs(x[i]) > xnorm) xnorm = fabs(x[i]);
+    }
+    S->berr = rnorm / (anorm * xnorm + pnorm);
+    if (!(S->berr <= S->max_berr)) ret = lu_update_refactor(S);
+done:
+    free(T);
+    return ret;
+}
+
+GAUSSIAN_Err lu_update_solve(LuUpdate *S, const double *b, double *x) {
+    if (!S || !S->A || !b || !x || b == x) return GAUSSIAN_INVALID_INPUT;
+    if (S->singular) return GAUSSIAN_BAD_MATRIX;
+    const size_t n = S->n, r = S->rank, mr = S->max_rank;
+    const GaussianKernels *K = gaussian_kernels();
+    GAUSSIAN_Err ret = lu_solve(n, S->LU, n, S->piv, b, x);
+    if (ret != GAUSSIAN_SUCCESS || r == 0) return ret;
+
+    /* x = y - Z C^{-1} V^T y */
+    double *t = S->work, *s = S->work + mr;
+    for (size_t i = 0; i < r; ++i) t[i] = dot(n, &S->Vt[IDX(i,0,n)], x);
+    ret = lu_solve(r, S->Clu, mr, S->cpiv, t, s);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+    for (size_t j = 0; j < r; ++j) K->axpy(n, s[j], &S->Zt[IDX(j,0,n)], x);
+    return GAUSSIAN_SUCCESS;
+}
@@ -0,0 +1,445 @@
+#include "iterative.h"
+#include "thread_pool.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 向量运算的并行块大小 */
+#define KRYLOV_VEC_GRAIN 16384
+
+void iter_options_default(IterOptions *opts) {
+    if (!opts) return;
+    opts->tol = 1e-8;
+    opts->max_iter = 1000;
+    opts->restart = 30;
+    opts->precond = ITER_PRECOND_NONE;
+    opts->nthreads = 1;
+    opts->omega = 0.0;
+}
+
+/* ------------------ 求解上下文：线程池 + 预条件 ------------------ */
+typedef struct {
+    const CsrMatrix *A;
+    size_t n;
+    ThreadPool *pool;
+    size_t nworkers;
+    double *partial;        /* 每个工作线程一个部分和 */
+
+    IterPrecond precond;
+    double *dinv;           /* Jacobi：对角元倒数 */
+    CsrMatrix ilu;          /* ILU(0)：L（单位下三角）与 U 共用 A 的稀疏模式 */
+    size_t *diag;           /* ILU(0)：各行对角元在 ilu 中的位置 */
+} KrylovCtx;
+
+static void ctx_free(KrylovCtx *c) {
+    free(c->partial);
+    free(c->dinv);
+    free(c->diag);
+    csr_free(&c->ilu);
+    thread_pool_destroy(c->pool);
+}
+
+static GAUSSIAN_Err find_diag(const CsrMatrix *A, size_t *diag) {
+    for (size_t i = 0; i < A->nrows; ++i) {
+        size_t q = A->row_ptr[i];
+        while (q < A->row_ptr[i + 1] && A->col_idx[q] < i) q++;
+        if (q == A->row_ptr[i + 1] || A->col_idx[q] != i) return GAUSSIAN_BAD_MATRIX;
+        diag[i] = q;
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ILU(0)，IKJ 形式：只在 A 已有的位置上消元，pos 记录当前行各列的位置 */
+static GAUSSIAN_Err ilu0_factor(KrylovCtx *c) {
+    const double EPS = 1e-12;
+    const CsrMatrix *A = c->A;
+    const size_t n = c->n;
+    GAUSSIAN_Err ret = csr_alloc(&c->ilu, n, n, A->nnz);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+    memcpy(c->ilu.row_ptr, A->row_ptr, (n + 1) * sizeof(size_t));
+    memcpy(c->ilu.col_idx, A->col_idx, A->nnz * sizeof(size_t));
+    memcpy(c->ilu.val, A->val, A->nnz * sizeof(double));
+    c->diag = (size_t*)malloc(n * sizeof(size_t));
+    size_t *pos = (size_t*)malloc(n * sizeof(size_t));
+    if (!c->diag || !pos) { free(pos); return GAUSSIAN_NO_MEMORY; }
+    ret = find_diag(&c->ilu, c->diag);
+    if (ret != GAUSSIAN_SUCCESS) { free(pos); return ret; }
+
+    const size_t *rp = c->ilu.row_ptr, *ci = c->ilu.col_idx;
+    double *v = c->ilu.val;
+    for (size_t j = 0; j < n; ++j) pos[j] = (size_t)-1;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t q = rp[i]; q < rp[i + 1]; ++q) pos[ci[q]] = q;
+        for (size_t q = rp[i]; q < c->diag[i]; ++q) {
+            const size_t k = ci[q];
+            v[q] /= v[c->diag[k]];
+            for (size_t r = c->diag[k] + 1; r < rp[k + 1]; ++r)
+                if (pos[ci[r]] != (size_t)-1) v[pos[ci[r]]] -= v[q] * v[r];
+        }
+        for (size_t q = rp[i]; q < rp[i + 1]; ++q) pos[ci[q]] = (size_t)-1;
+        if (fabs(v[c->diag[i]]) < EPS) { free(pos); return GAUSSIAN_BAD_MATRIX; }
+    }
+    free(pos);
+    return GAUSSIAN_SUCCESS;
+}
+
+static GAUSSIAN_Err ctx_init(KrylovCtx *c, const CsrMatrix *A, const IterOptions *opts) {
+    const double EPS = 1e-12;
+    memset(c, 0, sizeof(*c));
+    c->A = A;
+    c->n = A->nrows;
+    c->precond = opts->precond;
+    if (opts->nthreads != 1) {
+        c->pool = thread_pool_create(opts->nthreads);
+        if (!c->pool) return GAUSSIAN_NO_MEMORY;
+    }
+    c->nworkers = thread_pool_size(c->pool);
+    c->partial = (double*)malloc(c->nworkers * sizeof(double));
+    if (!c->partial) return GAUSSIAN_NO_MEMORY;
+
+    switch (c->precond) {
+    case ITER_PRECOND_NONE:
+        return GAUSSIAN_SUCCESS;
+    case ITER_PRECOND_JACOBI: {
+        c->diag = (size_t*)malloc(c->n * sizeof(size_t));
+        c->dinv = (double*)malloc(c->n * sizeof(double));
+        if (!c->diag || !c->dinv) return GAUSSIAN_NO_MEMORY;
+        GAUSSIAN_Err ret = find_diag(A, c->diag);
+        if (ret != GAUSSIAN_SUCCESS) return ret;
+        for (size_t i = 0; i < c->n; ++i) {
+            double d = A->val[c->diag[i]];
+            if (fabs(d) < EPS) return GAUSSIAN_BAD_MATRIX;
+            c->dinv[i] = 1.0 / d;
+        }
+        return GAUSSIAN_SUCCESS;
+    }
+    case ITER_PRECOND_ILU0:
+        return ilu0_factor(c);
+    default:
+        return GAUSSIAN_INVALID_INPUT;
+    }
+}
+
+/* ------------------ 并行向量运算 ------------------ */
+/* 点积按工作线程静态切分，部分和按编号顺序累加：结果与调度无关 */
+typedef struct {
+    KrylovCtx *c;
+    const double *x, *y;
+} DotJob;
+
+static void dot_worker(void *p, size_t w) {
+    DotJob *job = (DotJob*)p;
+    const size_t n = job->c->n, nw = job->c->nworkers;
+    const size_t b = n * w / nw, e = n * (w + 1) / nw;
+    double sum = 0.0;
+    for (size_t i = b; i < e; ++i) sum += job->x[i] * job->y[i];
+    job->c->partial[w] = sum;
+}
+
+static double vdot(KrylovCtx *c, const double *x, const double *y) {
+    DotJob job = { c, x, y };
+    thread_pool_run(c->pool, dot_worker, &job);
+    double sum = 0.0;
+    for (size_t w = 0; w < c->nworkers; ++w) sum += c->partial[w];
+    return sum;
+}
+
+/* out = a*x + b*y，out 可与 x 或 y 相同 */
+typedef struct {
+    double *out;
+    double a, b;
+    const double *x, *y;
+} AxpbyJob;
+
+static void axpby_range(void *p, size_t i0, size_t i1) {
+    AxpbyJob *job = (AxpbyJob*)p;
+    for (size_t i = i0; i < i1; ++i)
+        job->out[i] = job->a * job->x[i] + job->b * job->y[i];
+}
+
+static void vaxpby(KrylovCtx *c, double *out, double a, const double *x, double b, const double *y) {
+    AxpbyJob job = { out, a, b, x, y };
+    thread_pool_parallel_for(c->pool, c->n, KRYLOV_VEC_GRAIN, axpby_range, &job);
+}
+
+static void jacobi_range(void *p, size_t i0, size_t i1) {
+    AxpbyJob *job = (AxpbyJob*)p;      /* out = dinv .* x */
+    for (size_t i = i0; i < i1; ++i) job->out[i] = job->y[i] * job->x[i];
+}
+
+/* z = M^{-1} r；ILU(0) 的两次三角回代是顺序的 */
+static void precond_apply(KrylovCtx *c, const double *r, double *z) {
+    const size_t n = c->n;
+    switch (c->precond) {
+    case ITER_PRECOND_JACOBI: {
+        AxpbyJob job = { z, 0.0, 0.0, r, c->dinv };
+        thread_pool_parallel_for(c->pool, n, KRYLOV_VEC_GRAIN, jacobi_range, &job);
+        break;
+    }
+    case ITER_PRECOND_ILU0: {
+        const size_t *rp = c->ilu.row_ptr, *ci = c->ilu.col_idx;
+        const double *v = c->ilu.val;
+        for (size_t i = 0; i < n; ++i) {
+            double sum = r[i];
+            for (size_t q = rp[i]; q < c->diag[i]; ++q) sum -= v[q] * z[ci[q]];
+            z[i] = sum;
+        }
+        for (size_t i = n; i-- > 0;) {
+            double sum = z[i];
+            for (size_t q = c->diag[i] + 1; q < rp[i + 1]; ++q) sum -= v[q] * z[ci[q]];
+            z[i] = sum / v[c->diag[i]];
+        }
+        break;
+    }
+    default:
+        if (z != r) memcpy(z, r, n * sizeof(double));
+        break;
+    }
+}
+
+/* ------------------ 状态记录 ------------------ */
+static void status_begin(IterStatus *st) {
+    if (!st) return;
+    st->iterations = 0;
+    st->residual = 0.0;
+    st->history_len = 0;
+}
+
+static void status_push(IterStatus *st, size_t it, double res) {
+    if (!st) return;
+    st->iterations = it;
+    st->residual = res;
+    if (st->history && st->history_len < st->history_cap)
+        st->history[st->history_len++] = res;
+}
+
+/* 公共入口检查；b = 0 时直接置 x = 0 并返回 1 */
+static int trivial_rhs(const CsrMatrix *A, const double *b, double *x, double *bnorm) {
+    double s = 0.0;
+    for (size_t i = 0; i < A->nrows; ++i) s += b[i] * b[i];
+    *bnorm = sqrt(s);
+    if (*bnorm == 0.0) {
+        memset(x, 0, A->nrows * sizeof(double));
+        return 1;
+    }
+    return 0;
+}
+
+static int bad_args(const CsrMatrix *A, const double *b, const double *x) {
+    return !A || !b || !x || !A->row_ptr || A->nrows != A->ncols || A->nrows == 0;
+}
+
+/* r = b - A x */
+static void residual(KrylovCtx *c, const double *b, const double *x, double *r) {
+    csr_spmv(c->A, x, r, c->pool);
+    vaxpby(c, r, 1.0, b, -1.0, r);
+}
+
+/* ------------------ CG ------------------ */
+GAUSSIAN_Err krylov_cg(const CsrMatrix *A, const double *b, double *x,
+                       const IterOptions *opts, IterStatus *status) {
+    if (bad_args(A, b, x)) return GAUSSIAN_INVALID_INPUT;
+    IterOptions def;
+    if (!opts) { iter_options_default(&def); opts = &def; }
+    status_begin(status);
+    double bnorm;
+    if (trivial_rhs(A, b, x, &bnorm)) { status_push(status, 0, 0.0); return GAUSSIAN_SUCCESS; }
+
+    KrylovCtx c;
+    const size_t n = A->nrows;
+    GAUSSIAN_Err ret = ctx_init(&c, A, opts);
+    double *work = (double*)malloc(4 * n * sizeof(double));
+    if (ret == GAUSSIAN_SUCCESS && !work) ret = GAUSSIAN_NO_MEMORY;
+    if (ret != GAUSSIAN_SUCCESS) { free(work); ctx_free(&c); return ret; }
+    double *r = work, *z = work + n, *p = work + 2 * n, *q = work + 3 * n;
+
+    residual(&c, b, x, r);
+    double res = sqrt(vdot(&c, r, r)) / bnorm;
+    status_push(status, 0, res);
+    ret = GAUSSIAN_NOT_CONVERGED;
+    if (res <= opts->tol) ret = GAUSSIAN_SUCCESS;
+
+    precond_apply(&c, r, z);
+    memcpy(p, z, n * sizeof(double));
+    double rz = vdot(&c, r, z);
+    for (size_t it = 1; ret == GAUSSIAN_NOT_CONVERGED && it <= opts->max_iter; ++it) {
+        csr_spmv(A, p, q, c.pool);
+        double pq = vdot(&c, p, q);
+        if (!(pq > 0.0)) { ret = GAUSSIAN_NOT_SPD; break; }
+        double alpha = rz / pq;
+        vaxpby(&c, x, 1.0, x, alpha, p);
+        vaxpby(&c, r, 1.0, r, -alpha, q);
+        res = sqrt(vdot(&c, r, r)) / bnorm;
+        status_push(status, it, res);
+        if (res <= opts->tol) { ret = GAUSSIAN_SUCCESS; break; }
+
+        precond_apply(&c, r, z);
+        double rz_new = vdot(&c, r, z);
+        vaxpby(&c, p, 1.0, z, rz_new / rz, p);
+        rz = rz_new;
+    }
+    free(work);
+    ctx_free(&c);
+    return ret;
+}
+
+/* ------------------ BiCGSTAB ------------------ */
+GAUSSIAN_Err krylov_bicgstab(const CsrMatrix *A, const double *b, double *x,
+                             const IterOptions *opts, IterStatus *status) {
+    if (bad_args(A, b, x)) return GAUSSIAN_INVALID_INPUT;
+    IterOptions def;
+    if (!opts) { iter_options_default(&def); opts = &def; }
+    status_begin(status);
+    double bnorm;
+    if (trivial_rhs(A, b, x, &bnorm)) { status_push(status, 0, 0.0); return GAUSSIAN_SUCCESS; }
+
+    KrylovCtx c;
+    const size_t n = A->nrows;
+    GAUSSIAN_Err ret = ctx_init(&c, A, opts);
+    double *work = (double*)calloc(8 * n, sizeof(double));
+    if (ret == GAUSSIAN_SUCCESS && !work) ret = GAUSSIAN_NO_MEMORY;
+    if (ret != GAUSSIAN_SUCCESS) { free(work); ctx_free(&c); return ret; }
+    double *r = work, *rhat = work + n, *p = work + 2 * n, *v = work + 3 * n;
+    double *ph = work + 4 * n, *s = work + 5 * n, *sh = work + 6 * n, *t = work + 7 * n;
+
+    residual(&c, b, x, r);
+    memcpy(rhat, r, n * sizeof(double));
+    double res = sqrt(vdot(&c, r, r)) / bnorm;
+    status_push(status, 0, res);
+    ret = res <= opts->tol ? GAUSSIAN_SUCCESS : GAUSSIAN_NOT_CONVERGED;
+
+    double rho = 1.0, alpha = 1.0, omega = 1.0;
+    for (size_t it = 1; ret == GAUSSIAN_NOT_CONVERGED && it <= opts->max_iter; ++it) {
+        double rho_new = vdot(&c, rhat, r);
+        if (rho_new == 0.0) { ret = GAUSSIAN_BAD_MATRIX; break; }
+        double beta = (rho_new / rho) * (alpha / omega);
+        rho = rho_new;
+        /* p = r + beta * (p - omega * v) */
+        vaxpby(&c, p, 1.0, p, -omega, v);
+        vaxpby(&c, p, 1.0, r, beta, p);
+
+        precond_apply(&c, p, ph);
+        csr_spmv(A, ph, v, c.pool);
+        double rv = vdot(&c, rhat, v);
+        if (rv == 0.0) { ret = GAUSSIAN_BAD_MATRIX; break; }
+        alpha = rho / rv;
+        vaxpby(&c, s, 1.0, r, -alpha, v);
+        double sres = sqrt(vdot(&c, s, s)) / bnorm;
+        if (sres <= opts->tol) {
+            vaxpby(&c, x, 1.0, x, alpha, ph);
+            status_push(status, it, sres);
+            ret = GAUSSIAN_SUCCESS;
+            break;
+        }
+
+        precond_apply(&c, s, sh);
+        csr_spmv(A, sh, t, c.pool);
+        double tt = vdot(&c, t, t);
+        omega = tt > 0.0 ? vdot(&c, t, s) / tt : 0.0;
+        vaxpby(&c, x, 1.0, x, alpha, ph);
+        vaxpby(&c, x, 1.0, x, omega, sh);
+        vaxpby(&c, r, 1.0, s, -omega, t);
+        res = sqrt(vdot(&c, r, r)) / bnorm;
+        status_push(status, it, res);
+        if (res <= opts->tol) { ret = GAUSSIAN_SUCCESS; break; }
+        if (omega == 0.0) { ret = GAUSSIAN_BAD_MATRIX; break; }
+    }
+    free(work);
+    ctx_free(&c);
+    return ret;
+}
+
+/* ------------------ GMRES(m) ------------------ */
+GAUSSIAN_Err krylov_gmres(const CsrMatrix *A, const double *b, double *x,
+                          const IterOptions *opts, IterStatus *status) {
+    if (bad_args(A, b, x)) return GAUSSIAN_INVALID_INPUT;
+    IterOptions def;
+    if (!opts) { iter_options_default(&def); opts = &def; }
+    status_begin(status);
+    double bnorm;
+    if (trivial_rhs(A, b, x, &bnorm)) { status_push(status, 0, 0.0); return GAUSSIAN_SUCCESS; }
+
+    const size_t n = A->nrows;
+    size_t m = opts->restart ? opts->restart : 30;
+    if (m > n) m = n;
+    KrylovCtx c;
+    GAUSSIAN_Err ret = ctx_init(&c, A, opts);
+    /* V: (m+1) 个 Krylov 基向量；w, z 为临时向量；H 为 (m+1) x m 上 Hessenberg（行主序） */
+    double *V = (double*)malloc((m + 3) * n * sizeof(double));
+    double *H = (double*)malloc(((m + 1) * m + 4 * (m + 1)) * sizeof(double));
+    if (ret == GAUSSIAN_SUCCESS && (!V || !H)) ret = GAUSSIAN_NO_MEMORY;
+    if (ret != GAUSSIAN_SUCCESS) { free(V); free(H); ctx_free(&c); return ret; }
+    double *w = V + (m + 1) * n, *z = V + (m + 2) * n;
+    double *cs = H + (m + 1) * m, *sn = cs + (m + 1), *g = sn + (m + 1), *y = g + (m + 1);
+
+    size_t it = 0;
+    ret = GAUSSIAN_NOT_CONVERGED;
+    for (;;) {
+        residual(&c, b, x, V);
+        double beta = sqrt(vdot(&c, V, V));
+        double res = beta / bnorm;
+        if (it == 0) status_push(status, 0, res);
+        if (res <= opts->tol) { ret = GAUSSIAN_SUCCESS; break; }
+        if (it >= opts->max_iter) break;
+        vaxpby(&c, V, 1.0 / beta, V, 0.0, V);
+        memset(g, 0, (m + 1) * sizeof(double));
+        g[0] = beta;
+
+        size_t k = 0;     /* 本轮已生成的列数 */
+        int done = 0;
+        while (k < m && it < opts->max_iter) {
+            const size_t j = k;
+            double *vj = V + j * n;
+            precond_apply(&c, vj, z);
+            csr_spmv(A, z, w, c.pool);
+            for (size_t i = 0; i <= j; ++i) {
+                double h = vdot(&c, w, V + i * n);
+                H[IDX(i, j, m)] = h;
+                vaxpby(&c, w, 1.0, w, -h, V + i * n);
+            }
+            double hn = sqrt(vdot(&c, w, w));
+            H[IDX(j + 1, j, m)] = hn;
+            if (hn > 0.0) vaxpby(&c, V + (j + 1) * n, 1.0 / hn, w, 0.0, w);
+
+            /* 用已有 Givens 旋转更新第 j 列，再生成消去 H[j+1][j] 的新旋转 */
+            for (size_t i = 0; i < j; ++i) {
+                double h0 = H[IDX(i, j, m)], h1 = H[IDX(i + 1, j, m)];
+                H[IDX(i, j, m)] = cs[i] * h0 + sn[i] * h1;
+                H[IDX(i + 1, j, m)] = -sn[i] * h0 + cs[i] * h1;
+            }
+            double h0 = H[IDX(j, j, m)], h1 = H[IDX(j + 1, j, m)];
+            double den = hypot(h0, h1);
+            cs[j] = den > 0.0 ? h0 / den : 1.0;
+            sn[j] = den > 0.0 ? h1 / den : 0.0;
+            H[IDX(j, j, m)] = den;
+            H[IDX(j + 1, j, m)] = 0.0;
+            g[j + 1] = -sn[j] * g[j];
+            g[j] = cs[j] * g[j];
+
+            ++k;
+            ++it;
+            res = fabs(g[j + 1]) / bnorm;
+            status_push(status, it, res);
+            if (res <= opts->tol || hn == 0.0) { done = 1; break; }
+        }
+
+        /* H(0:k,0:k) y = g，x += M^{-1} V y */
+        for (size_t i = k; i-- > 0;) {
+            double sum = g[i];
+            for (size_t l = i + 1; l < k; ++l) sum -= H[IDX(i, l, m)] * y[l];
+            if (H[IDX(i, i, m)] == 0.0) { ret = GAUSSIAN_BAD_MATRIX; break; }
+            y[i] = sum / H[IDX(i, i, m)];
+        }
+        if (ret == GAUSSIAN_BAD_MATRIX) break;
+        vaxpby(&c, w, y[0], V, 0.0, V);
+        for (size_t i = 1; i < k; ++i) vaxpby(&c, w, 1.0, w, y[i], V + i * n);
+        precond_apply(&c, w, z);
+        vaxpby(&c, x, 1.0, x, 1.0, z);
+        if (done) { ret = GAUSSIAN_SUCCESS; break; }
+    }
+    free(V);
+    free(H);
+    ctx_free(&c);
+    return ret;
+}
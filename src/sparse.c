@@ -0,0 +1,115 @@
+#include "sparse.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 并行 SpMV 的行块大小：约 10 个非零元/行时每块数万次乘加 */
+#define CSR_SPMV_GRAIN 2048
+
+GAUSSIAN_Err csr_alloc(CsrMatrix *A, size_t nrows, size_t ncols, size_t nnz) {
+    if (!A) return GAUSSIAN_INVALID_INPUT;
+    A->nrows = nrows;
+    A->ncols = ncols;
+    A->nnz = nnz;
+    A->row_ptr = (size_t*)calloc(nrows + 1, sizeof(size_t));
+    A->col_idx = (size_t*)malloc((nnz ? nnz : 1) * sizeof(size_t));
+    A->val = (double*)malloc((nnz ? nnz : 1) * sizeof(double));
+    if (!A->row_ptr || !A->col_idx || !A->val) {
+        csr_free(A);
+        return GAUSSIAN_NO_MEMORY;
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+void csr_free(CsrMatrix *A) {
+    if (!A) return;
+    free(A->row_ptr);
+    free(A->col_idx);
+    free(A->val);
+    A->row_ptr = NULL;
+    A->col_idx = NULL;
+    A->val = NULL;
+    A->nrows = A->ncols = A->nnz = 0;
+}
+
+GAUSSIAN_Err csr_from_dense(size_t nrows, size_t ncols, const double *A, size_t lda,
+                            double drop_tol, CsrMatrix *out) {
+    if (!A || !out || lda < ncols) return GAUSSIAN_INVALID_INPUT;
+    size_t nnz = 0;
+    for (size_t i = 0; i < nrows; ++i)
+        for (size_t j = 0; j < ncols; ++j)
+            if (i == j || fabs(A[IDX(i,j,lda)]) > drop_tol) nnz++;
+
+    GAUSSIAN_Err ret = csr_alloc(out, nrows, ncols, nnz);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+    size_t p = 0;
+    for (size_t i = 0; i < nrows; ++i) {
+        for (size_t j = 0; j < ncols; ++j) {
+            double v = A[IDX(i,j,lda)];
+            if (i == j || fabs(v) > drop_tol) {
+                out->col_idx[p] = j;
+                out->val[p] = v;
+                p++;
+            }
+        }
+        out->row_ptr[i + 1] = p;
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err csr_to_dense(const CsrMatrix *A, double *D, size_t lda) {
+    if (!A || !D || lda < A->ncols) return GAUSSIAN_INVALID_INPUT;
+    for (size_t i = 0; i < A->nrows; ++i) {
+        memset(D + i * lda, 0, A->ncols * sizeof(double));
+        for (size_t p = A->row_ptr[i]; p < A->row_ptr[i + 1]; ++p)
+            D[IDX(i, A->col_idx[p], lda)] += A->val[p];
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+GAUSSIAN_Err csr_poisson2d(size_t nx, size_t ny, CsrMatrix *out) {
+    if (!out || nx == 0 || ny == 0) return GAUSSIAN_INVALID_INPUT;
+    const size_t n = nx * ny;
+    /* 内部点 5 个非零元，每条边界少一个 */
+    const size_t nnz = 5 * n - 2 * nx - 2 * ny;
+    GAUSSIAN_Err ret = csr_alloc(out, n, n, nnz);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+
+    size_t p = 0;
+    for (size_t iy = 0; iy < ny; ++iy) {
+        for (size_t ix = 0; ix < nx; ++ix) {
+            const size_t i = iy * nx + ix;
+            /* 按列号递增写入：下、左、中、右、上 */
+            if (iy > 0)      { out->col_idx[p] = i - nx; out->val[p++] = -1.0; }
+            if (ix > 0)      { out->col_idx[p] = i - 1;  out->val[p++] = -1.0; }
+            out->col_idx[p] = i; out->val[p++] = 4.0;
+            if (ix + 1 < nx) { out->col_idx[p] = i + 1;  out->val[p++] = -1.0; }
+            if (iy + 1 < ny) { out->col_idx[p] = i + nx; out->val[p++] = -1.0; }
+            out->row_ptr[i + 1] = p;
+        }
+    }
+    return GAUSSIAN_SUCCESS;
+}
+
+typedef struct {
+    const CsrMatrix *A;
+    const double *x;
+    double *y;
+} SpmvJob;
+
+static void spmv_rows(void *p, size_t r0, size_t r1) {
+    const SpmvJob *job = (const SpmvJob*)p;
+    const size_t *rp = job->A->row_ptr, *ci = job->A->col_idx;
+    const double *v = job->A->val, *x = job->x;
+    for (size_t i = r0; i < r1; ++i) {
+        double sum = 0.0;
+        for (size_t q = rp[i]; q < rp[i + 1]; ++q) sum += v[q] * x[ci[q]];
+        job->y[i] = sum;
+    }
+}
+
+void csr_spmv(const CsrMatrix *A, const double *x, double *y, ThreadPool *pool) {
+    SpmvJob job = { A, x, y };
+    thread_pool_parallel_for(pool, A->nrows, CSR_SPMV_GRAIN, spmv_rows, &job);
+}
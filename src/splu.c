@@ -0,0 +1,584 @@
+#include "splu.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NONE ((size_t)-1)
+
+/* 方阵、row_ptr 单调且与 nnz 一致、行内列号严格递增且在 [0, n) 内 */
+static int bad_csr(const CsrMatrix *A) {
+    if (!A || !A->row_ptr || A->nrows != A->ncols || A->nrows == 0) return 1;
+    const size_t n = A->nrows;
+    if (A->row_ptr[0] != 0 || A->row_ptr[n] != A->nnz || (A->nnz && !A->col_idx)) return 1;
+    for (size_t i = 0; i < n; ++i) {
+        if (A->row_ptr[i + 1] < A->row_ptr[i]) return 1;
+        for (size_t q = A->row_ptr[i]; q < A->row_ptr[i + 1]; ++q)
+            if (A->col_idx[q] >= n || (q > A->row_ptr[i] && A->col_idx[q] <= A->col_idx[q - 1])) return 1;
+    }
+    return 0;
+}
+
+/* ------------------ A + A^T 的无向图（去掉对角、去重） ------------------ */
+static GAUSSIAN_Err sym_graph(const CsrMatrix *A, size_t **pptr, size_t **pidx) {
+    const size_t n = A->nrows;
+    size_t *ptr = (size_t*)calloc(n + 1, sizeof(size_t));
+    size_t *next = (size_t*)malloc(n * sizeof(size_t));
+    size_t *idx = (size_t*)malloc((2 * A->nnz + 1) * sizeof(size_t));
+    if (!ptr || !next || !idx) { free(ptr); free(next); free(idx); return GAUSSIAN_NO_MEMORY; }
+
+    for (size_t i = 0; i < n; ++i)
+        for (size_t q = A->row_ptr[i]; q < A->row_ptr[i + 1]; ++q) {
+            size_t j = A->col_idx[q];
+            if (j != i) { ptr[i + 1]++; ptr[j + 1]++; }
+        }
+    for (size_t i = 0; i < n; ++i) ptr[i + 1] += ptr[i];
+    memcpy(next, ptr, n * sizeof(size_t));
+    for (size_t i = 0; i < n; ++i)
+        for (size_t q = A->row_ptr[i]; q < A->row_ptr[i + 1]; ++q) {
+            size_t j = A->col_idx[q];
+            if (j != i) { idx[next[i]++] = j; idx[next[j]++] = i; }
+        }
+
+    /* 逐行去重并原地压缩；next 复用为标记 */
+    for (size_t i = 0; i < n; ++i) next[i] = NONE;
+    size_t w = 0, start = 0;
+    for (size_t i = 0; i < n; ++i) {
+        size_t end = ptr[i + 1];
+        ptr[i] = w;
+        for (size_t q = start; q < end; ++q) {
+            size_t j = idx[q];
+            if (next[j] != i) { next[j] = i; idx[w++] = j; }
+        }
+        start = end;
+    }
+    ptr[n] = w;
+    free(next);
+    *pptr = ptr;
+    *pidx = idx;
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 逆 Cuthill-McKee ------------------ */
+/* 从 root 做 BFS，queue 返回访问序列（长度即返回值），*last 为最后一层起点，*depth 为层数 */
+static size_t bfs_levels(const size_t *ptr, const size_t *idx, size_t root, size_t *mark,
+                         size_t stamp, size_t *queue, size_t *last, size_t *depth) {
+    size_t head = 0, tail = 0, level_start = 0, d = 0;
+    queue[tail++] = root;
+    mark[root] = stamp;
+    while (head < tail) {
+        size_t level_end = tail;
+        level_start = head;
+        d++;
+        for (; head < level_end; ++head) {
+            size_t v = queue[head];
+            for (size_t q = ptr[v]; q < ptr[v + 1]; ++q)
+                if (mark[idx[q]] != stamp) { mark[idx[q]] = stamp; queue[tail++] = idx[q]; }
+        }
+    }
+    *last = level_start;
+    *depth = d;
+    return tail;
+}
+
+static void rcm_order(size_t n, const size_t *ptr, const size_t *idx, size_t *perm, size_t *work) {
+    size_t *mark = work, *queue = work + n, *done = work + 2 * n;
+    size_t stamp = 0, k = 0;
+    for (size_t i = 0; i < n; ++i) { mark[i] = NONE; done[i] = 0; }
+#define DEG(v) (ptr[(v) + 1] - ptr[(v)])
+
+    for (size_t s = 0; s < n; ++s) {
+        if (done[s]) continue;
+        /* 伪外围点：反复取最后一层中度数最小的点，直到层数不再增加 */
+        size_t root = s, last, depth, cnt;
+        cnt = bfs_levels(ptr, idx, root, mark, stamp++, queue, &last, &depth);
+        for (;;) {
+            size_t best = queue[last];
+            for (size_t q = last + 1; q < cnt; ++q)
+                if (DEG(queue[q]) < DEG(best)) best = queue[q];
+            size_t last2, depth2;
+            size_t cnt2 = bfs_levels(ptr, idx, best, mark, stamp++, queue, &last2, &depth2);
+            if (depth2 <= depth) break;
+            root = best; last = last2; depth = depth2; cnt = cnt2;
+        }
+        /* Cuthill-McKee：BFS，同一父节点的新邻居按度数递增加入 */
+        size_t head = k;
+        perm[k++] = root;
+        done[root] = 1;
+        while (head < k) {
+            size_t v = perm[head++], first = k;
+            for (size_t q = ptr[v]; q < ptr[v + 1]; ++q) {
+                size_t u = idx[q];
+                if (!done[u]) { done[u] = 1; perm[k++] = u; }
+            }
+            for (size_t a = first + 1; a < k; ++a) {       /* 插入排序，邻居数很少 */
+                size_t u = perm[a], b = a;
+                while (b > first && DEG(perm[b - 1]) > DEG(u)) { perm[b] = perm[b - 1]; --b; }
+                perm[b] = u;
+            }
+        }
+    }
+#undef DEG
+    for (size_t i = 0; i < n / 2; ++i) {
+        size_t t = perm[i]; perm[i] = perm[n - 1 - i]; perm[n - 1 - i] = t;
+    }
+}
+
+GAUSSIAN_Err csr_order_rcm(const CsrMatrix *A, size_t *perm) {
+    if (bad_csr(A) || !perm) return GAUSSIAN_INVALID_INPUT;
+    const size_t n = A->nrows;
+    size_t *ptr, *idx;
+    GAUSSIAN_Err ret = sym_graph(A, &ptr, &idx);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+    size_t *work = (size_t*)malloc(3 * n * sizeof(size_t));
+    if (!work) ret = GAUSSIAN_NO_MEMORY;
+    else rcm_order(n, ptr, idx, perm, work);
+    free(work); free(ptr); free(idx);
+    return ret;
+}
+
+/* ------------------ 最小度 ------------------
+ * 在显式消去图上贪心：每步消去当前度数最小的点，并把它的邻居两两连成团。
+ * 度数只对受影响的邻居重算；堆中过期的条目在弹出时丢弃。 */
+typedef struct { size_t deg, v; } DegEntry;
+
+static int deg_less(DegEntry a, DegEntry b) {
+    return a.deg < b.deg || (a.deg == b.deg && a.v < b.v);
+}
+
+typedef struct {
+    DegEntry *h;
+    size_t len, cap;
+} DegHeap;
+
+static int heap_push(DegHeap *hp, size_t deg, size_t v) {
+    if (hp->len == hp->cap) {
+        size_t cap = hp->cap ? hp->cap * 2 : 64;
+        DegEntry *h = (DegEntry*)realloc(hp->h, cap * sizeof(DegEntry));
+        if (!h) return -1;
+        hp->h = h;
+        hp->cap = cap;
+    }
+    size_t i = hp->len++;
+    hp->h[i].deg = deg;
+    hp->h[i].v = v;
+    while (i > 0 && deg_less(hp->h[i], hp->h[(i - 1) / 2])) {
+        DegEntry t = hp->h[i]; hp->h[i] = hp->h[(i - 1) / 2]; hp->h[(i - 1) / 2] = t;
+        i = (i - 1) / 2;
+    }
+    return 0;
+}
+
+static DegEntry heap_pop(DegHeap *hp) {
+    DegEntry top = hp->h[0];
+    hp->h[0] = hp->h[--hp->len];
+    size_t i = 0;
+    for (;;) {
+        size_t l = 2 * i + 1, r = l + 1, m = i;
+        if (l < hp->len && deg_less(hp->h[l], hp->h[m])) m = l;
+        if (r < hp->len && deg_less(hp->h[r], hp->h[m])) m = r;
+        if (m == i) break;
+        DegEntry t = hp->h[m]; hp->h[m] = hp->h[i]; hp->h[i] = t;
+        i = m;
+    }
+    return top;
+}
+
+GAUSSIAN_Err csr_order_mindeg(const CsrMatrix *A, size_t *perm) {
+    if (bad_csr(A) || !perm) return GAUSSIAN_INVALID_INPUT;
+    const size_t n = A->nrows;
+    size_t *ptr, *idx;
+    GAUSSIAN_Err ret = sym_graph(A, &ptr, &idx);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+
+    size_t **adj = (size_t**)calloc(n, sizeof(size_t*));
+    size_t *len = (size_t*)malloc(n * sizeof(size_t));
+    size_t *cap = (size_t*)malloc(n * sizeof(size_t));
+    size_t *mark = (size_t*)malloc(n * sizeof(size_t));
+    unsigned char *elim = (unsigned char*)calloc(n, 1);
+    DegHeap hp = { NULL, 0, 0 };
+    ret = (adj && len && cap && mark && elim) ? GAUSSIAN_SUCCESS : GAUSSIAN_NO_MEMORY;
+    for (size_t i = 0; ret == GAUSSIAN_SUCCESS && i < n; ++i) {
+        len[i] = ptr[i + 1] - ptr[i];
+        cap[i] = len[i] ? len[i] : 1;
+        adj[i] = (size_t*)malloc(cap[i] * sizeof(size_t));
+        mark[i] = NONE;
+        if (!adj[i] || heap_push(&hp, len[i], i) != 0) { ret = GAUSSIAN_NO_MEMORY; break; }
+        memcpy(adj[i], idx + ptr[i], len[i] * sizeof(size_t));
+    }
+
+    size_t stamp = 0;
+    for (size_t k = 0; ret == GAUSSIAN_SUCCESS && k < n; ++k) {
+        DegEntry e;
+        do { e = heap_pop(&hp); } while (elim[e.v] || e.deg != len[e.v]);
+        const size_t p = e.v;
+        perm[k] = p;
+        elim[p] = 1;
+
+        /* 对每个邻居 i：adj(i) <- adj(i) \ {p} ∪ adj(p) \ {i} */
+        for (size_t a = 0; a < len[p] && ret == GAUSSIAN_SUCCESS; ++a) {
+            const size_t i = adj[p][a];
+            stamp++;
+            size_t w = 0;
+            for (size_t b = 0; b < len[i]; ++b) {
+                size_t j = adj[i][b];
+                if (j == p) continue;
+                mark[j] = stamp;
+                adj[i][w++] = j;
+            }
+            len[i] = w;
+            for (size_t b = 0; b < len[p]; ++b) {
+                size_t j = adj[p][b];
+                if (j == i || mark[j] == stamp) continue;
+                if (len[i] == cap[i]) {
+                    size_t nc = cap[i] * 2;
+                    size_t *t = (size_t*)realloc(adj[i], nc * sizeof(size_t));
+                    if (!t) { ret = GAUSSIAN_NO_MEMORY; break; }
+                    adj[i] = t;
+                    cap[i] = nc;
+                }
+                adj[i][len[i]++] = j;
+            }
+            if (ret == GAUSSIAN_SUCCESS && heap_push(&hp, len[i], i) != 0) ret = GAUSSIAN_NO_MEMORY;
+        }
+        free(adj[p]);
+        adj[p] = NULL;
+    }
+
+    if (adj) for (size_t i = 0; i < n; ++i) free(adj[i]);
+    free(adj); free(len); free(cap); free(mark); free(elim); free(hp.h);
+    free(ptr); free(idx);
+    return ret;
+}
+
+/* ------------------ 符号分析 ------------------ */
+void splu_symbolic_free(SpluSymbolic *sym) {
+    if (!sym) return;
+    free(sym->perm);
+    free(sym->iperm);
+    free(sym->col_ptr);
+    free(sym->row_idx);
+    free(sym->amap);
+    free(sym->a_row_ptr);
+    free(sym->a_col_idx);
+    memset(sym, 0, sizeof(*sym));
+}
+
+/* 消去树中第 i 行的行子树：L 第 i 行的非零列（无序），返回个数 */
+static size_t ereach(size_t i, const size_t *gp, const size_t *gi, const size_t *parent,
+                     size_t *mark, size_t *out) {
+    size_t cnt = 0;
+    mark[i] = i;
+    for (size_t q = gp[i]; q < gp[i + 1]; ++q) {
+        for (size_t j = gi[q]; j < i && mark[j] != i; j = parent[j]) {
+            mark[j] = i;
+            out[cnt++] = j;
+        }
+    }
+    return cnt;
+}
+
+/* 全取对角主元时 L/U 的非零数（A + A^T 模式的消去树行计数） */
+static GAUSSIAN_Err predict_counts(const CsrMatrix *A, SpluSymbolic *sym) {
+    const size_t n = sym->n;
+    size_t *gptr, *gidx;
+    GAUSSIAN_Err ret = sym_graph(A, &gptr, &gidx);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+    size_t *pp = (size_t*)malloc((n + 1) * sizeof(size_t));
+    size_t *pi = (size_t*)malloc((gptr[n] + 1) * sizeof(size_t));
+    size_t *parent = (size_t*)malloc(n * sizeof(size_t));
+    size_t *anc = (size_t*)malloc(n * sizeof(size_t));
+    size_t *mark = (size_t*)malloc(n * sizeof(size_t));
+    size_t *stack = (size_t*)malloc(n * sizeof(size_t));
+    if (!pp || !pi || !parent || !anc || !mark || !stack) {
+        ret = GAUSSIAN_NO_MEMORY;
+        goto cleanup;
+    }
+    pp[0] = 0;
+    for (size_t i = 0; i < n; ++i) {
+        size_t o = sym->perm[i], w = pp[i];
+        for (size_t q = gptr[o]; q < gptr[o + 1]; ++q) pi[w++] = sym->iperm[gidx[q]];
+        pp[i + 1] = w;
+    }
+
+    /* 消去树（Liu，带路径压缩） */
+    for (size_t i = 0; i < n; ++i) {
+        parent[i] = anc[i] = NONE;
+        for (size_t q = pp[i]; q < pp[i + 1]; ++q) {
+            size_t r = pi[q];
+            if (r >= i) continue;
+            while (anc[r] != NONE && anc[r] != i) {
+                size_t t = anc[r];
+                anc[r] = i;
+                r = t;
+            }
+            if (anc[r] == NONE) { anc[r] = i; parent[r] = i; }
+        }
+    }
+
+    /* 对称模式下 U 的第 j 列与 L 的第 j 行同型 */
+    for (size_t i = 0; i < n; ++i) mark[i] = NONE;
+    sym->nnz_l = 0;
+    for (size_t i = 0; i < n; ++i) sym->nnz_l += ereach(i, pp, pi, parent, mark, stack);
+    sym->nnz_u = sym->nnz_l + n;
+
+cleanup:
+    free(gptr); free(gidx); free(pp); free(pi); free(parent); free(anc);
+    free(mark); free(stack);
+    return ret;
+}
+
+GAUSSIAN_Err splu_analyze(const CsrMatrix *A, SpluOrdering ordering, SpluSymbolic *sym) {
+    if (bad_csr(A) || !sym) return GAUSSIAN_INVALID_INPUT;
+    const size_t n = A->nrows, nnz = A->nnz;
+    memset(sym, 0, sizeof(*sym));
+    sym->n = n;
+    sym->nnz_a = nnz;
+    sym->perm = (size_t*)malloc(n * sizeof(size_t));
+    sym->iperm = (size_t*)malloc(n * sizeof(size_t));
+    sym->col_ptr = (size_t*)calloc(n + 1, sizeof(size_t));
+    sym->row_idx = (size_t*)malloc((nnz + 1) * sizeof(size_t));
+    sym->amap = (size_t*)malloc((nnz + 1) * sizeof(size_t));
+    sym->a_row_ptr = (size_t*)malloc((n + 1) * sizeof(size_t));
+    sym->a_col_idx = (size_t*)malloc((nnz + 1) * sizeof(size_t));
+    if (!sym->perm || !sym->iperm || !sym->col_ptr || !sym->row_idx || !sym->amap
+        || !sym->a_row_ptr || !sym->a_col_idx) {
+        splu_symbolic_free(sym);
+        return GAUSSIAN_NO_MEMORY;
+    }
+    memcpy(sym->a_row_ptr, A->row_ptr, (n + 1) * sizeof(size_t));
+    if (nnz) memcpy(sym->a_col_idx, A->col_idx, nnz * sizeof(size_t));
+
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    switch (ordering) {
+    case SPLU_ORDER_NATURAL: for (size_t i = 0; i < n; ++i) sym->perm[i] = i; break;
+    case SPLU_ORDER_RCM: ret = csr_order_rcm(A, sym->perm); break;
+    case SPLU_ORDER_MINDEG: ret = csr_order_mindeg(A, sym->perm); break;
+    default: ret = GAUSSIAN_INVALID_INPUT; break;
+    }
+    if (ret == GAUSSIAN_SUCCESS) {
+        for (size_t i = 0; i < n; ++i) sym->iperm[sym->perm[i]] = i;
+        ret = predict_counts(A, sym);
+    }
+    if (ret != GAUSSIAN_SUCCESS) { splu_symbolic_free(sym); return ret; }
+
+    /* A 按新列次序转置为 CSC；按行号递增扫描，列内行号自然有序 */
+    size_t *cp = sym->col_ptr;
+    for (size_t q = 0; q < nnz; ++q) cp[sym->iperm[A->col_idx[q]] + 1]++;
+    for (size_t k = 0; k < n; ++k) cp[k + 1] += cp[k];
+    size_t *next = (size_t*)malloc(n * sizeof(size_t));
+    if (!next) { splu_symbolic_free(sym); return GAUSSIAN_NO_MEMORY; }
+    memcpy(next, cp, n * sizeof(size_t));
+    for (size_t i = 0; i < n; ++i)
+        for (size_t q = A->row_ptr[i]; q < A->row_ptr[i + 1]; ++q) {
+            size_t d = next[sym->iperm[A->col_idx[q]]]++;
+            sym->row_idx[d] = i;
+            sym->amap[d] = q;
+        }
+    free(next);
+
+    const size_t pred = sym->nnz_l + sym->nnz_u;
+    sym->fill_in = pred > nnz ? pred - nnz : 0;
+    /* perm, iperm, col_ptr, a_row_ptr, row_idx, amap, a_col_idx */
+    sym->symbolic_bytes = (4 * n + 2 + 3 * nnz) * sizeof(size_t);
+    /* L/U 的值与行号，外加 prow、pinv、l_ptr、u_ptr */
+    sym->numeric_bytes = pred * (sizeof(double) + sizeof(size_t)) + (4 * n + 2) * sizeof(size_t);
+    return GAUSSIAN_SUCCESS;
+}
+
+/* ------------------ 数值分解 ------------------ */
+void splu_numeric_free(SpluNumeric *num) {
+    if (!num) return;
+    free(num->prow);
+    free(num->pinv);
+    free(num->l_ptr);
+    free(num->l_idx);
+    free(num->l_val);
+    free(num->u_ptr);
+    free(num->u_idx);
+    free(num->u_val);
+    free(num->u_diag);
+    memset(num, 0, sizeof(*num));
+}
+
+/* 保证 (*idx, *val) 至少能容纳 need 个元素，按倍增扩容 */
+static int grow(size_t **idx, double **val, size_t *cap, size_t need) {
+    if (need <= *cap) return 0;
+    size_t c = *cap ? *cap : 16;
+    while (c < need) c *= 2;
+    size_t *ni = (size_t*)realloc(*idx, c * sizeof(size_t));
+    if (!ni) return -1;
+    *idx = ni;
+    double *nv = (double*)realloc(*val, c * sizeof(double));
+    if (!nv) return -1;
+    *val = nv;
+    *cap = c;
+    return 0;
+}
+
+/* 从原行号 r 出发在 L 的列图上做 DFS（已选主元行 r 的出边为 L(:, pinv[r])），
+ * 后序写入 xi[--top]，故 xi[top..n) 为拓扑序。非递归：stack/pstack 为工作区 */
+static size_t reach_dfs(size_t r, size_t top, const SpluNumeric *num, size_t stamp,
+                        size_t *mark, size_t *xi, size_t *stack, size_t *pstack) {
+    size_t head = 0;
+    stack[0] = r;
+    for (;;) {
+        const size_t j = stack[head];
+        const size_t t = num->pinv[j];
+        if (mark[j] != stamp) {
+            mark[j] = stamp;
+            pstack[head] = t == NONE ? 0 : num->l_ptr[t];
+        }
+        const size_t end = t == NONE ? 0 : num->l_ptr[t + 1];
+        size_t p = pstack[head];
+        while (p < end && mark[num->l_idx[p]] == stamp) ++p;
+        if (p < end) {
+            pstack[head] = p + 1;
+            stack[++head] = num->l_idx[p];
+            continue;
+        }
+        xi[--top] = j;
+        if (head == 0) break;
+        --head;
+    }
+    return top;
+}
+
+/* 左视列 LU：第 k 列 x = A(:, perm[k])，按拓扑序减去已完成的 L 列，
+ * 已选主元行上的分量为 U(:, k)，其余行中按阈值规则选主元并除得 L(:, k)。
+ * 分解过程中 L 的行号记原行号（DFS 需要），结束后统一换成步号 */
+GAUSSIAN_Err splu_factor(const SpluSymbolic *sym, const CsrMatrix *A, SpluNumeric *num) {
+    const double EPS = 1e-12;
+    if (!sym || !sym->col_ptr || bad_csr(A) || !A->val || !num) return GAUSSIAN_INVALID_INPUT;
+    const size_t n = sym->n;
+    if (A->nrows != n || A->nnz != sym->nnz_a
+        || memcmp(A->row_ptr, sym->a_row_ptr, (n + 1) * sizeof(size_t)) != 0
+        || (A->nnz && memcmp(A->col_idx, sym->a_col_idx, A->nnz * sizeof(size_t)) != 0))
+        return GAUSSIAN_INVALID_INPUT;
+
+    if (num->sym != sym || num->n != n || !num->prow) {
+        splu_numeric_free(num);
+        num->prow = (size_t*)malloc(n * sizeof(size_t));
+        num->pinv = (size_t*)malloc(n * sizeof(size_t));
+        num->l_ptr = (size_t*)malloc((n + 1) * sizeof(size_t));
+        num->u_ptr = (size_t*)malloc((n + 1) * sizeof(size_t));
+        num->u_diag = (double*)malloc(n * sizeof(double));
+        if (!num->prow || !num->pinv || !num->l_ptr || !num->u_ptr || !num->u_diag
+            || grow(&num->l_idx, &num->l_val, &num->l_cap, sym->nnz_l + 1) != 0
+            || grow(&num->u_idx, &num->u_val, &num->u_cap, sym->nnz_u - n + 1) != 0) {
+            splu_numeric_free(num);
+            return GAUSSIAN_NO_MEMORY;
+        }
+        num->sym = sym;
+        num->n = n;
+    }
+
+    double *x = (double*)calloc(n, sizeof(double));
+    size_t *iwork = (size_t*)malloc(4 * n * sizeof(size_t));
+    if (!x || !iwork) { free(x); free(iwork); return GAUSSIAN_NO_MEMORY; }
+    size_t *mark = iwork, *xi = iwork + n, *stack = iwork + 2 * n, *pstack = iwork + 3 * n;
+
+    for (size_t i = 0; i < n; ++i) { num->pinv[i] = NONE; mark[i] = NONE; }
+    num->l_ptr[0] = num->u_ptr[0] = 0;
+    num->off_diag_pivots = 0;
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    for (size_t k = 0; k < n; ++k) {
+        /* 符号：x 的非零行 = A(:, perm[k]) 各行在 L 列图上可达的行 */
+        size_t top = n;
+        for (size_t q = sym->col_ptr[k]; q < sym->col_ptr[k + 1]; ++q)
+            if (mark[sym->row_idx[q]] != k)
+                top = reach_dfs(sym->row_idx[q], top, num, k, mark, xi, stack, pstack);
+        for (size_t q = sym->col_ptr[k]; q < sym->col_ptr[k + 1]; ++q)
+            x[sym->row_idx[q]] = A->val[sym->amap[q]];
+
+        /* 数值：按拓扑序 x -= L(:, t) * x_j */
+        size_t nu = 0, nl = 0;
+        for (size_t p = top; p < n; ++p) {
+            const size_t j = xi[p], t = num->pinv[j];
+            if (t == NONE) { nl++; continue; }
+            nu++;
+            const double xj = x[j];
+            for (size_t q = num->l_ptr[t]; q < num->l_ptr[t + 1]; ++q)
+                x[num->l_idx[q]] -= num->l_val[q] * xj;
+        }
+        if (grow(&num->u_idx, &num->u_val, &num->u_cap, num->u_ptr[k] + nu) != 0
+            || grow(&num->l_idx, &num->l_val, &num->l_cap, num->l_ptr[k] + nl) != 0) {
+            ret = GAUSSIAN_NO_MEMORY;
+            break;
+        }
+
+        /* U(:, k) 与主元：首选行 perm[k] 满足阈值则取之，否则取 argmax */
+        size_t un = num->u_ptr[k], piv = NONE;
+        double amax = 0.0;
+        for (size_t p = top; p < n; ++p) {
+            const size_t j = xi[p], t = num->pinv[j];
+            if (t != NONE) {
+                num->u_idx[un] = t;
+                num->u_val[un++] = x[j];
+            } else if (fabs(x[j]) > amax) {
+                amax = fabs(x[j]);
+                piv = j;
+            }
+        }
+        num->u_ptr[k + 1] = un;
+        if (!(amax >= EPS)) {
+            for (size_t p = top; p < n; ++p) x[xi[p]] = 0.0;
+            ret = GAUSSIAN_BAD_MATRIX;
+            break;
+        }
+        const size_t d = sym->perm[k];
+        if (d != piv) {
+            if (num->pinv[d] == NONE && fabs(x[d]) >= SPLU_PIVOT_TAU * amax) piv = d;
+            else num->off_diag_pivots++;
+        }
+        const double ukk = x[piv];
+        num->u_diag[k] = ukk;
+        num->prow[k] = piv;
+        num->pinv[piv] = k;
+
+        size_t ln = num->l_ptr[k];
+        for (size_t p = top; p < n; ++p) {
+            const size_t j = xi[p];
+            if (num->pinv[j] == NONE) {
+                num->l_idx[ln] = j;
+                num->l_val[ln++] = x[j] / ukk;
+            }
+            x[j] = 0.0;
+        }
+        num->l_ptr[k + 1] = ln;
+    }
+
+    if (ret == GAUSSIAN_SUCCESS) {
+        for (size_t q = 0; q < num->l_ptr[n]; ++q) num->l_idx[q] = num->pinv[num->l_idx[q]];
+        num->nnz_l = num->l_ptr[n];
+        num->nnz_u = num->u_ptr[n] + n;
+    }
+    free(x);
+    free(iwork);
+    return ret;
+}
+
+/* P A Q = L U：y = P b，L U z = y，x = Q z */
+GAUSSIAN_Err splu_solve(const SpluNumeric *num, const double *b, double *x) {
+    if (!num || !num->sym || !num->prow || num->n != num->sym->n || !b || !x)
+        return GAUSSIAN_INVALID_INPUT;
+    const SpluSymbolic *sym = num->sym;
+    const size_t n = sym->n;
+    double *y = (double*)malloc(n * sizeof(double));
+    if (!y) return GAUSSIAN_NO_MEMORY;
+
+    for (size_t k = 0; k < n; ++k) y[k] = b[num->prow[k]];
+    for (size_t k = 0; k < n; ++k) {
+        const double yk = y[k];
+        for (size_t q = num->l_ptr[k]; q < num->l_ptr[k + 1]; ++q)
+            y[num->l_idx[q]] -= num->l_val[q] * yk;
+    }
+    for (size_t k = n; k-- > 0;) {
+        const double yk = y[k] /= num->u_diag[k];
+        for (size_t q = num->u_ptr[k]; q < num->u_ptr[k + 1]; ++q)
+            y[num->u_idx[q]] -= num->u_val[q] * yk;
+    }
+    for (size_t k = 0; k < n; ++k) x[sym->perm[k]] = y[k];
+    free(y);
+    return GAUSSIAN_SUCCESS;
+}
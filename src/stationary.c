@@ -0,0 +1,292 @@
+#include "iterative.h"
+#include "thread_pool.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NONE ((size_t)-1)
+/* 自动估计 omega 前的 Gauss-Seidel 扫描次数 */
+#define STATIONARY_OMEGA_PROBE 16
+/* 部分和的固定分块长度：归约顺序与线程数无关 */
+#define STATIONARY_BLOCK 256
+
+/* ------------------ 扫描上下文：稠密 / CSR 二选一 ------------------ */
+typedef struct {
+    size_t n;
+    const CsrMatrix *csr;
+    const double *dense;
+    size_t lda;
+
+    const double *b;
+    double *x;
+    double *xold;           /* Jacobi：扫描前的迭代 */
+    double *dinv;
+    size_t *order;          /* 按颜色排列的行号，color_ptr 给出各色区间 */
+    size_t *color_ptr;
+    size_t ncolors;
+
+    StationaryMethod method;
+    double omega;
+    ThreadPool *pool;
+    size_t nworkers;
+    double *partial;        /* 每块两个部分和：残差平方、修正量平方 */
+
+    /* 当前并行段 */
+    size_t r0, r1;
+    int update;             /* 0 = 只计算残差 */
+} StatCtx;
+
+static double row_dot(const StatCtx *s, size_t i, const double *x) {
+    double sum = 0.0;
+    if (s->csr) {
+        const CsrMatrix *A = s->csr;
+        for (size_t q = A->row_ptr[i]; q < A->row_ptr[i + 1]; ++q) sum += A->val[q] * x[A->col_idx[q]];
+    } else {
+        /* 与着色的判据一致：a_ij == 0 时不读 x[j]。同色行的 x[j] 正被其他线程写入，
+         * 且 0 * inf / 0 * NaN 会把 NaN 带进本行 */
+        const double *a = s->dense + i * s->lda;
+        for (size_t j = 0; j < s->n; ++j) {
+            const double aij = a[j];
+            if (aij != 0.0) sum += aij * x[j];
+        }
+    }
+    return sum;
+}
+
+/* [r0, r1) 按 STATIONARY_BLOCK 分块，各工作线程处理连续的若干块，部分和按块存放 */
+static void sweep_worker(void *p, size_t w) {
+    StatCtx *s = (StatCtx*)p;
+    const size_t nblk = (s->r1 - s->r0 + STATIONARY_BLOCK - 1) / STATIONARY_BLOCK, nw = s->nworkers;
+    const double *xr = s->method == STATIONARY_JACOBI && s->update ? s->xold : s->x;
+    for (size_t blk = nblk * w / nw; blk < nblk * (w + 1) / nw; ++blk) {
+        const size_t kb = s->r0 + blk * STATIONARY_BLOCK;
+        const size_t ke = kb + STATIONARY_BLOCK < s->r1 ? kb + STATIONARY_BLOCK : s->r1;
+        double rr = 0.0, dd = 0.0;
+        for (size_t k = kb; k < ke; ++k) {
+            const size_t i = s->order ? s->order[k] : k;
+            const double r = s->b[i] - row_dot(s, i, xr);
+            rr += r * r;
+            if (s->update) {
+                const double dx = s->omega * r * s->dinv[i];
+                s->x[i] = xr[i] + dx;
+                dd += dx * dx;
+            }
+        }
+        s->partial[2 * blk] = rr;
+        s->partial[2 * blk + 1] = dd;
+    }
+}
+
+static void run_segment(StatCtx *s, size_t r0, size_t r1, double *rr, double *dd) {
+    s->r0 = r0;
+    s->r1 = r1;
+    thread_pool_run(s->pool, sweep_worker, s);
+    const size_t nblk = (r1 - r0 + STATIONARY_BLOCK - 1) / STATIONARY_BLOCK;
+    for (size_t blk = 0; blk < nblk; ++blk) {
+        *rr += s->partial[2 * blk];
+        *dd += s->partial[2 * blk + 1];
+    }
+}
+
+/* 一次完整扫描，返回各行更新时刻的残差平方和与修正量平方和 */
+static void sweep(StatCtx *s, double *rr, double *dd) {
+    *rr = *dd = 0.0;
+    s->update = 1;
+    if (s->method == STATIONARY_JACOBI) {
+        memcpy(s->xold, s->x, s->n * sizeof(double));
+        run_segment(s, 0, s->n, rr, dd);
+        return;
+    }
+    for (size_t c = 0; c < s->ncolors; ++c)
+        run_segment(s, s->color_ptr[c], s->color_ptr[c + 1], rr, dd);
+}
+
+static double true_residual(StatCtx *s, double bnorm) {
+    double rr = 0.0, dd = 0.0;
+    size_t *order = s->order;
+    s->order = NULL;
+    s->update = 0;
+    run_segment(s, 0, s->n, &rr, &dd);
+    s->order = order;
+    return sqrt(rr) / bnorm;
+}
+
+/* ------------------ 多色着色 ------------------
+ * 按行号贪心取邻居未用的最小颜色；邻接取 A + A^T 的模式。
+ * 行按颜色稳定排序写入 order。 */
+static GAUSSIAN_Err build_colors(StatCtx *s) {
+    const size_t n = s->n;
+    size_t *color = (size_t*)malloc(n * sizeof(size_t));
+    size_t *forbid = (size_t*)malloc((n + 1) * sizeof(size_t));
+    size_t *tptr = NULL, *tidx = NULL;
+    GAUSSIAN_Err ret = (color && forbid) ? GAUSSIAN_SUCCESS : GAUSSIAN_NO_MEMORY;
+
+    const CsrMatrix *A = s->csr;
+    if (ret == GAUSSIAN_SUCCESS && A) {
+        /* 转置模式：第 j 列出现在哪些行 */
+        tptr = (size_t*)calloc(n + 1, sizeof(size_t));
+        tidx = (size_t*)malloc((A->nnz + 1) * sizeof(size_t));
+        if (!tptr || !tidx) ret = GAUSSIAN_NO_MEMORY;
+        else {
+            for (size_t q = 0; q < A->nnz; ++q) tptr[A->col_idx[q] + 1]++;
+            for (size_t j = 0; j < n; ++j) tptr[j + 1] += tptr[j];
+            for (size_t i = 0; i < n; ++i)
+                for (size_t q = A->row_ptr[i]; q < A->row_ptr[i + 1]; ++q)
+                    tidx[tptr[A->col_idx[q]]++] = i;
+            for (size_t j = n; j > 0; --j) tptr[j] = tptr[j - 1];
+            tptr[0] = 0;
+        }
+    }
+
+    size_t ncolors = 0;
+    for (size_t c = 0; ret == GAUSSIAN_SUCCESS && c <= n; ++c) forbid[c] = NONE;
+    for (size_t i = 0; ret == GAUSSIAN_SUCCESS && i < n; ++i) {
+        if (A) {
+            for (size_t q = A->row_ptr[i]; q < A->row_ptr[i + 1]; ++q)
+                if (A->col_idx[q] < i) forbid[color[A->col_idx[q]]] = i;
+            for (size_t q = tptr[i]; q < tptr[i + 1]; ++q)
+                if (tidx[q] < i) forbid[color[tidx[q]]] = i;
+        } else {
+            for (size_t j = 0; j < i; ++j)
+                if (s->dense[IDX(i, j, s->lda)] != 0.0 || s->dense[IDX(j, i, s->lda)] != 0.0)
+                    forbid[color[j]] = i;
+        }
+        size_t c = 0;
+        while (forbid[c] == i) c++;
+        color[i] = c;
+        if (c + 1 > ncolors) ncolors = c + 1;
+    }
+
+    if (ret == GAUSSIAN_SUCCESS) {
+        s->order = (size_t*)malloc(n * sizeof(size_t));
+        s->color_ptr = (size_t*)calloc(ncolors + 1, sizeof(size_t));
+        if (!s->order || !s->color_ptr) ret = GAUSSIAN_NO_MEMORY;
+    }
+    if (ret == GAUSSIAN_SUCCESS) {
+        s->ncolors = ncolors;
+        for (size_t i = 0; i < n; ++i) s->color_ptr[color[i] + 1]++;
+        for (size_t c = 0; c < ncolors; ++c) s->color_ptr[c + 1] += s->color_ptr[c];
+        memcpy(forbid, s->color_ptr, ncolors * sizeof(size_t));
+        for (size_t i = 0; i < n; ++i) s->order[forbid[color[i]]++] = i;
+    }
+    free(color); free(forbid); free(tptr); free(tidx);
+    return ret;
+}
+
+/* ------------------ 公共驱动 ------------------ */
+static GAUSSIAN_Err stationary_run(StatCtx *s, const IterOptions *opts, IterStatus *st) {
+    const double EPS = 1e-12;
+    const size_t n = s->n;
+    IterOptions def;
+    if (!opts) { iter_options_default(&def); opts = &def; }
+    if (st) { st->iterations = 0; st->residual = 0.0; st->history_len = 0; st->omega = 1.0; }
+    if (s->method > STATIONARY_SOR || (opts->omega != 0.0 && !(opts->omega > 0.0 && opts->omega < 2.0)))
+        return GAUSSIAN_INVALID_INPUT;
+
+    double bb = 0.0;
+    for (size_t i = 0; i < n; ++i) bb += s->b[i] * s->b[i];
+    const double bnorm = sqrt(bb);
+    if (bnorm == 0.0) {
+        memset(s->x, 0, n * sizeof(double));
+        return GAUSSIAN_SUCCESS;
+    }
+
+    GAUSSIAN_Err ret = GAUSSIAN_SUCCESS;
+    s->dinv = (double*)malloc(n * sizeof(double));
+    if (!s->dinv) ret = GAUSSIAN_NO_MEMORY;
+    for (size_t i = 0; ret == GAUSSIAN_SUCCESS && i < n; ++i) {
+        double d = 0.0;
+        if (s->csr) {
+            for (size_t q = s->csr->row_ptr[i]; q < s->csr->row_ptr[i + 1]; ++q)
+                if (s->csr->col_idx[q] == i) d += s->csr->val[q];
+        } else {
+            d = s->dense[IDX(i, i, s->lda)];
+        }
+        if (fabs(d) < EPS) ret = GAUSSIAN_BAD_MATRIX;
+        else s->dinv[i] = 1.0 / d;
+    }
+    if (ret == GAUSSIAN_SUCCESS && s->method == STATIONARY_JACOBI) {
+        s->xold = (double*)malloc(n * sizeof(double));
+        if (!s->xold) ret = GAUSSIAN_NO_MEMORY;
+    }
+    if (ret == GAUSSIAN_SUCCESS && s->method != STATIONARY_JACOBI) ret = build_colors(s);
+    if (ret == GAUSSIAN_SUCCESS && opts->nthreads != 1) {
+        s->pool = thread_pool_create(opts->nthreads);
+        if (!s->pool) ret = GAUSSIAN_NO_MEMORY;
+    }
+    if (ret == GAUSSIAN_SUCCESS) {
+        s->nworkers = thread_pool_size(s->pool);
+        s->partial = (double*)malloc(2 * (n / STATIONARY_BLOCK + 1) * sizeof(double));
+        if (!s->partial) ret = GAUSSIAN_NO_MEMORY;
+    }
+
+    int probe = s->method == STATIONARY_SOR && opts->omega == 0.0;
+    s->omega = (s->method == STATIONARY_SOR && !probe) ? opts->omega : 1.0;
+    double res = INFINITY, dprev = 0.0;
+    size_t it = 0;
+    if (ret == GAUSSIAN_SUCCESS) ret = GAUSSIAN_NOT_CONVERGED;
+    while (ret == GAUSSIAN_NOT_CONVERGED && it < opts->max_iter) {
+        double rr, dd;
+        sweep(s, &rr, &dd);
+        ++it;
+        double est = sqrt(rr) / bnorm;
+        if (st) {
+            st->iterations = it;
+            if (st->history && st->history_len < st->history_cap) st->history[st->history_len++] = est;
+        }
+        if (!isfinite(est)) break;
+
+        /* rho(GS) ~ 相邻两次修正量之比 */
+        if (probe && it >= STATIONARY_OMEGA_PROBE) {
+            double rho = dprev > 0.0 ? sqrt(dd / dprev) : 0.0;
+            if (rho < 1.0) s->omega = 2.0 / (1.0 + sqrt(1.0 - rho));
+            probe = 0;
+        }
+        dprev = dd;
+
+        if (est <= opts->tol || it == opts->max_iter) {
+            res = true_residual(s, bnorm);
+            if (res <= opts->tol) ret = GAUSSIAN_SUCCESS;
+        }
+    }
+    if (st) {
+        st->residual = isfinite(res) ? res : (ret == GAUSSIAN_NOT_CONVERGED ? INFINITY : 0.0);
+        st->omega = s->omega;
+    }
+
+    free(s->dinv); free(s->xold); free(s->order); free(s->color_ptr); free(s->partial);
+    thread_pool_destroy(s->pool);
+    return ret;
+}
+
+GAUSSIAN_Err stationary_solve_csr(const CsrMatrix *A, const double *b, double *x,
+                                  StationaryMethod method, const IterOptions *opts,
+                                  IterStatus *status) {
+    if (!A || !A->row_ptr || !b || !x || A->nrows != A->ncols || A->nrows == 0)
+        return GAUSSIAN_INVALID_INPUT;
+    StatCtx s;
+    memset(&s, 0, sizeof(s));
+    s.n = A->nrows;
+    s.csr = A;
+    s.b = b;
+    s.x = x;
+    s.method = method;
+    return stationary_run(&s, opts, status);
+}
+
+GAUSSIAN_Err stationary_solve_dense(size_t n, const double *A, size_t lda,
+                                    const double *b, double *x,
+                                    StationaryMethod method, const IterOptions *opts,
+                                    IterStatus *status) {
+    if (!A || !b || !x || n == 0 || lda < n) return GAUSSIAN_INVALID_INPUT;
+    StatCtx s;
+    memset(&s, 0, sizeof(s));
+    s.n = n;
+    s.dense = A;
+    s.lda = lda;
+    s.b = b;
+    s.x = x;
+    s.method = method;
+    return stationary_run(&s, opts, status);
+}
@@ -0,0 +1,318 @@
+#include "thread_pool.h"
+#include "thread_sync.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+struct ThreadPool {
+    size_t nthreads;
+    ThreadHandle *threads;          /* nthreads - 1 个后台线程 */
+    ThreadMutex lock;
+    ThreadCond start;
+    ThreadCond done;
+    unsigned long generation;    /* 每次 run 自增，唤醒工作线程 */
+    size_t active;               /* 尚未完成本轮的后台线程数 */
+    int stop;
+    ThreadPoolFn fn;
+    void *ctx;
+};
+
+typedef struct {
+    ThreadPool *pool;
+    size_t id;
+} WorkerArg;
+
+static WorkerArg *worker_args_of(ThreadPool *pool) {
+    return (WorkerArg*)(pool->threads + pool->nthreads);
+}
+
+size_t thread_pool_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long c = sysconf(_SC_NPROCESSORS_ONLN);
+    return c > 0 ? (size_t)c : 1;
+#endif
+}
+
+static ThreadRet THREAD_CALL worker_main(void *p) {
+    WorkerArg *arg = (WorkerArg*)p;
+    ThreadPool *pool = arg->pool;
+    unsigned long seen = 0;
+
+    thread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->stop)
+            thread_cond_wait(&pool->start, &pool->lock);
+        if (pool->stop) break;
+        seen = pool->generation;
+        ThreadPoolFn fn = pool->fn;
+        void *ctx = pool->ctx;
+        thread_mutex_unlock(&pool->lock);
+
+        fn(ctx, arg->id);
+
+        thread_mutex_lock(&pool->lock);
+        if (--pool->active == 0) thread_cond_signal(&pool->done);
+    }
+    thread_mutex_unlock(&pool->lock);
+    return (ThreadRet)0;
+}
+
+ThreadPool *thread_pool_create(size_t nthreads) {
+    if (nthreads == 0) nthreads = thread_pool_cpu_count();
+    ThreadPool *pool = (ThreadPool*)calloc(1, sizeof(ThreadPool));
+    if (!pool) return NULL;
+    pool->nthreads = nthreads;
+    /* 线程句柄与参数放在同一块内存中 */
+    pool->threads = (ThreadHandle*)malloc(nthreads * (sizeof(ThreadHandle) + sizeof(WorkerArg)));
+    if (!pool->threads) { free(pool); return NULL; }
+    thread_mutex_init(&pool->lock);
+    thread_cond_init(&pool->start);
+    thread_cond_init(&pool->done);
+
+    WorkerArg *args = worker_args_of(pool);
+    for (size_t t = 1; t < nthreads; ++t) {
+        args[t].pool = pool;
+        args[t].id = t;
+        if (thread_create(&pool->threads[t], worker_main, &args[t]) != 0) {
+            pool->nthreads = t;     /* 只回收已创建的线程 */
+            thread_pool_destroy(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+void thread_pool_destroy(ThreadPool *pool) {
+    if (!pool) return;
+    thread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    thread_cond_broadcast(&pool->start);
+    thread_mutex_unlock(&pool->lock);
+    for (size_t t = 1; t < pool->nthreads; ++t)
+        thread_join(pool->threads[t]);
+    thread_cond_destroy(&pool->done);
+    thread_cond_destroy(&pool->start);
+    thread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+size_t thread_pool_size(const ThreadPool *pool) {
+    return pool ? pool->nthreads : 1;
+}
+
+void thread_pool_run(ThreadPool *pool, ThreadPoolFn fn, void *ctx) {
+    if (!pool || pool->nthreads == 1) { fn(ctx, 0); return; }
+
+    thread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->active = pool->nthreads - 1;
+    pool->generation++;
+    thread_cond_broadcast(&pool->start);
+    thread_mutex_unlock(&pool->lock);
+
+    fn(ctx, 0);
+
+    thread_mutex_lock(&pool->lock);
+    while (pool->active > 0)
+        thread_cond_wait(&pool->done, &pool->lock);
+    thread_mutex_unlock(&pool->lock);
+}
+
+/* ------------------ parallel_for：原子计数器动态分块 ------------------ */
+typedef struct {
+    atomic_size_t next;
+    size_t n;
+    size_t grain;
+    ThreadPoolRangeFn fn;
+    void *ctx;
+} RangeJob;
+
+static void range_worker(void *p, size_t worker) {
+    (void)worker;
+    RangeJob *job = (RangeJob*)p;
+    for (;;) {
+        size_t b = atomic_fetch_add(&job->next, job->grain);
+        if (b >= job->n) break;
+        size_t e = (job->n - b < job->grain) ? job->n : b + job->grain;
+        job->fn(job->ctx, b, e);
+    }
+}
+
+void thread_pool_parallel_for(ThreadPool *pool, size_t n, size_t grain,
+                              ThreadPoolRangeFn fn, void *ctx) {
+    if (n == 0) return;
+    size_t nt = thread_pool_size(pool);
+    if (grain == 0) {
+        grain = n / (nt * 4);
+        if (grain == 0) grain = 1;
+    }
+    if (nt == 1 || grain >= n) { fn(ctx, 0, n); return; }
+
+    RangeJob job;
+    atomic_init(&job.next, 0);
+    job.n = n;
+    job.grain = grain;
+    job.fn = fn;
+    job.ctx = ctx;
+    thread_pool_run(pool, range_worker, &job);
+}
+
+/* ------------------ 任务图：依赖计数 + 优先级堆 ------------------ */
+typedef struct {
+    TaskFn fn;
+    void *arg;
+    int priority;
+    size_t npred;          /* 未完成的前驱数 */
+    size_t *succ;
+    size_t nsucc, capsucc;
+} TaskNode;
+
+struct TaskGraph {
+    TaskNode *tasks;
+    size_t ntasks, cap;
+
+    /* 运行期状态 */
+    ThreadMutex lock;
+    ThreadCond ready_cv;
+    size_t *heap;          /* 就绪任务（按优先级的二叉堆） */
+    size_t nheap;
+    size_t finished;
+};
+
+TaskGraph *task_graph_create(void) {
+    return (TaskGraph*)calloc(1, sizeof(TaskGraph));
+}
+
+void task_graph_destroy(TaskGraph *g) {
+    if (!g) return;
+    for (size_t i = 0; i < g->ntasks; ++i) free(g->tasks[i].succ);
+    free(g->tasks);
+    free(g->heap);
+    free(g);
+}
+
+size_t task_graph_add(TaskGraph *g, TaskFn fn, void *arg, int priority) {
+    if (!g || !fn) return TASK_GRAPH_INVALID;
+    if (g->ntasks == g->cap) {
+        size_t cap = g->cap ? g->cap * 2 : 64;
+        TaskNode *t = (TaskNode*)realloc(g->tasks, cap * sizeof(TaskNode));
+        if (!t) return TASK_GRAPH_INVALID;
+        g->tasks = t;
+        /* 就绪堆容量与任务数同步增长，run 时不再分配 */
+        size_t *h = (size_t*)realloc(g->heap, cap * sizeof(size_t));
+        if (!h) return TASK_GRAPH_INVALID;
+        g->heap = h;
+        g->cap = cap;
+    }
+    TaskNode *t = &g->tasks[g->ntasks];
+    t->fn = fn;
+    t->arg = arg;
+    t->priority = priority;
+    t->npred = 0;
+    t->succ = NULL;
+    t->nsucc = t->capsucc = 0;
+    return g->ntasks++;
+}
+
+int task_graph_depend(TaskGraph *g, size_t before, size_t after) {
+    if (!g || before >= g->ntasks || after >= g->ntasks || before == after) return -1;
+    TaskNode *b = &g->tasks[before];
+    if (b->nsucc == b->capsucc) {
+        size_t cap = b->capsucc ? b->capsucc * 2 : 4;
+        size_t *s = (size_t*)realloc(b->succ, cap * sizeof(size_t));
+        if (!s) return -1;
+        b->succ = s;
+        b->capsucc = cap;
+    }
+    b->succ[b->nsucc++] = after;
+    g->tasks[after].npred++;
+    return 0;
+}
+
+static int heap_less(const TaskGraph *g, size_t a, size_t b) {
+    int pa = g->tasks[g->heap[a]].priority, pb = g->tasks[g->heap[b]].priority;
+    /* 同优先级时编号小者优先，保证调度顺序确定 */
+    return pa < pb || (pa == pb && g->heap[a] > g->heap[b]);
+}
+
+static void heap_push(TaskGraph *g, size_t id) {
+    size_t i = g->nheap++;
+    g->heap[i] = id;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!heap_less(g, parent, i)) break;
+        size_t t = g->heap[parent]; g->heap[parent] = g->heap[i]; g->heap[i] = t;
+        i = parent;
+    }
+}
+
+static size_t heap_pop(TaskGraph *g) {
+    size_t top = g->heap[0];
+    g->heap[0] = g->heap[--g->nheap];
+    size_t i = 0;
+    for (;;) {
+        size_t l = 2 * i + 1, r = l + 1, m = i;
+        if (l < g->nheap && heap_less(g, m, l)) m = l;
+        if (r < g->nheap && heap_less(g, m, r)) m = r;
+        if (m == i) break;
+        size_t t = g->heap[m]; g->heap[m] = g->heap[i]; g->heap[i] = t;
+        i = m;
+    }
+    return top;
+}
+
+static void graph_worker(void *p, size_t worker) {
+    (void)worker;
+    TaskGraph *g = (TaskGraph*)p;
+    thread_mutex_lock(&g->lock);
+    for (;;) {
+        while (g->nheap == 0 && g->finished < g->ntasks)
+            thread_cond_wait(&g->ready_cv, &g->lock);
+        if (g->finished == g->ntasks) break;
+
+        size_t id = heap_pop(g);
+        thread_mutex_unlock(&g->lock);
+
+        g->tasks[id].fn(g->tasks[id].arg);
+
+        thread_mutex_lock(&g->lock);
+        TaskNode *t = &g->tasks[id];
+        size_t woke = 0;
+        for (size_t s = 0; s < t->nsucc; ++s) {
+            if (--g->tasks[t->succ[s]].npred == 0) {
+                heap_push(g, t->succ[s]);
+                woke++;
+            }
+        }
+        g->finished++;
+        if (g->finished == g->ntasks) thread_cond_broadcast(&g->ready_cv);
+        else if (woke > 1) thread_cond_broadcast(&g->ready_cv);
+        else if (woke == 1) thread_cond_signal(&g->ready_cv);
+    }
+    thread_mutex_unlock(&g->lock);
+}
+
+void task_graph_run(TaskGraph *g, ThreadPool *pool) {
+    if (!g || g->ntasks == 0) return;
+    g->nheap = 0;
+    g->finished = 0;
+    for (size_t i = 0; i < g->ntasks; ++i)
+        if (g->tasks[i].npred == 0) heap_push(g, i);
+
+    thread_mutex_init(&g->lock);
+    thread_cond_init(&g->ready_cv);
+    thread_pool_run(pool, graph_worker, g);
+    thread_cond_destroy(&g->ready_cv);
+    thread_mutex_destroy(&g->lock);
+}
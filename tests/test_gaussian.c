@@ -1,7 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+#include <float.h>
 #include "Gaussian.h"
+#include "gaussian_simd.h"
+#define TEST_SEED 12345ULL
+#include "test_gaussian_common.h"
 
 
 /* (B) 拷贝式：不修改原 A，把 2D 拷贝到连续缓冲区，再求解 */
@@ -54,6 +59,688 @@ void print_mat(const char *name, const double *A, size_t n, size_t lda) {
     }
 }
 
+static void fill_random(size_t n, double *A, size_t lda) {
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j)
+            A[IDX(i,j,lda)] = rand_unit();
+}
+
+/* 与 lu_decompose_pp 的输出（LU0, p0）在舍入误差内一致：P A = L U 的重构误差小；
+ * 累加次序不同，近似平局处主元可能不同，主元序列相同时才逐元素比较因子。
+ * *maxdiff 返回两者中较大的偏差 */
+static int lu_matches_pp(size_t n, size_t lda, const double *A, const double *LU0, const size_t *p0,
+                         const double *LU1, const size_t *p1, double *maxdiff) {
+    double amax = 0.0, rerr = 0.0, fdiff = 0.0;
+    int same = 1;
+    for (size_t i = 0; i < n; ++i) {
+        if (p0[i] != p1[i] || p1[i] >= n) same = 0;
+        for (size_t j = 0; j < n; ++j)
+            if (fabs(A[IDX(i,j,lda)]) > amax) amax = fabs(A[IDX(i,j,lda)]);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (p1[i] >= n) { rerr = INFINITY; break; }
+        for (size_t j = 0; j < n; ++j) {
+            size_t kmax = i < j ? i : j;
+            double s = i <= j ? LU1[IDX(i,j,lda)] : LU1[IDX(i,j,lda)] * LU1[IDX(j,j,lda)];
+            for (size_t k = 0; k < kmax; ++k) s += LU1[IDX(i,k,lda)] * LU1[IDX(k,j,lda)];
+            double d = fabs(A[IDX(p1[i],j,lda)] - s);
+            if (d > rerr) rerr = d;
+            if (same && fabs(LU0[IDX(i,j,lda)] - LU1[IDX(i,j,lda)]) > fdiff)
+                fdiff = fabs(LU0[IDX(i,j,lda)] - LU1[IDX(i,j,lda)]);
+        }
+    }
+    rerr = amax > 0.0 ? rerr / amax : rerr;
+    *maxdiff = rerr > fdiff ? rerr : fdiff;
+    return *maxdiff <= 1e-10;
+}
+
+/* 分块 LU 与 lu_decompose_pp 对比：在舍入误差内一致 */
+static int test_lu_blocked(size_t n, size_t lda) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *A0 = (double*)malloc(n * lda * sizeof(double));
+    double *A1 = (double*)malloc(n * lda * sizeof(double));
+    size_t *p0 = (size_t*)malloc(n * sizeof(size_t));
+    size_t *p1 = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && A0 && A1 && p0 && p1;
+    if (ok) {
+        fill_random(n, A, lda);
+        memcpy(A0, A, n * lda * sizeof(double));
+        memcpy(A1, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, A0, lda, p0) == GAUSSIAN_SUCCESS
+          && lu_decompose_blocked(n, A1, lda, p1) == GAUSSIAN_SUCCESS;
+        double maxdiff = 0.0;
+        ok = ok && lu_matches_pp(n, lda, A, A0, p0, A1, p1, &maxdiff);
+        printf("[TEST] lu_decompose_blocked n=%zu lda=%zu maxdiff=%.3g %s\n",
+               n, lda, maxdiff, ok ? "PASS" : "FAIL");
+    }
+    free(A); free(A0); free(A1); free(p0); free(p1);
+    return ok;
+}
+
+/* 递归 LU 与 lu_decompose_pp 对比：在舍入误差内一致 */
+static int test_lu_recursive(size_t n, size_t lda) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *A0 = (double*)malloc(n * lda * sizeof(double));
+    double *A1 = (double*)malloc(n * lda * sizeof(double));
+    size_t *p0 = (size_t*)malloc(n * sizeof(size_t));
+    size_t *p1 = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && A0 && A1 && p0 && p1;
+    if (ok) {
+        fill_random(n, A, lda);
+        memcpy(A0, A, n * lda * sizeof(double));
+        memcpy(A1, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, A0, lda, p0) == GAUSSIAN_SUCCESS
+          && lu_decompose_recursive(n, A1, lda, p1) == GAUSSIAN_SUCCESS;
+        double maxdiff = 0.0;
+        ok = ok && lu_matches_pp(n, lda, A, A0, p0, A1, p1, &maxdiff);
+        /* 奇异：第 0 列全零 */
+        for (size_t i = 0; ok && i < n; ++i) A1[IDX(i,0,lda)] = 0.0;
+        if (ok && lu_decompose_recursive(n, A1, lda, p1) != GAUSSIAN_BAD_MATRIX) ok = 0;
+        printf("[TEST] lu_decompose_recursive n=%zu lda=%zu maxdiff=%.3g %s\n",
+               n, lda, maxdiff, ok ? "PASS" : "FAIL");
+    }
+    free(A); free(A0); free(A1); free(p0); free(p1);
+    return ok;
+}
+
+/* 分片多线程 LU 与 lu_decompose_pp 对比：在舍入误差内一致 */
+static int test_lu_tiled(size_t n, size_t lda, size_t nb, size_t nthreads) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *A0 = (double*)malloc(n * lda * sizeof(double));
+    double *A1 = (double*)malloc(n * lda * sizeof(double));
+    size_t *p0 = (size_t*)malloc(n * sizeof(size_t));
+    size_t *p1 = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && A0 && A1 && p0 && p1;
+    if (ok) {
+        fill_random(n, A, lda);
+        memcpy(A0, A, n * lda * sizeof(double));
+        memcpy(A1, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, A0, lda, p0) == GAUSSIAN_SUCCESS
+          && lu_decompose_tiled(n, A1, lda, p1, nb, nthreads) == GAUSSIAN_SUCCESS;
+        double maxdiff = 0.0;
+        ok = ok && lu_matches_pp(n, lda, A, A0, p0, A1, p1, &maxdiff);
+        printf("[TEST] lu_decompose_tiled n=%zu nb=%zu threads=%zu maxdiff=%.3g %s\n",
+               n, nb, nthreads, maxdiff, ok ? "PASS" : "FAIL");
+    }
+    free(A); free(A0); free(A1); free(p0); free(p1);
+    return ok;
+}
+
+/* 奇异矩阵应返回 GAUSSIAN_BAD_MATRIX */
+static int test_lu_tiled_singular(void) {
+    const size_t n = 50;
+    double *A = (double*)malloc(n * n * sizeof(double));
+    size_t piv[50];
+    if (!A) return 0;
+    fill_random(n, A, n);
+    for (size_t j = 0; j < n; ++j) A[IDX(37,j,n)] = 2.0 * A[IDX(5,j,n)];
+    GAUSSIAN_Err ret = lu_decompose_tiled(n, A, n, piv, 16, 3);
+    int ok = ret == GAUSSIAN_BAD_MATRIX;
+    printf("[TEST] lu_decompose_tiled singular ret=%d %s\n", ret, ok ? "PASS" : "FAIL");
+    free(A);
+    return ok;
+}
+
+/* 增长因子 max|U_ij| / max|A_ij| */
+static double lu_growth(size_t n, const double *A, const double *LU, size_t lda) {
+    double amax = 0.0, umax = 0.0;
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            if (fabs(A[IDX(i,j,lda)]) > amax) amax = fabs(A[IDX(i,j,lda)]);
+            if (j >= i && fabs(LU[IDX(i,j,lda)]) > umax) umax = fabs(LU[IDX(i,j,lda)]);
+        }
+    return amax > 0.0 ? umax / amax : 0.0;
+}
+
+/* 后向误差 ||A x - b||_inf / (||A||_inf ||x||_inf + ||b||_inf) */
+static double solve_berr(size_t n, const double *A, size_t lda, const double *LU,
+                         const size_t *piv, const double *b, double *x) {
+    if (lu_solve(n, LU, lda, piv, b, x) != GAUSSIAN_SUCCESS) return INFINITY;
+    double rmax = 0.0, anorm = 0.0, xmax = 0.0, bmax = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double r = -b[i], s = 0.0;
+        for (size_t j = 0; j < n; ++j) { r += A[IDX(i,j,lda)] * x[j]; s += fabs(A[IDX(i,j,lda)]); }
+        if (fabs(r) > rmax) rmax = fabs(r);
+        if (s > anorm) anorm = s;
+        if (fabs(x[i]) > xmax) xmax = fabs(x[i]);
+        if (fabs(b[i]) > bmax) bmax = fabs(b[i]);
+    }
+    return rmax / (anorm * xmax + bmax);
+}
+
+/* CALU 的增长因子与后向误差，对照 lu_decompose_pp：
+ * kind 0 随机；1 行尺度跨 8 个数量级（大元素集中在部分叶块）；
+ * 2 Wilkinson 矩阵（部分选主元增长 2^(n-1) 的极端例子，两者均不稳定，只比较增长因子）；3 前 n/2 行为后 n/2 行的 1e-6 倍加扰动 */
+static int test_lu_calu(size_t n, size_t lda, size_t nb, int kind) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *L0 = (double*)malloc(n * lda * sizeof(double));
+    double *L1 = (double*)malloc(n * lda * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    size_t *p0 = (size_t*)malloc(n * sizeof(size_t));
+    size_t *p1 = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && L0 && L1 && b && x && p0 && p1;
+    double g0 = 0.0, g1 = 0.0, berr = INFINITY;
+    if (ok) {
+        fill_random(n, A, lda);
+        for (size_t i = 0; i < n; ++i) {
+            b[i] = rand_unit();
+            for (size_t j = 0; j < n; ++j) {
+                double *a = &A[IDX(i,j,lda)];
+                if (kind == 1) *a *= pow(10.0, (double)((i * 7) % 9) - 4.0);
+                if (kind == 2) *a = j == i || j == n - 1 ? 1.0 : (j < i ? -1.0 : 0.0);
+                if (kind == 3 && i < n / 2) *a = 1e-6 * (A[IDX(i + n / 2,j,lda)] + 1e-3 * *a);
+            }
+        }
+        memcpy(L0, A, n * lda * sizeof(double));
+        memcpy(L1, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, L0, lda, p0) == GAUSSIAN_SUCCESS
+          && lu_decompose_calu(n, L1, lda, p1, nb, 3) == GAUSSIAN_SUCCESS;
+        if (ok) {
+            g0 = lu_growth(n, A, L0, lda);
+            g1 = lu_growth(n, A, L1, lda);
+            berr = solve_berr(n, A, lda, L1, p1, b, x);
+        }
+        /* 可接受范围：不超过部分选主元的 4 倍，且不超过其理论上界 2^(n-1) */
+        ok = ok && g1 <= 4.0 * g0 && g1 <= ldexp(1.0, (int)n - 1)
+                && (kind == 2 || berr < 1e-14);
+        /* 结果与线程数无关 */
+        memcpy(L0, A, n * lda * sizeof(double));
+        ok = ok && lu_decompose_calu(n, L0, lda, p0, nb, 1) == GAUSSIAN_SUCCESS
+                && memcmp(p0, p1, n * sizeof(size_t)) == 0;
+        for (size_t i = 0; ok && i < n; ++i)
+            ok = memcmp(&L0[IDX(i,0,lda)], &L1[IDX(i,0,lda)], n * sizeof(double)) == 0;
+    }
+    printf("[TEST] lu_decompose_calu n=%zu nb=%zu kind=%d growth=%.3g (pp %.3g) berr=%.2e %s\n",
+           n, nb, kind, g1, g0, berr, ok ? "PASS" : "FAIL");
+    free(A); free(L0); free(L1); free(b); free(x); free(p0); free(p1);
+    return ok;
+}
+
+/* 奇异矩阵返回 GAUSSIAN_BAD_MATRIX；非法参数 */
+static int test_lu_calu_singular(void) {
+    const size_t n = 600;
+    double *A = (double*)malloc(n * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && piv;
+    if (ok) {
+        fill_random(n, A, n);
+        for (size_t j = 0; j < n; ++j) A[IDX(511,j,n)] = -3.0 * A[IDX(17,j,n)];
+        ok = lu_decompose_calu(n, A, n, piv, 32, 2) == GAUSSIAN_BAD_MATRIX
+          && lu_decompose_calu(n, A, n - 1, piv, 0, 1) == GAUSSIAN_INVALID_INPUT
+          && lu_decompose_calu(0, A, 0, piv, 0, 1) == GAUSSIAN_SUCCESS;
+    }
+    printf("[TEST] lu_decompose_calu singular / invalid %s\n", ok ? "PASS" : "FAIL");
+    free(A); free(piv);
+    return ok;
+}
+
+/* lu_solve 与 gauss_pp_core 结果一致，且残差小 */
+static int test_lu_solve(size_t n) {
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *LU = (double*)malloc(n * n * sizeof(double));
+    double *Aug = (double*)malloc(n * (n + 1) * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x0 = (double*)malloc(n * sizeof(double));
+    double *x1 = (double*)malloc(n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && LU && Aug && b && x0 && x1 && piv;
+    if (ok) {
+        fill_random(n, A, n);
+        for (size_t i = 0; i < n; ++i) b[i] = rand_unit();
+        for (size_t i = 0; i < n; ++i) {
+            memcpy(&Aug[AIDX(i,0,n+1)], &A[IDX(i,0,n)], n * sizeof(double));
+            Aug[AIDX(i,n,n+1)] = b[i];
+        }
+        memcpy(LU, A, n * n * sizeof(double));
+        ok = gauss_pp_core(n, Aug, n + 1, x0) == GAUSSIAN_SUCCESS
+          && lu_decompose_pp(n, LU, n, piv) == GAUSSIAN_SUCCESS
+          && lu_solve(n, LU, n, piv, b, x1) == GAUSSIAN_SUCCESS;
+        double diff = 0.0, res = 0.0;
+        for (size_t i = 0; ok && i < n; ++i) {
+            double r = -b[i];
+            for (size_t j = 0; j < n; ++j) r += A[IDX(i,j,n)] * x1[j];
+            if (fabs(r) > res) res = fabs(r);
+            if (fabs(x0[i] - x1[i]) > diff) diff = fabs(x0[i] - x1[i]);
+        }
+        if (diff > 1e-8 || res > 1e-9) ok = 0;
+        printf("[TEST] lu_solve n=%zu diff=%.3g residual=%.3g %s\n",
+               n, diff, res, ok ? "PASS" : "FAIL");
+    }
+    free(A); free(LU); free(Aug); free(b); free(x0); free(x1); free(piv);
+    return ok;
+}
+
+/* 转置求解：A^T y = c 的残差，并与显式转置后重新分解的结果比较 */
+static int test_lu_solve_transpose(size_t n, size_t lda) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *LU = (double*)malloc(n * lda * sizeof(double));
+    double *AT = (double*)malloc(n * n * sizeof(double));
+    double *c = (double*)malloc(n * sizeof(double));
+    double *y0 = (double*)malloc(n * sizeof(double));
+    double *y1 = (double*)malloc(n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    size_t *pivt = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && LU && AT && c && y0 && y1 && piv && pivt;
+    double diff = 0.0, res = 0.0;
+    if (ok) {
+        fill_random(n, A, lda);
+        for (size_t i = 0; i < n; ++i) {
+            c[i] = rand_unit();
+            for (size_t j = 0; j < n; ++j) AT[IDX(j,i,n)] = A[IDX(i,j,lda)];
+        }
+        memcpy(LU, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, LU, lda, piv) == GAUSSIAN_SUCCESS
+          && lu_solve_transpose(n, LU, lda, piv, c, y1) == GAUSSIAN_SUCCESS
+          && lu_decompose_pp(n, AT, n, pivt) == GAUSSIAN_SUCCESS
+          && lu_solve(n, AT, n, pivt, c, y0) == GAUSSIAN_SUCCESS
+          && lu_solve_transpose(n, LU, lda, piv, c, (double*)c) == GAUSSIAN_INVALID_INPUT;
+        for (size_t j = 0; ok && j < n; ++j) {
+            double r = -c[j];
+            for (size_t i = 0; i < n; ++i) r += A[IDX(i,j,lda)] * y1[i];
+            if (fabs(r) > res) res = fabs(r);
+            if (fabs(y0[j] - y1[j]) > diff) diff = fabs(y0[j] - y1[j]);
+        }
+        if (diff > 1e-8 || res > 1e-9) ok = 0;
+    }
+    printf("[TEST] lu_solve_transpose n=%zu lda=%zu diff=%.3g residual=%.3g %s\n",
+           n, lda, diff, res, ok ? "PASS" : "FAIL");
+    free(A); free(LU); free(AT); free(c); free(y0); free(y1); free(piv); free(pivt);
+    return ok;
+}
+
+/* lu_solve_multi 与逐列 lu_solve 一致 */
+static int test_lu_solve_multi(size_t n, size_t nrhs) {
+    const size_t ldb = nrhs + 3, ldx = nrhs + 1;
+    double *LU = (double*)malloc(n * n * sizeof(double));
+    double *B = (double*)malloc(n * ldb * sizeof(double));
+    double *X = (double*)malloc(n * ldx * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = LU && B && X && b && x && piv;
+    if (ok) {
+        fill_random(n, LU, n);
+        for (size_t i = 0; i < n * ldb; ++i) B[i] = rand_unit();
+        ok = lu_decompose_pp(n, LU, n, piv) == GAUSSIAN_SUCCESS
+          && lu_solve_multi(n, LU, n, piv, nrhs, B, ldb, X, ldx) == GAUSSIAN_SUCCESS;
+        double diff = 0.0;
+        for (size_t c = 0; ok && c < nrhs; ++c) {
+            for (size_t i = 0; i < n; ++i) b[i] = B[IDX(i,c,ldb)];
+            ok = lu_solve(n, LU, n, piv, b, x) == GAUSSIAN_SUCCESS;
+            for (size_t i = 0; i < n; ++i) {
+                double d = fabs(x[i] - X[IDX(i,c,ldx)]) / (1.0 + fabs(x[i]));
+                if (d > diff) diff = d;
+            }
+        }
+        if (diff > 1e-10) ok = 0;
+        printf("[TEST] lu_solve_multi n=%zu nrhs=%zu diff=%.3g %s\n",
+               n, nrhs, diff, ok ? "PASS" : "FAIL");
+    }
+    free(LU); free(B); free(X); free(b); free(x); free(piv);
+    return ok;
+}
+
+/* 向量核与标量核逐元素误差不超过 GAUSSIAN_SIMD_ULP_BOUND ulp */
+static int test_simd_kernel_ulp(GaussianSimdLevel want) {
+    enum { LEN = 1003 };
+    static double x[LEN], y0[LEN], y_ref[LEN], y_vec[LEN], y4[4][LEN];
+    GaussianSimdLevel level = gaussian_simd_detect();
+    if (want > level) {
+        printf("[TEST] simd kernel level=%d not supported, SKIP\n", (int)want);
+        return 1;
+    }
+    for (size_t j = 0; j < LEN; ++j) { x[j] = rand_unit(); y0[j] = rand_unit(); }
+    const double a = 0.7390851332151607;
+    const double a4[4] = { a, -1.5, 3.25e-3, 0.0 };
+
+    int ok = 1;
+    for (size_t len = 0; ok && len <= LEN; len += (len < 40 ? 1 : 97)) {
+        gaussian_simd_set_level(GAUSSIAN_SIMD_SCALAR);
+        memcpy(y_ref, y0, sizeof y0);
+        gaussian_kernels()->axpy(len, a, x, y_ref);
+        gaussian_simd_set_level(want);
+        memcpy(y_vec, y0, sizeof y0);
+        gaussian_kernels()->axpy(len, a, x, y_vec);
+        for (int r = 0; r < 4; ++r) memcpy(y4[r], y0, sizeof y0);
+        gaussian_kernels()->axpy4(len, a4, x, y4[0], y4[1], y4[2], y4[3]);
+
+        for (size_t j = 0; j < LEN; ++j) {
+            double scale = fmax(fabs(y0[j]), fabs(a * x[j]));
+            double ulp = nextafter(scale, INFINITY) - scale;
+            if (fabs(y_vec[j] - y_ref[j]) > GAUSSIAN_SIMD_ULP_BOUND * ulp) ok = 0;
+            if (j >= len && y_vec[j] != y0[j]) ok = 0;     /* 不越界写 */
+            if (y4[0][j] != y_vec[j]) ok = 0;              /* axpy4 与 axpy 逐位一致 */
+            if (y4[3][j] != y0[j]) ok = 0;                 /* a = 0 不改变 y */
+        }
+    }
+    printf("[TEST] simd kernel %s vs scalar (<= %d ulp) %s\n",
+           gaussian_kernels()->name, GAUSSIAN_SIMD_ULP_BOUND, ok ? "PASS" : "FAIL");
+    gaussian_simd_set_level(level);
+    return ok;
+}
+
+/* 标量路径与向量路径求解结果一致（相对误差 ~ n * cond * eps） */
+static int test_simd_solvers(size_t n) {
+    const size_t lda = n + 1;
+    double *A0 = (double*)malloc(n * lda * sizeof(double));
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *xs = (double*)malloc(3 * n * sizeof(double));
+    double *xv = (double*)malloc(3 * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    GaussianSimdLevel level = gaussian_simd_detect();
+    int ok = A0 && A && xs && xv && piv;
+    for (size_t i = 0; ok && i < n; ++i)
+        for (size_t j = 0; j <= n; ++j) A0[AIDX(i,j,lda)] = rand_unit();
+
+    for (int pass = 0; ok && pass < 2; ++pass) {
+        double *x = pass == 0 ? xs : xv;
+        gaussian_simd_set_level(pass == 0 ? GAUSSIAN_SIMD_SCALAR : level);
+        memcpy(A, A0, n * lda * sizeof(double));
+        ok = gauss_pp_core(n, A, lda, x) == GAUSSIAN_SUCCESS;
+        memcpy(A, A0, n * lda * sizeof(double));
+        ok = ok && gauss_jordan_solve(n, A, lda, x + n) == GAUSSIAN_SUCCESS;
+        memcpy(A, A0, n * lda * sizeof(double));
+        double *b = (double*)malloc(n * sizeof(double));
+        for (size_t i = 0; b && i < n; ++i) b[i] = A0[AIDX(i,n,lda)];
+        ok = ok && b && lu_decompose_blocked(n, A, lda, piv) == GAUSSIAN_SUCCESS
+                && lu_solve(n, A, lda, piv, b, x + 2 * n) == GAUSSIAN_SUCCESS;
+        free(b);
+    }
+    gaussian_simd_set_level(level);
+
+    double diff = 0.0;
+    for (size_t i = 0; ok && i < 3 * n; ++i) {
+        double d = fabs(xs[i] - xv[i]) / (1.0 + fabs(xs[i]));
+        if (d > diff) diff = d;
+    }
+    if (diff > 1e-9) ok = 0;
+    printf("[TEST] simd solvers n=%zu level=%d diff=%.3g %s\n", n, (int)level, diff, ok ? "PASS" : "FAIL");
+    free(A0); free(A); free(xs); free(xv); free(piv);
+    return ok;
+}
+
+/* GAUSSIAN_SIMD_ULP_BOUND 只约束单次 axpy；端到端只能用随 n 增长的后向误差界衡量：
+ * 各级别的 lu_decompose_pp / blocked + lu_solve 满足 berr <= 3 n eps * max(增长因子, 1)，
+ * 向量路径与标量路径的解之差不超过 2 * 该界 / rcond */
+static int test_simd_backward_error(size_t n, GaussianSimdLevel want) {
+    GaussianSimdLevel level = gaussian_simd_detect();
+    if (want > level) {
+        printf("[TEST] simd backward error level=%d not supported, SKIP\n", (int)want);
+        return 1;
+    }
+    const size_t lda = n + 2;
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *LU = (double*)malloc(n * lda * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(4 * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && LU && b && x && piv;
+    if (ok) {
+        fill_random(n, A, lda);
+        for (size_t i = 0; i < n; ++i) b[i] = rand_unit();
+    }
+    const double anorm = ok ? mat_norm1(n, A, lda) : 0.0;
+    double rcond = 0.0, berr_max = 0.0, bound = 0.0;
+    /* x: [标量 pp, 标量 blocked, 向量 pp, 向量 blocked] */
+    for (int pass = 0; ok && pass < 4; ++pass) {
+        gaussian_simd_set_level(pass < 2 ? GAUSSIAN_SIMD_SCALAR : want);
+        memcpy(LU, A, n * lda * sizeof(double));
+        ok = ((pass % 2 == 0) ? lu_decompose_pp(n, LU, lda, piv)
+                              : lu_decompose_blocked(n, LU, lda, piv)) == GAUSSIAN_SUCCESS;
+        if (!ok) break;
+        if (pass == 0) ok = lu_condest(n, LU, lda, piv, anorm, &rcond) == GAUSSIAN_SUCCESS && rcond > 0.0;
+        const double g = lu_growth(n, A, LU, lda);
+        const double bnd = 3.0 * (double)n * DBL_EPSILON * (g > 1.0 ? g : 1.0);
+        const double berr = solve_berr(n, A, lda, LU, piv, b, x + pass * n);
+        if (berr > bnd) ok = 0;
+        if (berr > berr_max) berr_max = berr;
+        if (bnd > bound) bound = bnd;
+    }
+    gaussian_simd_set_level(level);
+
+    double diff = 0.0, xmax = 0.0;
+    for (size_t i = 0; ok && i < n; ++i) {
+        for (int pass = 2; pass < 4; ++pass) {
+            double d = fabs(x[pass * n + i] - x[(pass - 2) * n + i]);
+            if (d > diff) diff = d;
+        }
+        if (fabs(x[i]) > xmax) xmax = fabs(x[i]);
+    }
+    if (ok && diff > 2.0 * bound / rcond * xmax) ok = 0;
+    printf("[TEST] simd %s vs scalar LU n=%zu berr=%.3g (<= %.3g) |dx|/|x|=%.3g %s\n",
+           want == GAUSSIAN_SIMD_AVX512 ? "avx512" : "avx2", n, berr_max, bound,
+           xmax > 0.0 ? diff / xmax : 0.0, ok ? "PASS" : "FAIL");
+    free(A); free(LU); free(b); free(x); free(piv);
+    return ok;
+}
+
+/* 小规模特化与 gauss_pp_core 一致；A 不被修改；奇异矩阵被识别 */
+typedef GAUSSIAN_Err (*GaussSmallFn)(const double *A, size_t lda, double *x);
+
+static int test_small_specialized(size_t n) {
+    static const GaussSmallFn solve_n[9] = {
+        NULL, NULL, gauss_pp_solve_2, gauss_pp_solve_3, gauss_pp_solve_4,
+        gauss_pp_solve_5, gauss_pp_solve_6, gauss_pp_solve_7, gauss_pp_solve_8
+    };
+    double A[8 * 9], A0[8 * 9], W[8 * 9], x0[8], x1[8];
+    const size_t lda = 9;
+    int ok = 1;
+    double diff = 0.0;
+    for (int rep = 0; ok && rep < 50; ++rep) {
+        for (size_t i = 0; i < n * lda; ++i) A[i] = rand_unit();
+        memcpy(A0, A, sizeof A);
+        memcpy(W, A, sizeof A);
+        ok = gauss_pp_core(n, W, lda, x0) == GAUSSIAN_SUCCESS
+          && solve_n[n](A, lda, x1) == GAUSSIAN_SUCCESS
+          && memcmp(A, A0, n * lda * sizeof(double)) == 0;
+        for (size_t i = 0; ok && i < n; ++i) {
+            double d = fabs(x0[i] - x1[i]) / (1.0 + fabs(x0[i]));
+            if (d > diff) diff = d;
+        }
+    }
+    if (diff > 1e-9) ok = 0;
+
+    /* 第 0 行与最后一行成比例 -> 奇异 */
+    for (size_t j = 0; j <= n; ++j) A[AIDX(n-1, j, lda)] = -3.0 * A[AIDX(0, j, lda)];
+    if (solve_n[n](A, lda, x1) != GAUSSIAN_BAD_MATRIX) ok = 0;
+
+    printf("[TEST] gauss_pp_solve_%zu vs gauss_pp_core diff=%.3g %s\n", n, diff, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+/* 构造对称正定矩阵 A = M M^T + n I（完整存放） */
+static void fill_spd(size_t n, double *A, size_t lda) {
+    double *M = (double*)malloc(n * n * sizeof(double));
+    if (!M) return;
+    fill_random(n, M, n);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j <= i; ++j) {
+            double sum = (i == j) ? (double)n : 0.0;
+            for (size_t k = 0; k < n; ++k) sum += M[IDX(i,k,n)] * M[IDX(j,k,n)];
+            A[IDX(i,j,lda)] = A[IDX(j,i,lda)] = sum;
+        }
+    free(M);
+}
+
+/* Cholesky：上三角填 NaN 验证只读下三角；检查 L L^T = A 与求解残差 */
+static int test_cholesky(size_t n, size_t lda, size_t nthreads) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *L = (double*)malloc(n * lda * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    int ok = A && L && b && x;
+    double err = 0.0, res = 0.0;
+    if (ok) {
+        fill_spd(n, A, lda);
+        memcpy(L, A, n * lda * sizeof(double));
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = i + 1; j < n; ++j) L[IDX(i,j,lda)] = NAN;
+        for (size_t i = 0; i < n; ++i) b[i] = rand_unit();
+        ok = cholesky_decompose(n, L, lda, nthreads) == GAUSSIAN_SUCCESS
+          && cholesky_solve(n, L, lda, b, x) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                double sum = 0.0;
+                for (size_t k = 0; k <= j; ++k) sum += L[IDX(i,k,lda)] * L[IDX(j,k,lda)];
+                double d = fabs(sum - A[IDX(i,j,lda)]) / (double)n;
+                if (d > err) err = d;
+            }
+            for (size_t j = i + 1; j < n; ++j)
+                if (!isnan(L[IDX(i,j,lda)])) ok = 0;     /* 上三角未被写 */
+            double r = -b[i];
+            for (size_t j = 0; j < n; ++j) r += A[IDX(i,j,lda)] * x[j];
+            if (fabs(r) > res) res = fabs(r);
+        }
+        if (err > 1e-12 || res > 1e-10) ok = 0;
+    }
+    printf("[TEST] cholesky n=%zu threads=%zu err=%.3g residual=%.3g %s\n",
+           n, nthreads, err, res, ok ? "PASS" : "FAIL");
+    free(A); free(L); free(b); free(x);
+    return ok;
+}
+
+static int test_cholesky_not_spd(void) {
+    const size_t n = 100;
+    double *A = (double*)malloc(n * n * sizeof(double));
+    if (!A) return 0;
+    fill_spd(n, A, n);
+    A[IDX(80,80,n)] = -1.0;            /* 破坏正定性 */
+    GAUSSIAN_Err ret = cholesky_decompose(n, A, n, 2);
+    int ok = ret == GAUSSIAN_NOT_SPD;
+    printf("[TEST] cholesky not SPD ret=%d %s\n", ret, ok ? "PASS" : "FAIL");
+    free(A);
+    return ok;
+}
+
+/* 行列式：已知 3x3（含行交换）与置换矩阵的符号；piv 非置换被拒绝 */
+static int test_lu_det(void) {
+    double C[9] = { 0, 2, 1,  1, 1, 1,  2, 1, 3 };       /* det = -3，首列主元需交换 */
+    double P[16] = { 0, 1, 0, 0,  0, 0, 0, 1,  1, 0, 0, 0,  0, 0, 1, 0 };  /* 4-轮换，det = -1 */
+    size_t piv[4], bad[3] = { 0, 0, 2 };
+    double d1 = 0.0, d2 = 0.0, la = 0.0;
+    int sg = 0;
+    int ok = lu_decompose_pp(3, C, 3, piv) == GAUSSIAN_SUCCESS
+          && lu_det(3, C, 3, piv, &d1) == GAUSSIAN_SUCCESS
+          && lu_logdet(3, C, 3, piv, &la, &sg) == GAUSSIAN_SUCCESS
+          && fabs(d1 + 3.0) < 1e-13 && sg == -1 && fabs(la - log(3.0)) < 1e-13
+          && lu_det(3, C, 3, bad, &d1) == GAUSSIAN_INVALID_INPUT
+          && lu_decompose_pp(4, P, 4, piv) == GAUSSIAN_SUCCESS
+          && lu_det(4, P, 4, piv, &d2) == GAUSSIAN_SUCCESS && d2 == -1.0;
+    printf("[TEST] lu_det / lu_logdet det=%g, %g %s\n", d1, d2, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+/* 对角元 ~1e10 的 n=200 矩阵：det 溢出为 inf，logdet 与 sum log|a_ii| 一致 */
+static int test_lu_logdet_overflow(void) {
+    const size_t n = 200;
+    double *A = (double*)malloc(n * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && piv;
+    double det = 0.0, la = 0.0, ref = 0.0;
+    int sg = 0, sref = 1;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j) {
+                A[IDX(i,j,n)] = j < i ? 0.0 : rand_unit();    /* 上三角，行逆序放置 */
+                if (i == j) A[IDX(i,j,n)] = (i % 3 ? 1e10 : -2e10) * (1.0 + 0.1 * rand_unit());
+            }
+        for (size_t i = 0; i < n; ++i) {
+            ref += log(fabs(A[IDX(i,i,n)]));
+            if (A[IDX(i,i,n)] < 0) sref = -sref;
+        }
+        for (size_t i = 0; i < n / 2; ++i)                    /* n/2 = 100 次对换：符号不变 */
+            for (size_t j = 0; j < n; ++j) {
+                double t = A[IDX(i,j,n)];
+                A[IDX(i,j,n)] = A[IDX(n-1-i,j,n)];
+                A[IDX(n-1-i,j,n)] = t;
+            }
+        ok = lu_decompose_pp(n, A, n, piv) == GAUSSIAN_SUCCESS
+          && lu_det(n, A, n, piv, &det) == GAUSSIAN_SUCCESS
+          && lu_logdet(n, A, n, piv, &la, &sg) == GAUSSIAN_SUCCESS
+          && isinf(det) && sg == sref && fabs(la - ref) <= 1e-12 * fabs(ref);
+    }
+    printf("[TEST] lu_logdet n=%zu log|det|=%.6f sign=%d (det=%g) %s\n", n, la, sg, det, ok ? "PASS" : "FAIL");
+    free(A); free(piv);
+    return ok;
+}
+
+/* 就地求逆：||A X - I||_max 与 n * cond 同阶；奇异 U 被拒绝 */
+static int test_lu_inverse(size_t n, size_t lda) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *X = (double*)malloc(n * lda * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && X && piv;
+    double err = 0.0;
+    if (ok) {
+        fill_random(n, A, lda);
+        for (size_t i = 0; i < n; ++i) A[IDX(i,i,lda)] += 2.0;
+        memcpy(X, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, X, lda, piv) == GAUSSIAN_SUCCESS
+          && lu_inverse(n, X, lda, piv) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i)
+            for (size_t j = 0; j < n; ++j) {
+                double s = (i == j) ? -1.0 : 0.0;
+                for (size_t k = 0; k < n; ++k) s += A[IDX(i,k,lda)] * X[IDX(k,j,lda)];
+                if (fabs(s) > err) err = fabs(s);
+            }
+        ok = ok && err < 1e-10;
+        X[IDX(n-1,n-1,lda)] = 0.0;
+        ok = ok && lu_inverse(n, X, lda, piv) == GAUSSIAN_BAD_MATRIX;
+    }
+    printf("[TEST] lu_inverse n=%zu lda=%zu ||AX-I||=%.3g %s\n", n, lda, err, ok ? "PASS" : "FAIL");
+    free(A); free(X); free(piv);
+    return ok;
+}
+
+/* 条件数估计：与由 lu_inverse 求得的精确 ||A^{-1}||_1 比较（估计为下界，且在 3 倍以内） */
+static int test_lu_condest(size_t n, double delta) {
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *LU = (double*)malloc(n * n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && LU && piv;
+    double rc = 0.0, rc_exact = 0.0;
+    if (ok) {
+        fill_random(n, A, n);
+        if (delta > 0.0 && n > 2)          /* 末行接近前两行的平均：cond ~ 1/delta */
+            for (size_t j = 0; j < n; ++j)
+                A[IDX(n-1,j,n)] = 0.5 * (A[IDX(0,j,n)] + A[IDX(1,j,n)]) + delta * rand_unit();
+        memcpy(LU, A, n * n * sizeof(double));
+        double rc_null_check = -1.0;
+        ok = lu_decompose_pp_rcond(n, LU, n, piv, &rc) == GAUSSIAN_SUCCESS
+          && lu_condest(n, LU, n, piv, mat_norm1(n, A, n), &rc_null_check) == GAUSSIAN_SUCCESS
+          && rc_null_check == rc
+          && lu_inverse(n, LU, n, piv) == GAUSSIAN_SUCCESS;
+        if (ok) rc_exact = 1.0 / (mat_norm1(n, A, n) * mat_norm1(n, LU, n));
+        ok = ok && rc >= rc_exact * (1.0 - 1e-10) && rc <= 3.0 * rc_exact;
+    }
+    printf("[TEST] lu_condest n=%zu delta=%g rcond=%.3e exact=%.3e %s\n",
+           n, delta, rc, rc_exact, ok ? "PASS" : "FAIL");
+    free(A); free(LU); free(piv);
+    return ok;
+}
+
+/* 已知条件数：单位阵 rcond = 1，对角阵 rcond = min/max；奇异时 rcond = 0；NULL 输出等同 lu_decompose_pp */
+static int test_lu_condest_known(void) {
+    double I3[9] = { 1, 0, 0,  0, 1, 0,  0, 0, 1 };
+    double D[9] = { 4, 0, 0,  0, 1e-6, 0,  0, 0, -2 };
+    double S[4] = { 1, 2, 2, 4 };
+    double C[16], C2[16];
+    size_t piv[4], piv2[4];
+    double r1 = -1, r2 = -1, r3 = -1;
+    for (size_t i = 0; i < 16; ++i) C[i] = C2[i] = rand_unit();
+    int ok = lu_decompose_pp_rcond(3, I3, 3, piv, &r1) == GAUSSIAN_SUCCESS && r1 == 1.0
+          && lu_decompose_pp_rcond(3, D, 3, piv, &r2) == GAUSSIAN_SUCCESS
+          && fabs(r2 - 2.5e-7) < 1e-18
+          && lu_decompose_pp_rcond(2, S, 2, piv, &r3) == GAUSSIAN_BAD_MATRIX && r3 == 0.0
+          && lu_decompose_pp_rcond(4, C, 4, piv, NULL) == GAUSSIAN_SUCCESS
+          && lu_decompose_pp(4, C2, 4, piv2) == GAUSSIAN_SUCCESS
+          && memcmp(C, C2, sizeof C) == 0 && memcmp(piv, piv2, sizeof piv) == 0;
+    printf("[TEST] lu_condest identity/diagonal/singular rcond=%g, %g, %g %s\n",
+           r1, r2, r3, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
 int main(void) {
     /* 与我们之前的 5x6 案例一致（5 个未知数 + 常数列） */
     double A[5][6] = {
@@ -127,5 +814,56 @@ int main(void) {
         /* 此处略去验证代码，专注于分解与显示 */
     }
 
-    return 0;
+    int passed = 0, total = 0;
+    total++; passed += test_lu_blocked(1, 1);
+    total++; passed += test_lu_blocked(63, 63);
+    total++; passed += test_lu_blocked(200, 203);
+    total++; passed += test_lu_blocked(300, 300);
+    total++; passed += test_lu_recursive(1, 1);
+    total++; passed += test_lu_recursive(17, 19);
+    total++; passed += test_lu_recursive(301, 305);
+    total++; passed += test_lu_tiled(1, 1, 0, 2);
+    total++; passed += test_lu_tiled(100, 100, 16, 1);
+    total++; passed += test_lu_tiled(250, 257, 32, 4);
+    total++; passed += test_lu_tiled(129, 129, 64, 3);
+    total++; passed += test_lu_tiled_singular();
+    total++; passed += test_lu_calu(1, 1, 0, 0);
+    total++; passed += test_lu_calu(300, 303, 0, 0);
+    total++; passed += test_lu_calu(1100, 1100, 48, 0);
+    total++; passed += test_lu_calu(1100, 1100, 32, 1);
+    total++; passed += test_lu_calu(600, 600, 16, 2);
+    total++; passed += test_lu_calu(1030, 1030, 64, 3);
+    total++; passed += test_lu_calu_singular();
+    total++; passed += test_lu_solve(1);
+    total++; passed += test_lu_solve(120);
+    total++; passed += test_lu_solve_transpose(1, 1);
+    total++; passed += test_lu_solve_transpose(130, 133);
+    total++; passed += test_lu_solve_multi(150, 7);
+    total++; passed += test_lu_solve_multi(64, 1);
+    total++; passed += test_simd_kernel_ulp(GAUSSIAN_SIMD_AVX2);
+    total++; passed += test_simd_kernel_ulp(GAUSSIAN_SIMD_AVX512);
+    total++; passed += test_simd_solvers(97);
+    total++; passed += test_simd_backward_error(64, GAUSSIAN_SIMD_AVX2);
+    total++; passed += test_simd_backward_error(400, GAUSSIAN_SIMD_AVX2);
+    total++; passed += test_simd_backward_error(400, GAUSSIAN_SIMD_AVX512);
+    for (size_t n = 2; n <= 8; ++n) {
+        total++; passed += test_small_specialized(n);
+    }
+    total++; passed += test_cholesky(1, 1, 1);
+    total++; passed += test_cholesky(50, 50, 1);
+    total++; passed += test_cholesky(211, 215, 3);
+    total++; passed += test_cholesky_not_spd();
+    total++; passed += test_lu_det();
+    total++; passed += test_lu_logdet_overflow();
+    total++; passed += test_lu_inverse(1, 1);
+    total++; passed += test_lu_inverse(7, 9);
+    total++; passed += test_lu_inverse(200, 203);
+    total++; passed += test_lu_inverse(300, 300);
+    total++; passed += test_lu_condest(1, 0.0);
+    total++; passed += test_lu_condest(150, 0.0);
+    total++; passed += test_lu_condest(150, 1e-8);
+    total++; passed += test_lu_condest_known();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_band.h"
+#include "gaussian_batch.h"
+#define TEST_SEED 4242ULL
+#include "test_gaussian_common.h"
+
+static double max_rel_diff(size_t n, const double *x, const double *ref) {
+    double diff = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double d = fabs(x[i] - ref[i]) / (1.0 + fabs(ref[i]));
+        if (d > diff) diff = d;
+    }
+    return diff;
+}
+
+/* 带状 LU 与稠密 gauss_pp_core 对照；对角取小值以迫使行交换 */
+static int test_band_lu(size_t n, size_t kl, size_t ku, size_t ldab) {
+    const size_t lda = n + 1;
+    double *A = (double*)calloc(n * lda, sizeof(double));
+    double *AB = (double*)malloc(n * ldab * sizeof(double));
+    size_t *ipiv = (size_t*)malloc(n * sizeof(size_t));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    double *xr = (double*)malloc(n * sizeof(double));
+    int ok = A && AB && ipiv && b && x && xr;
+    double diff = 0.0;
+    size_t swaps = 0;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = (i > kl ? i - kl : 0); j <= i + ku && j < n; ++j)
+                A[IDX(i,j,lda)] = rand_unit() + (i == j ? 0.1 : 0.0);
+            b[i] = A[IDX(i,n,lda)] = rand_unit();
+        }
+        ok = band_pack(n, kl, ku, A, lda, AB, ldab) == GAUSSIAN_SUCCESS
+          && band_lu_decompose(n, kl, ku, AB, ldab, ipiv) == GAUSSIAN_SUCCESS
+          && band_lu_solve(n, kl, ku, AB, ldab, ipiv, b, x) == GAUSSIAN_SUCCESS
+          && gauss_pp_core(n, A, lda, xr) == GAUSSIAN_SUCCESS;
+        for (size_t k = 0; ok && k < n; ++k) swaps += ipiv[k] != k;
+        /* x 与 b 同址 */
+        if (ok) ok = band_lu_solve(n, kl, ku, AB, ldab, ipiv, b, b) == GAUSSIAN_SUCCESS
+                  && memcmp(b, x, n * sizeof(double)) == 0;
+        if (ok) diff = max_rel_diff(n, x, xr);
+        if (diff > 1e-9) ok = 0;
+    }
+    printf("[TEST] band_lu n=%zu kl=%zu ku=%zu ldab=%zu swaps=%zu diff=%.3g %s\n",
+           n, kl, ku, ldab, swaps, diff, ok ? "PASS" : "FAIL");
+    free(A); free(AB); free(ipiv); free(b); free(x); free(xr);
+    return ok;
+}
+
+static int test_band_singular(void) {
+    const size_t n = 6, kl = 1, ku = 1, ldab = BAND_LDAB_LU(1, 1);
+    double AB[6 * 4];
+    size_t ipiv[6];
+    for (size_t i = 0; i < n; ++i) {
+        AB[BAND_IDX(i, i, ldab, kl)] = 2.0;
+        if (i > 0) AB[BAND_IDX(i, i - 1, ldab, kl)] = (i == 3) ? 0.0 : -1.0;
+        if (i + 1 < n) AB[BAND_IDX(i, i + 1, ldab, kl)] = (i == 3) ? 0.0 : -1.0;
+    }
+    AB[BAND_IDX(3, 3, ldab, kl)] = 0.0;    /* 第 3 行全零 */
+    int ok = band_lu_decompose(n, kl, ku, AB, ldab, ipiv) == GAUSSIAN_BAD_MATRIX
+          && band_lu_decompose(n, kl, ku, AB, kl + ku + 1, ipiv) == GAUSSIAN_INVALID_INPUT;
+    printf("[TEST] band_lu singular / invalid ldab %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+/* Thomas 与带状 LU（kl = ku = 1）对照 */
+static int test_tridiag(size_t n) {
+    const size_t ldab = BAND_LDAB_LU(1, 1);
+    double *dl = (double*)malloc(n * sizeof(double));
+    double *d = (double*)malloc(n * sizeof(double));
+    double *du = (double*)malloc(n * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    double *xr = (double*)malloc(n * sizeof(double));
+    double *AB = (double*)malloc(n * ldab * sizeof(double));
+    size_t *ipiv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = dl && d && du && b && x && xr && AB && ipiv;
+    double diff = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) {
+            dl[i] = rand_unit(); du[i] = rand_unit();
+            d[i] = 3.0 + rand_unit();          /* 对角占优 */
+            b[i] = rand_unit();
+            AB[BAND_IDX(i, i, ldab, 1)] = d[i];
+            if (i > 0) AB[BAND_IDX(i, i - 1, ldab, 1)] = dl[i];
+            if (i + 1 < n) AB[BAND_IDX(i, i + 1, ldab, 1)] = du[i];
+        }
+        ok = tridiag_solve(n, dl, d, du, b, x) == GAUSSIAN_SUCCESS
+          && band_lu_decompose(n, 1, 1, AB, ldab, ipiv) == GAUSSIAN_SUCCESS
+          && band_lu_solve(n, 1, 1, AB, ldab, ipiv, b, xr) == GAUSSIAN_SUCCESS;
+        if (ok) diff = max_rel_diff(n, x, xr);
+        if (diff > 1e-12) ok = 0;
+    }
+    printf("[TEST] tridiag_solve n=%zu diff=%.3g %s\n", n, diff, ok ? "PASS" : "FAIL");
+    free(dl); free(d); free(du); free(b); free(x); free(xr); free(AB); free(ipiv);
+    return ok;
+}
+
+/* 批量三对角与逐个 tridiag_solve 一致；系统 5 的主对角置零 */
+static int test_tridiag_batch(size_t n, size_t count, size_t nthreads) {
+    const size_t len = gauss_batch_size_x(n, count);
+    double *dl = (double*)calloc(len, sizeof(double));
+    double *d = (double*)calloc(len, sizeof(double));
+    double *du = (double*)calloc(len, sizeof(double));
+    double *b = (double*)calloc(len, sizeof(double));
+    double *x = (double*)calloc(len, sizeof(double));
+    double *sl = (double*)malloc(4 * n * sizeof(double));
+    GAUSSIAN_Err *info = (GAUSSIAN_Err*)malloc(count * sizeof(GAUSSIAN_Err));
+    int ok = dl && d && du && b && x && sl && info;
+    double diff = 0.0;
+    if (ok) {
+        for (size_t s = 0; s < count; ++s)
+            for (size_t i = 0; i < n; ++i) {
+                size_t k = GAUSS_BATCH_XIDX(n, s, i);
+                dl[k] = rand_unit(); du[k] = rand_unit(); b[k] = rand_unit();
+                d[k] = (s == 5) ? 0.0 : 3.0 + rand_unit();
+            }
+        ok = tridiag_batch_solve(n, count, dl, d, du, b, x, info, nthreads) == GAUSSIAN_BAD_MATRIX;
+        for (size_t s = 0; ok && s < count; ++s) {
+            double *sdl = sl, *sd = sl + n, *sdu = sl + 2 * n, *sb = sl + 3 * n, xs[64];
+            for (size_t i = 0; i < n; ++i) {
+                size_t k = GAUSS_BATCH_XIDX(n, s, i);
+                sdl[i] = dl[k]; sd[i] = d[k]; sdu[i] = du[k]; sb[i] = b[k];
+            }
+            GAUSSIAN_Err ret = tridiag_solve(n, sdl, sd, sdu, sb, xs);
+            if (ret != info[s]) { ok = 0; break; }
+            if (ret != GAUSSIAN_SUCCESS) continue;
+            for (size_t i = 0; i < n; ++i) {
+                double dd = fabs(xs[i] - x[GAUSS_BATCH_XIDX(n, s, i)]) / (1.0 + fabs(xs[i]));
+                if (dd > diff) diff = dd;
+            }
+        }
+        if (diff > 1e-12) ok = 0;
+    }
+    printf("[TEST] tridiag_batch_solve n=%zu count=%zu threads=%zu diff=%.3g %s\n",
+           n, count, nthreads, diff, ok ? "PASS" : "FAIL");
+    free(dl); free(d); free(du); free(b); free(x); free(sl); free(info);
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_band_lu(1, 0, 0, 1);
+    total++; passed += test_band_lu(50, 1, 1, BAND_LDAB_LU(1, 1));
+    total++; passed += test_band_lu(200, 2, 3, BAND_LDAB_LU(2, 3));
+    total++; passed += test_band_lu(300, 7, 4, BAND_LDAB_LU(7, 4) + 5);
+    total++; passed += test_band_lu(64, 63, 63, BAND_LDAB_LU(63, 63));
+    total++; passed += test_band_singular();
+    total++; passed += test_tridiag(1);
+    total++; passed += test_tridiag(1000);
+    total++; passed += test_tridiag_batch(40, 29, 1);
+    total++; passed += test_tridiag_batch(64, 100, 3);
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
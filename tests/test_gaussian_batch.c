@@ -0,0 +1,96 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_batch.h"
+#define TEST_SEED 2024ULL
+#include "test_gaussian_common.h"
+
+/* 批量求解与逐个 gauss_pp_core 的结果一致 */
+static int test_batch_vs_core(size_t n, size_t count, size_t nthreads) {
+    const size_t lda = n + 1;
+    double *A = (double*)malloc(count * n * lda * sizeof(double));
+    double *Ab = (double*)malloc(gauss_batch_size_A(n, count) * sizeof(double));
+    double *xb = (double*)malloc(gauss_batch_size_x(n, count) * sizeof(double));
+    double *x = (double*)malloc(count * n * sizeof(double));
+    double *work = (double*)malloc(n * lda * sizeof(double));
+    double *xr = (double*)malloc(n * sizeof(double));
+    GAUSSIAN_Err *info = (GAUSSIAN_Err*)malloc(count * sizeof(GAUSSIAN_Err));
+    int ok = A && Ab && xb && x && work && xr && info;
+    double diff = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < count * n * lda; ++i) A[i] = rand_unit();
+        ok = gauss_batch_pack(n, count, A, lda, Ab) == GAUSSIAN_SUCCESS
+          && gauss_batch_solve(n, count, Ab, xb, info, nthreads) == GAUSSIAN_SUCCESS
+          && gauss_batch_unpack_x(n, count, xb, x) == GAUSSIAN_SUCCESS;
+        for (size_t s = 0; ok && s < count; ++s) {
+            memcpy(work, A + s * n * lda, n * lda * sizeof(double));
+            if (info[s] != GAUSSIAN_SUCCESS || gauss_pp_core(n, work, lda, xr) != GAUSSIAN_SUCCESS) {
+                ok = 0;
+                break;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                double d = fabs(xr[i] - x[s * n + i]) / (1.0 + fabs(xr[i]));
+                if (d > diff) diff = d;
+            }
+        }
+        if (diff > 1e-9) ok = 0;
+    }
+    printf("[TEST] gauss_batch_solve n=%zu count=%zu threads=%zu diff=%.3g %s\n",
+           n, count, nthreads, diff, ok ? "PASS" : "FAIL");
+    free(A); free(Ab); free(xb); free(x); free(work); free(xr); free(info);
+    return ok;
+}
+
+/* 奇异系统只影响自身 lane */
+static int test_batch_singular(void) {
+    const size_t n = 4, count = 11, lda = n + 1;
+    double A[11 * 4 * 5];
+    double Ab[2 * 4 * 5 * GAUSSIAN_BATCH_LANES];
+    double xb[2 * 4 * GAUSSIAN_BATCH_LANES];
+    GAUSSIAN_Err info[11];
+    for (size_t s = 0; s < count; ++s)
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j <= n; ++j)
+                A[s * n * lda + i * lda + j] = (i == j) ? 2.0 : (j == n ? (double)i : 0.0);
+    /* 系统 3、9 的第 2 行清零 */
+    for (size_t j = 0; j <= n; ++j) {
+        A[3 * n * lda + 2 * lda + j] = 0.0;
+        A[9 * n * lda + 2 * lda + j] = 0.0;
+    }
+    int ok = gauss_batch_pack(n, count, A, lda, Ab) == GAUSSIAN_SUCCESS
+          && gauss_batch_solve(n, count, Ab, xb, info, 1) == GAUSSIAN_BAD_MATRIX;
+    for (size_t s = 0; ok && s < count; ++s) {
+        GAUSSIAN_Err expect = (s == 3 || s == 9) ? GAUSSIAN_BAD_MATRIX : GAUSSIAN_SUCCESS;
+        if (info[s] != expect) ok = 0;
+        if (expect == GAUSSIAN_SUCCESS)
+            for (size_t i = 0; i < n; ++i)
+                if (fabs(xb[GAUSS_BATCH_XIDX(n, s, i)] - (double)i / 2.0) > 1e-15) ok = 0;
+    }
+    printf("[TEST] gauss_batch_solve singular lanes %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+static int test_batch_invalid(void) {
+    double dummy[1];
+    int ok = gauss_batch_solve(GAUSSIAN_BATCH_MAX_N + 1, 1, dummy, dummy, NULL, 1) == GAUSSIAN_INVALID_INPUT
+          && gauss_batch_solve(0, 1, dummy, dummy, NULL, 1) == GAUSSIAN_INVALID_INPUT;
+    printf("[TEST] gauss_batch_solve invalid input %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    for (size_t n = 1; n <= GAUSSIAN_BATCH_MAX_N; n += 3) {
+        total++; passed += test_batch_vs_core(n, 37, 1);
+    }
+    total++; passed += test_batch_vs_core(16, 100, 3);
+    total++; passed += test_batch_vs_core(3, 8, 0);
+    total++; passed += test_batch_singular();
+    total++; passed += test_batch_invalid();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
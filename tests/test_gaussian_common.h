@@ -0,0 +1,15 @@
+#ifndef NUMERICAL_ANALYSIS_TEST_GAUSSIAN_COMMON_H
+#define NUMERICAL_ANALYSIS_TEST_GAUSSIAN_COMMON_H
+
+/* 确定性伪随机数（LCG），取值 [-1, 1)；各测试 / 基准在包含本头文件前
+ * 以 TEST_SEED 指定各自的初值，需要时可直接重置 test_seed */
+#ifndef TEST_SEED
+#define TEST_SEED 12345ULL
+#endif
+static unsigned long long test_seed = TEST_SEED;
+static inline double rand_unit(void) {
+    test_seed = test_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(test_seed >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+}
+
+#endif //NUMERICAL_ANALYSIS_TEST_GAUSSIAN_COMMON_H
@@ -0,0 +1,248 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_eig.h"
+#include "gaussian_gemm.h"
+#define TEST_SEED 20240911ULL
+#include "test_gaussian_common.h"
+
+static void rand_sym(size_t n, double *A, size_t lda) {
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = i; j < n; ++j)
+            A[IDX(i,j,lda)] = A[IDX(j,i,lda)] = rand_unit();
+}
+
+/* 对 k 个特征对（Z 的行）：max_i ||A z_i - w_i z_i||_inf / ||A||_1 与 ||Z Z^T - I||_max */
+static void eig_check(size_t n, const double *A, size_t lda, size_t k, const double *w,
+                      const double *Z, size_t ldz, double *resid, double *orth) {
+    double *AZ = (double*)malloc(k * n * sizeof(double));
+    double *ZZ = (double*)malloc(k * k * sizeof(double));
+    *resid = *orth = INFINITY;
+    if (AZ && ZZ
+        && gaussian_gemm(GEMM_NO_TRANS, GEMM_TRANS, k, n, n, 1.0, Z, ldz, A, lda,
+                         0.0, AZ, n, 1) == GAUSSIAN_SUCCESS
+        && gaussian_gemm(GEMM_NO_TRANS, GEMM_TRANS, k, k, n, 1.0, Z, ldz, Z, ldz,
+                         0.0, ZZ, k, 1) == GAUSSIAN_SUCCESS) {
+        const double anorm = mat_norm1(n, A, lda);
+        *resid = *orth = 0.0;
+        for (size_t i = 0; i < k; ++i)
+            for (size_t j = 0; j < n; ++j) {
+                double r = fabs(AZ[IDX(i,j,n)] - w[i] * Z[IDX(i,j,ldz)]) / anorm;
+                if (r > *resid) *resid = r;
+            }
+        for (size_t i = 0; i < k; ++i)
+            for (size_t j = 0; j < k; ++j)
+                if (fabs(ZZ[IDX(i,j,k)] - (i == j)) > *orth) *orth = fabs(ZZ[IDX(i,j,k)] - (i == j));
+    }
+    free(AZ); free(ZZ);
+}
+
+/* 随机对称矩阵全谱：残差、正交性、升序、迹 */
+static int test_sym_eig_random(size_t n, size_t nthreads) {
+    const size_t lda = n + 3;
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *W = (double*)malloc(n * lda * sizeof(double));
+    double *Z = (double*)malloc(n * n * sizeof(double));
+    double *w = (double*)malloc(n * sizeof(double));
+    double resid = INFINITY, orth = INFINITY, dtr = INFINITY;
+    int ok = A && W && Z && w;
+    if (ok) {
+        rand_sym(n, A, lda);
+        memcpy(W, A, n * lda * sizeof(double));
+        ok = sym_eig(n, W, lda, w, 0, n - 1, Z, n, nthreads) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        double tr = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            tr += A[IDX(i,i,lda)] - w[i];
+            if (i > 0 && w[i] < w[i - 1]) ok = 0;
+        }
+        dtr = fabs(tr) / (double)n;
+        eig_check(n, A, lda, n, w, Z, n, &resid, &orth);
+    }
+    ok = ok && resid < 1e-13 && orth < 1e-12 && dtr < 1e-13;
+    printf("[TEST] sym_eig 随机 n=%zu threads=%zu 残差=%.2e |ZZt-I|=%.2e 迹差=%.2e %s\n",
+           n, nthreads, resid, orth, dtr, ok ? "PASS" : "FAIL");
+    free(A); free(W); free(Z); free(w);
+    return ok;
+}
+
+/* 一维 Laplace tridiag(-1, 2, -1)：lambda_j = 2 - 2 cos(j pi / (n + 1)) */
+static int test_laplace_1d(size_t n) {
+    double *A = (double*)calloc(n * n, sizeof(double));
+    double *w = (double*)malloc(n * sizeof(double));
+    double err = INFINITY;
+    int ok = A && w;
+    for (size_t i = 0; ok && i < n; ++i) {
+        A[IDX(i,i,n)] = 2.0;
+        if (i + 1 < n) A[IDX(i,i+1,n)] = A[IDX(i+1,i,n)] = -1.0;
+    }
+    ok = ok && sym_eig(n, A, n, w, 0, 0, NULL, n, 1) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        const double pi = acos(-1.0);
+        err = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            double ex = 2.0 - 2.0 * cos((double)(j + 1) * pi / (double)(n + 1));
+            if (fabs(w[j] - ex) > err) err = fabs(w[j] - ex);
+        }
+    }
+    ok = ok && err < 1e-12;
+    printf("[TEST] sym_eig 一维 Laplace n=%zu 特征值误差=%.2e %s\n", n, err, ok ? "PASS" : "FAIL");
+    free(A); free(w);
+    return ok;
+}
+
+/* 重特征值 / 紧簇：A = Q diag(mu) Q^T，mu 含三重值与相距 1e-10 的对；
+ * 成簇向量仍须正交，特征值与 mu 一致 */
+static int test_clustered(void) {
+    const size_t n = 60;
+    double *A = (double*)calloc(n * n, sizeof(double));
+    double *Q = (double*)malloc(n * n * sizeof(double));
+    double *B = (double*)malloc(n * n * sizeof(double));
+    double *Z = (double*)malloc(n * n * sizeof(double));
+    double mu[60], w[60];
+    double resid = INFINITY, orth = INFINITY, err = INFINITY;
+    int ok = A && Q && B && Z;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) mu[i] = (double)i / (double)n;
+        mu[10] = mu[11] = mu[12] = 0.19;
+        mu[30] = 0.5;
+        mu[31] = 0.5 + 1e-10;
+        /* 随机正交 Q：对 n 个随机向量做 Gram-Schmidt（两遍） */
+        for (size_t i = 0; i < n * n; ++i) Q[i] = rand_unit();
+        for (size_t i = 0; i < n; ++i)
+            for (size_t pass = 0; pass < 2; ++pass) {
+                for (size_t j = 0; j < i; ++j) {
+                    double s = 0.0;
+                    for (size_t t = 0; t < n; ++t) s += Q[IDX(i,t,n)] * Q[IDX(j,t,n)];
+                    for (size_t t = 0; t < n; ++t) Q[IDX(i,t,n)] -= s * Q[IDX(j,t,n)];
+                }
+                double s = 0.0;
+                for (size_t t = 0; t < n; ++t) s += Q[IDX(i,t,n)] * Q[IDX(i,t,n)];
+                for (size_t t = 0; t < n; ++t) Q[IDX(i,t,n)] /= sqrt(s);
+            }
+        /* A = Q^T diag(mu) Q（Q 的行为特征向量） */
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j) B[IDX(i,j,n)] = mu[i] * Q[IDX(i,j,n)];
+        ok = gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, n, n, 1.0, Q, n, B, n,
+                           0.0, A, n, 1) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = i + 1; j < n; ++j) A[IDX(j,i,n)] = A[IDX(i,j,n)];
+        memcpy(B, A, n * n * sizeof(double));
+        ok = ok && sym_eig(n, B, n, w, 0, n - 1, Z, n, 1) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        err = 0.0;
+        for (size_t i = 0; i < n; ++i) if (fabs(w[i] - mu[i]) > err) err = fabs(w[i] - mu[i]);
+        eig_check(n, A, n, n, w, Z, n, &resid, &orth);
+    }
+    ok = ok && err < 1e-13 && resid < 1e-13 && orth < 1e-12;
+    printf("[TEST] sym_eig 重特征值 / 紧簇 特征值误差=%.2e 残差=%.2e |ZZt-I|=%.2e %s\n",
+           err, resid, orth, ok ? "PASS" : "FAIL");
+    free(A); free(Q); free(B); free(Z);
+    return ok;
+}
+
+/* 只取 il..iu：特征值与全谱一致，向量满足残差与正交性 */
+static int test_subset(size_t n, size_t il, size_t iu) {
+    const size_t k = iu - il + 1;
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *W = (double*)malloc(n * n * sizeof(double));
+    double *Z = (double*)malloc(k * n * sizeof(double));
+    double *w = (double*)malloc(n * sizeof(double));
+    double *wf = (double*)malloc(n * sizeof(double));
+    double resid = INFINITY, orth = INFINITY, dw = INFINITY;
+    int ok = A && W && Z && w && wf;
+    if (ok) {
+        rand_sym(n, A, n);
+        memcpy(W, A, n * n * sizeof(double));
+        ok = sym_eig(n, W, n, wf, 0, 0, NULL, n, 1) == GAUSSIAN_SUCCESS;
+        memcpy(W, A, n * n * sizeof(double));
+        ok = ok && sym_eig(n, W, n, w, il, iu, Z, n, 2) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        dw = 0.0;
+        for (size_t i = 0; i < n; ++i) if (fabs(w[i] - wf[i]) > dw) dw = fabs(w[i] - wf[i]);
+        eig_check(n, A, n, k, &w[il], Z, n, &resid, &orth);
+    }
+    ok = ok && dw < 1e-12 && resid < 1e-13 && orth < 1e-12;
+    printf("[TEST] sym_eig 子集 n=%zu [%zu, %zu] |w-w_full|=%.2e 残差=%.2e |ZZt-I|=%.2e %s\n",
+           n, il, iu, dw, resid, orth, ok ? "PASS" : "FAIL");
+    free(A); free(W); free(Z); free(w); free(wf);
+    return ok;
+}
+
+/* 移位求逆：最接近 sigma 的 k 个特征值与 sym_eig 的全谱一致，且按 |lambda - sigma| 升序 */
+static int test_shift_invert(size_t n, size_t k, double sigma) {
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *W = (double*)malloc(n * n * sizeof(double));
+    double *X = (double*)malloc(k * n * sizeof(double));
+    double *w = (double*)malloc(n * sizeof(double));
+    double *lam = (double*)malloc(k * sizeof(double));
+    char *used = (char*)calloc(n, 1);
+    double resid = INFINITY, orth = INFINITY, dl = INFINITY;
+    EigShiftStatus st = {0, INFINITY};
+    int ok = A && W && X && w && lam && used;
+    if (ok) {
+        rand_sym(n, A, n);
+        memcpy(W, A, n * n * sizeof(double));
+        ok = sym_eig(n, W, n, w, 0, 0, NULL, n, 1) == GAUSSIAN_SUCCESS
+          && eig_shift_invert(n, A, n, sigma, k, lam, X, n, NULL, &st) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        /* 参考：逐个挑出尚未使用的、距 sigma 最近的特征值 */
+        dl = 0.0;
+        for (size_t c = 0; c < k; ++c) {
+            size_t best = n;
+            for (size_t i = 0; i < n; ++i)
+                if (!used[i] && (best == n || fabs(w[i] - sigma) < fabs(w[best] - sigma))) best = i;
+            used[best] = 1;
+            if (fabs(lam[c] - w[best]) > dl) dl = fabs(lam[c] - w[best]);
+        }
+        eig_check(n, A, n, k, lam, X, n, &resid, &orth);
+    }
+    ok = ok && dl < 1e-11 && resid < 1e-12 && orth < 1e-10;
+    printf("[TEST] eig_shift_invert n=%zu k=%zu sigma=%.2f 迭代=%zu |lambda-ref|=%.2e 残差=%.2e %s\n",
+           n, k, sigma, st.iterations, dl, resid, ok ? "PASS" : "FAIL");
+    free(A); free(W); free(X); free(w); free(lam); free(used);
+    return ok;
+}
+
+/* 非法参数；sigma 恰为特征值时 A - sigma I 奇异 */
+static int test_eig_errors(void) {
+    double A[9] = {2.0, 0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, 5.0};
+    double w[3], Z[9], lam[1], X[3];
+    EigShiftOptions o;
+    eig_shift_options_default(&o);
+    o.tol = -1.0;
+    int ok = sym_eig(3, A, 2, w, 0, 2, Z, 3, 1) == GAUSSIAN_INVALID_INPUT
+          && sym_eig(3, A, 3, w, 2, 1, Z, 3, 1) == GAUSSIAN_INVALID_INPUT
+          && sym_eig(3, A, 3, w, 0, 3, Z, 3, 1) == GAUSSIAN_INVALID_INPUT
+          && eig_shift_invert(3, A, 3, 0.0, 0, lam, X, 3, NULL, NULL) == GAUSSIAN_INVALID_INPUT
+          && eig_shift_invert(3, A, 3, 0.0, 1, lam, X, 3, &o, NULL) == GAUSSIAN_INVALID_INPUT
+          && eig_shift_invert(3, A, 3, 3.0, 1, lam, X, 3, NULL, NULL) == GAUSSIAN_BAD_MATRIX;
+    printf("[TEST] eig 非法参数 / 奇异移位 %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_sym_eig_random(1, 1);
+    total++; passed += test_sym_eig_random(2, 1);
+    total++; passed += test_sym_eig_random(5, 1);
+    total++; passed += test_sym_eig_random(50, 1);
+    total++; passed += test_sym_eig_random(130, 1);
+    total++; passed += test_sym_eig_random(300, 3);
+    total++; passed += test_laplace_1d(200);
+    total++; passed += test_clustered();
+    total++; passed += test_subset(257, 100, 119);
+    total++; passed += test_shift_invert(200, 6, 0.3);
+    total++; passed += test_shift_invert(150, 1, 0.0);
+    total++; passed += test_eig_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_gemm.h"
+#include "gaussian_simd.h"
+#define TEST_SEED 1919ULL
+#include "test_gaussian_common.h"
+
+/* C = alpha * op(A) op(B) + beta * C 的朴素三重循环 */
+static void gemm_ref(GemmTrans ta, GemmTrans tb, size_t m, size_t n, size_t k,
+                     double alpha, const double *A, size_t lda, const double *B, size_t ldb,
+                     double beta, double *C, size_t ldc) {
+    for (size_t i = 0; i < m; ++i)
+        for (size_t j = 0; j < n; ++j) {
+            double s = 0.0;
+            for (size_t p = 0; p < k; ++p) {
+                double a = ta == GEMM_NO_TRANS ? A[IDX(i,p,lda)] : A[IDX(p,i,lda)];
+                double b = tb == GEMM_NO_TRANS ? B[IDX(p,j,ldb)] : B[IDX(j,p,ldb)];
+                s += a * b;
+            }
+            C[IDX(i,j,ldc)] = alpha * s + (beta == 0.0 ? 0.0 : beta * C[IDX(i,j,ldc)]);
+        }
+}
+
+/* 行跨度比逻辑宽度多 pad；返回 max |C - C_ref|，C 的填充列须保持不变 */
+static double gemm_case(GemmTrans ta, GemmTrans tb, size_t m, size_t n, size_t k,
+                        double alpha, double beta, size_t pad, size_t nthreads) {
+    size_t ar = ta == GEMM_NO_TRANS ? m : k, ac = ta == GEMM_NO_TRANS ? k : m;
+    size_t br = tb == GEMM_NO_TRANS ? k : n, bc = tb == GEMM_NO_TRANS ? n : k;
+    size_t lda = ac + pad, ldb = bc + pad, ldc = n + pad;
+    double *A = (double*)malloc((ar * lda + 1) * sizeof(double));
+    double *B = (double*)malloc((br * ldb + 1) * sizeof(double));
+    double *C = (double*)malloc((m * ldc + 1) * sizeof(double));
+    double *R = (double*)malloc((m * ldc + 1) * sizeof(double));
+    double diff = INFINITY;
+    if (A && B && C && R) {
+        for (size_t i = 0; i < ar * lda; ++i) A[i] = rand_unit();
+        for (size_t i = 0; i < br * ldb; ++i) B[i] = rand_unit();
+        for (size_t i = 0; i < m * ldc; ++i) C[i] = R[i] = rand_unit();
+        gemm_ref(ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, R, ldc);
+        if (gaussian_gemm(ta, tb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, nthreads)
+            == GAUSSIAN_SUCCESS) {
+            diff = 0.0;
+            for (size_t i = 0; i < m; ++i)
+                for (size_t j = 0; j < ldc; ++j) {
+                    double d = fabs(C[IDX(i,j,ldc)] - R[IDX(i,j,ldc)]);
+                    if (j >= n && d != 0.0) d = INFINITY;     /* 填充列被写 */
+                    if (d > diff) diff = d;
+                }
+        }
+    }
+    free(A); free(B); free(C); free(R);
+    return diff;
+}
+
+/* 四种转置组合 x 不整除微核 / 缓存分块的尺寸 x 各 SIMD 级别 */
+static int test_gemm_shapes(void) {
+    static const size_t shapes[][3] = {
+        { 1, 1, 1 }, { 7, 5, 3 }, { 17, 33, 9 }, { 64, 64, 64 },
+        { 129, 70, 300 }, { 13, 2100, 17 }, { 300, 11, 5 }
+    };
+    GaussianSimdLevel level = gaussian_simd_detect();
+    double worst = 0.0;
+    int ok = 1;
+    for (int pass = 0; pass < 2; ++pass) {
+        gaussian_simd_set_level(pass == 0 ? GAUSSIAN_SIMD_SCALAR : level);
+        for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); ++s)
+            for (int t = 0; t < 4; ++t) {
+                size_t m = shapes[s][0], n = shapes[s][1], k = shapes[s][2];
+                double d = gemm_case((GemmTrans)(t & 1), (GemmTrans)(t >> 1), m, n, k,
+                                     -1.5, 0.5, (s + t) % 3, 1);
+                if (d > worst) worst = d;
+                if (!(d <= 1e-13 * (double)k)) ok = 0;
+            }
+    }
+    gaussian_simd_set_level(level);
+    printf("[TEST] gemm 转置组合与边界尺寸 max diff=%.2e %s\n", worst, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+/* 多线程：各元素只由一个线程累加，结果与单线程逐位相同（含按列切段的情形） */
+static int test_gemm_threads(void) {
+    static const size_t shapes[][3] = { { 400, 300, 260 }, { 40, 3000, 200 } };
+    int ok = 1;
+    for (size_t s = 0; s < 2 && ok; ++s) {
+        size_t m = shapes[s][0], n = shapes[s][1], k = shapes[s][2];
+        double *A = (double*)malloc(m * k * sizeof(double));
+        double *B = (double*)malloc(k * n * sizeof(double));
+        double *C1 = (double*)malloc(m * n * sizeof(double));
+        double *C4 = (double*)malloc(m * n * sizeof(double));
+        ok = A && B && C1 && C4;
+        if (ok) {
+            for (size_t i = 0; i < m * k; ++i) A[i] = rand_unit();
+            for (size_t i = 0; i < k * n; ++i) B[i] = rand_unit();
+            for (size_t i = 0; i < m * n; ++i) C1[i] = C4[i] = rand_unit();
+            ok = gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, n, k, 1.0, A, k, B, n,
+                               1.0, C1, n, 1) == GAUSSIAN_SUCCESS
+              && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, n, k, 1.0, A, k, B, n,
+                               1.0, C4, n, 4) == GAUSSIAN_SUCCESS
+              && memcmp(C1, C4, m * n * sizeof(double)) == 0;
+        }
+        free(A); free(B); free(C1); free(C4);
+    }
+    printf("[TEST] gemm 多线程与单线程逐位一致 %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+/* beta = 0 忽略 C 原值（NaN）；alpha = 0 / k = 0 只缩放；非法参数 */
+static int test_gemm_special(void) {
+    double A[6] = { 1, 2, 3, 4, 5, 6 };        /* 2 x 3 */
+    double B[6] = { 1, 0, 0, 1, 1, 1 };        /* 3 x 2 */
+    double C[4] = { NAN, NAN, NAN, NAN };
+    int ok = gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, 2, 2, 3, 1.0, A, 3, B, 2,
+                           0.0, C, 2, 1) == GAUSSIAN_SUCCESS
+          && C[0] == 4 && C[1] == 5 && C[2] == 10 && C[3] == 11;
+
+    double D[4] = { 1, 2, 3, 4 };
+    ok = ok && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, 2, 2, 3, 0.0, NULL, 0, NULL, 0,
+                             2.0, D, 2, 1) == GAUSSIAN_SUCCESS
+            && D[0] == 2 && D[3] == 8;
+    ok = ok && gaussian_gemm(GEMM_TRANS, GEMM_TRANS, 2, 2, 0, 1.0, A, 2, B, 0,
+                             -1.0, D, 2, 1) == GAUSSIAN_SUCCESS
+            && D[0] == -2 && D[3] == -8;
+
+    ok = ok && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, 2, 2, 3, 1.0, A, 2, B, 2,
+                             0.0, C, 2, 1) == GAUSSIAN_INVALID_INPUT
+            && gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, 2, 2, 3, 1.0, A, 1, B, 2,
+                             0.0, C, 2, 1) == GAUSSIAN_INVALID_INPUT
+            && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, 2, 2, 3, 1.0, A, 3, B, 2,
+                             0.0, C, 1, 1) == GAUSSIAN_INVALID_INPUT
+            && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, 2, 2, 3, 1.0, NULL, 3, B, 2,
+                             0.0, C, 2, 1) == GAUSSIAN_INVALID_INPUT
+            && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, 0, 2, 3, 1.0, NULL, 0, NULL, 0,
+                             0.0, NULL, 0, 1) == GAUSSIAN_SUCCESS;
+    printf("[TEST] gemm beta=0 / alpha=0 / k=0 / 非法参数 %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_gemm_shapes();
+    total++; passed += test_gemm_threads();
+    total++; passed += test_gemm_special();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_matfile.h"
+#define TEST_SEED 20240715ULL
+#include "test_gaussian_common.h"
+
+static const char *tmp_path = "test_gaussian_matfile.tmp";
+
+/* 写出后映射：行跨度按 align 补齐、行首对齐、内容逐元素一致（F32 为舍入后的值） */
+static int test_roundtrip(size_t rows, size_t cols, GMatDtype dtype, size_t align) {
+    const size_t lda = cols + 5;
+    double *A = (double*)malloc(rows * lda * sizeof(double));
+    GMatMap m;
+    int ok = A != NULL;
+    for (size_t i = 0; ok && i < rows * lda; ++i) A[i] = rand_unit();
+    ok = ok && gmat_write(tmp_path, rows, cols, A, lda, dtype, align) == GAUSSIAN_SUCCESS
+            && gmat_map(tmp_path, GMAT_MAP_READONLY, &m) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        const size_t es = dtype == GMAT_F64 ? sizeof(double) : sizeof(float);
+        ok = m.rows == rows && m.cols == cols && m.dtype == dtype && m.data == NULL
+          && m.lda == gmat_aligned_lda(cols, dtype, align) && m.lda >= cols
+          && (m.lda * es) % m.align == 0 && (uintptr_t)m.cdata % m.align == 0;
+        for (size_t i = 0; ok && i < rows; ++i)
+            for (size_t j = 0; j < cols; ++j) {
+                double v = dtype == GMAT_F64 ? ((const double*)m.cdata)[IDX(i,j,m.lda)]
+                                             : (double)((const float*)m.cdata)[IDX(i,j,m.lda)];
+                double ref = dtype == GMAT_F64 ? A[IDX(i,j,lda)] : (double)(float)A[IDX(i,j,lda)];
+                if (v != ref) { ok = 0; break; }
+            }
+        gmat_unmap(&m);
+    }
+    printf("[TEST] gmat 读写 %zux%zu %s align=%zu %s\n", rows, cols,
+           dtype == GMAT_F64 ? "f64" : "f32", align, ok ? "PASS" : "FAIL");
+    remove(tmp_path);
+    free(A);
+    return ok;
+}
+
+/* 写时复制映射直接交给就地例程：结果与 malloc 拷贝一致，文件与只读映射均不变 */
+static int test_cow_solvers(size_t n) {
+    const size_t la = n + 1;
+    double *Aug = (double*)malloc(n * la * sizeof(double));
+    double *work = (double*)malloc(n * la * sizeof(double));
+    double *x0 = (double*)malloc(n * sizeof(double));
+    double *x1 = (double*)malloc(n * sizeof(double));
+    size_t *piv0 = (size_t*)malloc(n * sizeof(size_t));
+    size_t *piv1 = (size_t*)malloc(n * sizeof(size_t));
+    GMatMap ro = { 0 }, cow = { 0 };
+    int ok = Aug && work && x0 && x1 && piv0 && piv1;
+    for (size_t i = 0; ok && i < n * la; ++i) Aug[i] = rand_unit();
+    ok = ok && gmat_write(tmp_path, n, la, Aug, la, GMAT_F64, 0) == GAUSSIAN_SUCCESS
+            && gmat_map(tmp_path, GMAT_MAP_READONLY, &ro) == GAUSSIAN_SUCCESS;
+    if (!ok) goto done;
+    /* 增广矩阵：映射上就地消元，与内存中拷贝上的 gauss_pp_core 逐位一致 */
+    memcpy(work, Aug, n * la * sizeof(double));
+    ok = gauss_pp_core(n, work, la, x0) == GAUSSIAN_SUCCESS
+      && gmat_map(tmp_path, GMAT_MAP_COPY_ON_WRITE, &cow) == GAUSSIAN_SUCCESS
+      && cow.data != NULL
+      && gauss_pp_core(n, (double*)cow.data, cow.lda, x1) == GAUSSIAN_SUCCESS
+      && memcmp(x0, x1, n * sizeof(double)) == 0;
+    gmat_unmap(&cow);
+    /* 前 n 列作为方阵：lu_decompose_pp 就地分解 */
+    memcpy(work, Aug, n * la * sizeof(double));
+    ok = ok && lu_decompose_pp(n, work, la, piv0) == GAUSSIAN_SUCCESS
+            && gmat_map(tmp_path, GMAT_MAP_COPY_ON_WRITE, &cow) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        double *LU = (double*)cow.data;
+        ok = lu_decompose_pp(n, LU, cow.lda, piv1) == GAUSSIAN_SUCCESS
+          && memcmp(piv0, piv1, n * sizeof(size_t)) == 0;
+        for (size_t i = 0; ok && i < n; ++i)
+            ok = memcmp(&LU[IDX(i,0,cow.lda)], &work[IDX(i,0,la)], n * sizeof(double)) == 0;
+        gmat_unmap(&cow);
+    }
+    /* 先打开的只读映射与重新映射的文件内容都保持原样 */
+    for (size_t i = 0; ok && i < n; ++i)
+        ok = memcmp(&((const double*)ro.cdata)[IDX(i,0,ro.lda)], &Aug[IDX(i,0,la)],
+                    la * sizeof(double)) == 0;
+    gmat_unmap(&ro);
+    ok = ok && gmat_map(tmp_path, GMAT_MAP_READONLY, &ro) == GAUSSIAN_SUCCESS;
+    for (size_t i = 0; ok && i < n; ++i)
+        ok = memcmp(&((const double*)ro.cdata)[IDX(i,0,ro.lda)], &Aug[IDX(i,0,la)],
+                    la * sizeof(double)) == 0;
+done:
+    gmat_unmap(&ro);
+    printf("[TEST] gmat 写时复制映射 + gauss_pp_core / lu_decompose_pp n=%zu %s\n",
+           n, ok ? "PASS" : "FAIL");
+    remove(tmp_path);
+    free(Aug); free(work); free(x0); free(x1); free(piv0); free(piv1);
+    return ok;
+}
+
+/* 非法参数、魔数错误、文件截断 */
+static int test_errors(void) {
+    double A[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    unsigned char bytes[512];
+    GMatMap m;
+    int ok = gmat_aligned_lda(3, GMAT_F64, 48) == 0
+          && gmat_aligned_lda(3, GMAT_F32, 2) == 0
+          && gmat_aligned_lda(3, GMAT_F32, 16) == 4
+          && gmat_write(tmp_path, 3, 4, A, 4, GMAT_F64, 24) == GAUSSIAN_INVALID_INPUT
+          && gmat_write(tmp_path, 3, 4, A, 3, GMAT_F64, 0) == GAUSSIAN_INVALID_INPUT
+          && gmat_write(tmp_path, 0, 4, A, 4, GMAT_F64, 0) == GAUSSIAN_INVALID_INPUT
+          && gmat_write(tmp_path, 3, 4, A, 4, (GMatDtype)7, 0) == GAUSSIAN_INVALID_INPUT
+          && gmat_map("no/such/dir/file.gmat", GMAT_MAP_READONLY, &m) == GAUSSIAN_INVALID_INPUT
+          && gmat_write(tmp_path, 3, 4, A, 4, GMAT_F64, 0) == GAUSSIAN_SUCCESS;
+    FILE *fp = ok ? fopen(tmp_path, "rb") : NULL;
+    size_t len = fp ? fread(bytes, 1, sizeof(bytes), fp) : 0;
+    if (fp) fclose(fp);
+    ok = ok && len == 64 + 3 * 8 * sizeof(double);
+    /* 截掉最后一个元素 */
+    fp = ok ? fopen(tmp_path, "wb") : NULL;
+    ok = ok && fp && fwrite(bytes, 1, len - 1, fp) == len - 1;
+    if (fp) fclose(fp);
+    ok = ok && gmat_map(tmp_path, GMAT_MAP_READONLY, &m) == GAUSSIAN_INVALID_INPUT;
+    /* 魔数错误 */
+    bytes[0] = 'X';
+    fp = ok ? fopen(tmp_path, "wb") : NULL;
+    ok = ok && fp && fwrite(bytes, 1, len, fp) == len;
+    if (fp) fclose(fp);
+    ok = ok && gmat_map(tmp_path, GMAT_MAP_COPY_ON_WRITE, &m) == GAUSSIAN_INVALID_INPUT;
+    printf("[TEST] gmat 非法参数 / 魔数 / 截断 %s\n", ok ? "PASS" : "FAIL");
+    remove(tmp_path);
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_roundtrip(1, 1, GMAT_F64, 8);
+    total++; passed += test_roundtrip(37, 38, GMAT_F64, 64);
+    total++; passed += test_roundtrip(20, 13, GMAT_F32, 32);
+    total++; passed += test_roundtrip(9, 300, GMAT_F64, 4096);
+    total++; passed += test_cow_solvers(6);
+    total++; passed += test_cow_solvers(150);
+    total++; passed += test_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
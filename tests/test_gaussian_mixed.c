@@ -0,0 +1,171 @@
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_mixed.h"
+#include "gaussian_simd.h"
+#define TEST_SEED 20240607ULL
+#include "test_gaussian_common.h"
+
+static void fill_random(size_t n, double *A, size_t lda, double *b) {
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) A[IDX(i,j,lda)] = rand_unit();
+        b[i] = rand_unit();
+    }
+}
+
+/* 末行 = 前两行平均 + delta 扰动：cond(A) ~ 1/delta */
+static void make_near_singular(size_t n, double *A, size_t lda, double delta) {
+    for (size_t j = 0; j < n; ++j)
+        A[IDX(n-1,j,lda)] = 0.5 * (A[IDX(0,j,lda)] + A[IDX(1,j,lda)]) + delta * rand_unit();
+}
+
+/* 单精度核在各 SIMD 级别下与标量核一致（FMA 只差一次舍入） */
+static int test_saxpy_levels(void) {
+    const size_t len = 37;
+    float x[37], y0[37], y1[4][37], ref[37], ref4[4][37];
+    const float a4[4] = { 0.75f, -1.25f, 2.5f, 0.125f };
+    GaussianSimdLevel cap = gaussian_simd_detect();
+    int ok = 1;
+    for (int level = GAUSSIAN_SIMD_SCALAR; level <= (int)cap; ++level) {
+        gaussian_simd_set_level((GaussianSimdLevel)level);
+        const GaussianKernels *K = gaussian_kernels();
+        for (size_t j = 0; j < len; ++j) {
+            x[j] = (float)rand_unit();
+            y0[j] = ref[j] = (float)rand_unit();
+            for (int r = 0; r < 4; ++r) y1[r][j] = ref4[r][j] = (float)rand_unit();
+        }
+        K->saxpy(len, 0.3f, x, y0);
+        K->saxpy4(len, a4, x, y1[0], y1[1], y1[2], y1[3]);
+        for (size_t j = 0; j < len; ++j) {
+            float e = ref[j] - 0.3f * x[j];
+            ok = ok && fabsf(y0[j] - e) <= 4.0f * FLT_EPSILON * (fabsf(ref[j]) + fabsf(x[j]));
+            for (int r = 0; r < 4; ++r) {
+                float e4 = ref4[r][j] - a4[r] * x[j];
+                ok = ok && fabsf(y1[r][j] - e4) <= 4.0f * FLT_EPSILON * (fabsf(ref4[r][j]) + 3.0f * fabsf(x[j]));
+            }
+        }
+    }
+    gaussian_simd_set_level(cap);
+    printf("[TEST] saxpy/saxpy4 levels 0..%d %s\n", (int)cap, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+/* 单精度 LU：||PA - LU||_max / ||A||_max 为 float 精度，主元序列为置换 */
+static int test_lu_f32(size_t n, size_t lda) {
+    float *A = (float*)malloc(n * lda * sizeof(float));
+    float *LU = (float*)malloc(n * lda * sizeof(float));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    unsigned char *seen = (unsigned char*)calloc(n, 1);
+    int ok = A && LU && piv && seen;
+    double err = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < n * lda; ++i) A[i] = LU[i] = (float)rand_unit();
+        ok = lu_decompose_pp_f32(n, LU, lda, piv) == GAUSSIAN_SUCCESS;
+    }
+    for (size_t i = 0; ok && i < n; ++i) {
+        if (piv[i] >= n || seen[piv[i]]) { ok = 0; break; }
+        seen[piv[i]] = 1;
+        for (size_t j = 0; j < n; ++j) {
+            double s = 0.0;
+            size_t kmax = i < j ? i : j;
+            for (size_t k = 0; k < kmax; ++k) s += (double)LU[IDX(i,k,lda)] * LU[IDX(k,j,lda)];
+            s += i <= j ? (double)LU[IDX(i,j,lda)] : (double)LU[IDX(i,j,lda)] * LU[IDX(j,j,lda)];
+            double e = fabs(s - A[IDX(piv[i],j,lda)]);
+            if (e > err) err = e;
+        }
+    }
+    ok = ok && err < 1e-4;
+    printf("[TEST] lu_decompose_pp_f32 n=%zu lda=%zu err=%.2e %s\n", n, lda, err, ok ? "PASS" : "FAIL");
+    free(A); free(LU); free(piv); free(seen);
+    return ok;
+}
+
+/* 良态随机矩阵：不回退，几步细化达到双精度后向误差，与双精度 LU 的解一致 */
+static int test_mixed_random(size_t n, size_t lda) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *LU = (double*)malloc(n * lda * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    double *xd = (double*)malloc(n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    MixedStatus st = { 0, 0.0, 0 };
+    int ok = A && LU && b && x && xd && piv;
+    double diff = 0.0, xn = 0.0;
+    if (ok) {
+        fill_random(n, A, lda, b);
+        memcpy(LU, A, n * lda * sizeof(double));
+        ok = mixed_lu_solve(n, A, lda, b, x, NULL, &st) == GAUSSIAN_SUCCESS
+          && lu_decompose_pp(n, LU, lda, piv) == GAUSSIAN_SUCCESS
+          && lu_solve(n, LU, lda, piv, b, xd) == GAUSSIAN_SUCCESS;
+    }
+    for (size_t i = 0; ok && i < n; ++i) {
+        if (fabs(x[i] - xd[i]) > diff) diff = fabs(x[i] - xd[i]);
+        if (fabs(xd[i]) > xn) xn = fabs(xd[i]);
+    }
+    ok = ok && !st.fallback && st.iterations <= 10
+            && st.backward_error <= sqrt((double)n) * DBL_EPSILON && diff <= 1e-9 * xn;
+    printf("[TEST] mixed_lu_solve random n=%zu lda=%zu iters=%zu berr=%.2e diff=%.2e %s\n",
+           n, lda, st.iterations, st.backward_error, diff, ok ? "PASS" : "FAIL");
+    free(A); free(LU); free(b); free(x); free(xd); free(piv);
+    return ok;
+}
+
+/* cond(A) * FLT_EPSILON >> 1：细化停滞，回退双精度；禁止回退时返回 NOT_CONVERGED */
+static int test_mixed_fallback(size_t n) {
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    MixedStatus st = { 0, 0.0, 0 }, st2 = { 0, 0.0, 0 };
+    MixedOptions opts;
+    mixed_options_default(&opts);
+    int ok = A && b && x;
+    if (ok) {
+        fill_random(n, A, n, b);
+        make_near_singular(n, A, n, 1e-10);
+        ok = mixed_lu_solve(n, A, n, b, x, &opts, &st) == GAUSSIAN_SUCCESS
+          && st.fallback && st.backward_error <= sqrt((double)n) * DBL_EPSILON;
+        opts.allow_fallback = 0;
+        GAUSSIAN_Err ret = mixed_lu_solve(n, A, n, b, x, &opts, &st2);
+        ok = ok && !st2.fallback
+                && (ret == GAUSSIAN_NOT_CONVERGED || ret == GAUSSIAN_BAD_MATRIX);
+    }
+    printf("[TEST] mixed_lu_solve near-singular n=%zu fallback berr=%.2e (no-fallback berr=%.2e) %s\n",
+           n, st.backward_error, st2.backward_error, ok ? "PASS" : "FAIL");
+    free(A); free(b); free(x);
+    return ok;
+}
+
+static int test_mixed_errors(void) {
+    double A[9] = { 1, 2, 3, 2, 4, 6, 1, 0, 1 };        /* 前两行线性相关 */
+    double B[4] = { 1e300, 2e300, 3e300, -1e300 };        /* 超出 float 范围 */
+    double b[3] = { 1, 2, 3 }, x[3];
+    MixedStatus st = { 0, 0.0, 0 };
+    int ok = mixed_lu_solve(3, A, 3, b, x, NULL, NULL) == GAUSSIAN_BAD_MATRIX
+          && mixed_lu_solve(3, A, 2, b, x, NULL, NULL) == GAUSSIAN_INVALID_INPUT
+          && mixed_lu_solve(3, A, 3, b, b, NULL, NULL) == GAUSSIAN_INVALID_INPUT
+          && mixed_lu_solve(0, A, 0, b, x, NULL, NULL) == GAUSSIAN_SUCCESS;
+    ok = ok && mixed_lu_solve(2, B, 2, b, x, NULL, &st) == GAUSSIAN_SUCCESS && st.fallback
+            && fabs(1e300 * x[0] + 2e300 * x[1] - 1.0) < 1e-14
+            && fabs(3e300 * x[0] - 1e300 * x[1] - 2.0) < 1e-14;
+    printf("[TEST] mixed_lu_solve singular / invalid / out of float range %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_saxpy_levels();
+    total++; passed += test_lu_f32(1, 1);
+    total++; passed += test_lu_f32(150, 157);
+    total++; passed += test_mixed_random(1, 1);
+    total++; passed += test_mixed_random(64, 64);
+    total++; passed += test_mixed_random(300, 307);
+    total++; passed += test_mixed_fallback(120);
+    total++; passed += test_mixed_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
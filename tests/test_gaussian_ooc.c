@@ -0,0 +1,128 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_ooc.h"
+#define TEST_SEED 20240601ULL
+#include "test_gaussian_common.h"
+
+static const char *tmp_path = "test_gaussian_ooc.tmp";
+
+/* 外存分解与 lu_decompose_pp 对比：主元序列一致、因子一致；重新打开文件后求解多右端 */
+static int test_ooc_factor(size_t n, size_t w, size_t nrhs, size_t nthreads) {
+    const size_t lda = n + 3;
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *LU = (double*)malloc(n * lda * sizeof(double));
+    double *P = (double*)malloc(n * w * sizeof(double));
+    double *B = (double*)malloc(n * nrhs * sizeof(double));
+    double *X = (double*)malloc(n * nrhs * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    OocMatrix M;
+    OocStats st;
+    OocOptions opts = { 3 * n * w * sizeof(double), nthreads };
+    double fdiff = INFINITY, xdiff = INFINITY;
+    int ok = A && LU && P && B && X && piv;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < lda; ++j) A[IDX(i,j,lda)] = rand_unit();
+        for (size_t i = 0; i < n * nrhs; ++i) B[i] = rand_unit();
+        memcpy(LU, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, LU, lda, piv) == GAUSSIAN_SUCCESS
+          && ooc_create(tmp_path, n, w, &M) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        /* 分两段按行写入 */
+        ok = ooc_write_rows(&M, 0, n / 2, A, lda) == GAUSSIAN_SUCCESS
+          && ooc_write_rows(&M, n / 2, n - n / 2, &A[IDX(n / 2,0,lda)], lda) == GAUSSIAN_SUCCESS
+          && ooc_lu_factor(&M, &opts, &st) == GAUSSIAN_SUCCESS;
+        /* GEMM 的累加次序不同，近似平局处主元可能不同：主元序列相同时才逐元素比较因子，
+         * 解的比较（下方）总是进行 */
+        const int same_piv = ok && memcmp(M.piv, piv, n * sizeof(size_t)) == 0;
+        fdiff = 0.0;
+        for (size_t k = 0; ok && same_piv && k * w < n; ++k) {
+            size_t c0 = k * w, wb = n - c0 < w ? n - c0 : w;
+            ok = ooc_read_panel(&M, k, P) == GAUSSIAN_SUCCESS;
+            for (size_t i = 0; ok && i < n; ++i)
+                for (size_t j = 0; j < wb; ++j) {
+                    double d = fabs(P[IDX(i,j,wb)] - LU[IDX(i,c0 + j,lda)]);
+                    if (d > fdiff) fdiff = d;
+                }
+        }
+        ooc_close(&M);
+    }
+    if (ok && ooc_open(tmp_path, &M) == GAUSSIAN_SUCCESS) {
+        ok = M.factored && M.n == n && M.w == w
+          && ooc_lu_solve(&M, nrhs, B, nrhs, X, nrhs, &opts) == GAUSSIAN_SUCCESS;
+        xdiff = 0.0;
+        for (size_t r = 0; ok && r < nrhs; ++r) {
+            double *b = (double*)malloc(n * sizeof(double));
+            double *x = (double*)malloc(n * sizeof(double));
+            ok = b && x;
+            for (size_t i = 0; ok && i < n; ++i) b[i] = B[IDX(i,r,nrhs)];
+            ok = ok && lu_solve(n, LU, lda, piv, b, x) == GAUSSIAN_SUCCESS;
+            for (size_t i = 0; ok && i < n; ++i)
+                if (fabs(x[i] - X[IDX(i,r,nrhs)]) > xdiff) xdiff = fabs(x[i] - X[IDX(i,r,nrhs)]);
+            free(b); free(x);
+        }
+        ooc_close(&M);
+    } else {
+        ok = 0;
+    }
+    ok = ok && fdiff < 1e-10 && xdiff < 1e-8;
+    printf("[TEST] ooc_lu n=%zu w=%zu nrhs=%zu threads=%zu factor diff=%.2e solve diff=%.2e %s\n",
+           n, w, nrhs, nthreads, fdiff, xdiff, ok ? "PASS" : "FAIL");
+    remove(tmp_path);
+    free(A); free(LU); free(P); free(B); free(X); free(piv);
+    return ok;
+}
+
+/* 预算不足、奇异矩阵、格式错误、未分解即求解 */
+static int test_ooc_errors(void) {
+    const size_t n = 90, w = 20;
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double b[90], x[90];
+    OocMatrix M;
+    OocOptions small = { 3 * n * w * sizeof(double) - 1, 1 };
+    OocOptions fit = { 3 * n * w * sizeof(double), 1 };
+    int ok = A != NULL;
+    for (size_t i = 0; ok && i < n * n; ++i) A[i] = rand_unit();
+    for (size_t i = 0; i < n; ++i) b[i] = 1.0;
+    /* 第 70 行为第 3 行的倍数：矩阵奇异，分解中途返回 */
+    for (size_t j = 0; ok && j < n; ++j) A[IDX(70,j,n)] = 0.5 * A[IDX(3,j,n)];
+    ok = ok && ooc_panel_width(n, 3 * n * w * sizeof(double)) == w
+            && ooc_panel_width(n, 1) == 0
+            && ooc_create(tmp_path, n, w, &M) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        ok = ooc_write_rows(&M, 0, n, A, n) == GAUSSIAN_SUCCESS
+          && ooc_write_rows(&M, 1, n, A, n) == GAUSSIAN_INVALID_INPUT
+          && ooc_lu_solve(&M, 1, b, 1, x, 1, &fit) == GAUSSIAN_INVALID_INPUT
+          && ooc_lu_factor(&M, &small, NULL) == GAUSSIAN_NO_MEMORY
+          && ooc_lu_factor(&M, &fit, NULL) == GAUSSIAN_BAD_MATRIX
+          && !M.factored;
+        ooc_close(&M);
+    }
+    FILE *fp = fopen(tmp_path, "wb");
+    if (fp) { fputs("not a panel file, definitely not", fp); fclose(fp); }
+    ok = ok && fp && ooc_open(tmp_path, &M) == GAUSSIAN_INVALID_INPUT
+            && ooc_open("no/such/dir/file.ooc", &M) == GAUSSIAN_INVALID_INPUT
+            && ooc_create(tmp_path, 0, 1, &M) == GAUSSIAN_INVALID_INPUT;
+    printf("[TEST] ooc_lu 预算不足 / 奇异 / 格式错误 %s\n", ok ? "PASS" : "FAIL");
+    remove(tmp_path);
+    free(A);
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_ooc_factor(1, 1, 1, 1);
+    total++; passed += test_ooc_factor(70, 70, 2, 1);
+    total++; passed += test_ooc_factor(203, 32, 3, 1);
+    total++; passed += test_ooc_factor(400, 150, 5, 3);
+    total++; passed += test_ooc_factor(300, 7, 1, 2);
+    total++; passed += test_ooc_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_gemm.h"
+#include "gaussian_qr.h"
+#define TEST_SEED 20240805ULL
+#include "test_gaussian_common.h"
+
+/* ||Q^T Q - I||_max 与 ||Q R - A||_max / ||A||_max，并核对 qr_apply_qt 与显式 Q^T 一致 */
+static int test_qr_decompose(size_t m, size_t n, size_t nthreads) {
+    const size_t lda = n + 2, nrhs = 3;
+    double *A = (double*)malloc(m * lda * sizeof(double));
+    double *QR = (double*)malloc(m * lda * sizeof(double));
+    double *Q = (double*)malloc(m * n * sizeof(double));
+    double *R = (double*)calloc(n * n, sizeof(double));
+    double *QtQ = (double*)malloc(n * n * sizeof(double));
+    double *B = (double*)malloc(m * nrhs * sizeof(double));
+    double *QtB = (double*)malloc(n * nrhs * sizeof(double));
+    double *tau = (double*)malloc(n * sizeof(double));
+    double orth = INFINITY, resid = INFINITY, app = INFINITY;
+    int ok = A && QR && Q && R && QtQ && B && QtB && tau;
+    if (ok) {
+        double amax = 0.0;
+        for (size_t i = 0; i < m * lda; ++i) {
+            A[i] = rand_unit();
+            if (fabs(A[i]) > amax) amax = fabs(A[i]);
+        }
+        for (size_t i = 0; i < m * nrhs; ++i) B[i] = rand_unit();
+        memcpy(QR, A, m * lda * sizeof(double));
+        ok = qr_decompose(m, n, QR, lda, tau, nthreads) == GAUSSIAN_SUCCESS
+          && qr_form_q(m, n, QR, lda, tau, Q, n, nthreads) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i)
+            memcpy(&R[IDX(i,i,n)], &QR[IDX(i,i,lda)], (n - i) * sizeof(double));
+        ok = ok && gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, n, m, 1.0, Q, n, Q, n,
+                                 0.0, QtQ, n, 1) == GAUSSIAN_SUCCESS
+                && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, n, n, 1.0, Q, n, R, n,
+                                 -1.0, A, lda, 1) == GAUSSIAN_SUCCESS
+                && gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, nrhs, m, 1.0, Q, n, B, nrhs,
+                                 0.0, QtB, nrhs, 1) == GAUSSIAN_SUCCESS
+                && qr_apply_qt(m, n, QR, lda, tau, nrhs, B, nrhs, nthreads) == GAUSSIAN_SUCCESS;
+        if (ok) {
+            orth = resid = app = 0.0;
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < n; ++j)
+                    if (fabs(QtQ[IDX(i,j,n)] - (i == j)) > orth) orth = fabs(QtQ[IDX(i,j,n)] - (i == j));
+            for (size_t i = 0; i < m; ++i)
+                for (size_t j = 0; j < n; ++j)
+                    if (fabs(A[IDX(i,j,lda)]) > resid) resid = fabs(A[IDX(i,j,lda)]);
+            resid /= amax;
+            for (size_t i = 0; i < n * nrhs; ++i)
+                if (fabs(QtB[i] - B[i]) > app) app = fabs(QtB[i] - B[i]);
+        }
+    }
+    ok = ok && orth < 1e-12 && resid < 1e-12 && app < 1e-11;
+    printf("[TEST] qr_decompose m=%zu n=%zu threads=%zu |QtQ-I|=%.2e |QR-A|=%.2e |Qt B|=%.2e %s\n",
+           m, n, nthreads, orth, resid, app, ok ? "PASS" : "FAIL");
+    free(A); free(QR); free(Q); free(R); free(QtQ); free(B); free(QtB); free(tau);
+    return ok;
+}
+
+/* 随机超定问题：指定线程数的解与单线程一致（两者可能分别走直接法 / TSQR），
+ * 且残差与 A 的列正交（A^T r = 0） */
+static int test_lstsq(size_t m, size_t n, size_t nrhs, size_t nthreads) {
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double *W = (double*)malloc(m * n * sizeof(double));
+    double *B = (double*)malloc(m * nrhs * sizeof(double));
+    double *Bw = (double*)malloc(m * nrhs * sizeof(double));
+    double *X1 = (double*)malloc(n * nrhs * sizeof(double));
+    double *Xt = (double*)malloc(n * nrhs * sizeof(double));
+    double *Atr = (double*)malloc(n * nrhs * sizeof(double));
+    double dx = INFINITY, ortho = INFINITY;
+    int ok = A && W && B && Bw && X1 && Xt && Atr;
+    if (ok) {
+        for (size_t i = 0; i < m * n; ++i) A[i] = rand_unit();
+        for (size_t i = 0; i < m * nrhs; ++i) B[i] = rand_unit();
+        memcpy(W, A, m * n * sizeof(double));
+        memcpy(Bw, B, m * nrhs * sizeof(double));
+        ok = qr_lstsq(m, n, W, n, nrhs, Bw, nrhs, X1, nrhs, 1) == GAUSSIAN_SUCCESS;
+        memcpy(W, A, m * n * sizeof(double));
+        memcpy(Bw, B, m * nrhs * sizeof(double));
+        ok = ok && qr_lstsq(m, n, W, n, nrhs, Bw, nrhs, Xt, nrhs, nthreads) == GAUSSIAN_SUCCESS
+                /* r = B - A X，A^T r 应为舍入误差量级 */
+                && gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, nrhs, n, -1.0, A, n, Xt, nrhs,
+                                 1.0, B, nrhs, 1) == GAUSSIAN_SUCCESS
+                && gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, nrhs, m, 1.0, A, n, B, nrhs,
+                                 0.0, Atr, nrhs, 1) == GAUSSIAN_SUCCESS;
+        if (ok) {
+            dx = ortho = 0.0;
+            for (size_t i = 0; i < n * nrhs; ++i) {
+                if (fabs(X1[i] - Xt[i]) > dx) dx = fabs(X1[i] - Xt[i]);
+                if (fabs(Atr[i]) > ortho) ortho = fabs(Atr[i]);
+            }
+            ortho /= (double)m;
+        }
+    }
+    ok = ok && dx < 1e-12 && ortho < 1e-13;
+    printf("[TEST] qr_lstsq m=%zu n=%zu nrhs=%zu threads=%zu |X-X_1t|=%.2e |A^T r|/m=%.2e %s\n",
+           m, n, nrhs, nthreads, dx, ortho, ok ? "PASS" : "FAIL");
+    free(A); free(W); free(B); free(Bw); free(X1); free(Xt); free(Atr);
+    return ok;
+}
+
+/* 病态多项式拟合（Vandermonde，cond ~ 1e9）：相容右端下 QR 仍恢复系数，
+ * 法方程 + gauss_pp_core（cond^2 ~ 1e18）误差大得多或直接失败 */
+static int test_lstsq_vandermonde(void) {
+    const size_t m = 400, n = 11;
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double *b = (double*)malloc(m * sizeof(double));
+    double *Aug = (double*)malloc(n * (n + 1) * sizeof(double));
+    double x[11], xn[11], xt[11];
+    int ok = A && b && Aug;
+    double eq = INFINITY, en = INFINITY;
+    for (size_t j = 0; j < n; ++j) xt[j] = 1.0 / (double)(j + 1);
+    for (size_t i = 0; ok && i < m; ++i) {
+        double t = (double)i / (double)(m - 1), p = 1.0;
+        b[i] = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            A[IDX(i,j,n)] = p;
+            b[i] += xt[j] * p;
+            p *= t;
+        }
+    }
+    /* 法方程 [A^T A | A^T b] */
+    for (size_t r = 0; ok && r < n; ++r)
+        for (size_t c = 0; c <= n; ++c) {
+            double s = 0.0;
+            for (size_t i = 0; i < m; ++i) s += A[IDX(i,r,n)] * (c < n ? A[IDX(i,c,n)] : b[i]);
+            Aug[IDX(r,c,n+1)] = s;
+        }
+    if (ok && gauss_pp_core(n, Aug, n + 1, xn) == GAUSSIAN_SUCCESS) {
+        en = 0.0;
+        for (size_t j = 0; j < n; ++j) if (fabs(xn[j] - xt[j]) > en) en = fabs(xn[j] - xt[j]);
+    }
+    ok = ok && qr_lstsq(m, n, A, n, 1, b, 1, x, 1, 1) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        eq = 0.0;
+        for (size_t j = 0; j < n; ++j) if (fabs(x[j] - xt[j]) > eq) eq = fabs(x[j] - xt[j]);
+    }
+    ok = ok && eq < 1e-5 && eq * 100.0 < en;
+    printf("[TEST] qr_lstsq Vandermonde n=%zu 系数误差 QR=%.2e 法方程=%.2e %s\n",
+           n, eq, en, ok ? "PASS" : "FAIL");
+    free(A); free(b); free(Aug);
+    return ok;
+}
+
+/* m < n、ldb 不足、秩亏（两列相同） */
+static int test_qr_errors(void) {
+    double A[6 * 3], B[6], X[3], tau[3];
+    for (size_t i = 0; i < 6; ++i) {
+        A[IDX(i,0,3)] = rand_unit();
+        A[IDX(i,1,3)] = A[IDX(i,0,3)];
+        A[IDX(i,2,3)] = rand_unit();
+        B[i] = rand_unit();
+    }
+    int ok = qr_decompose(2, 3, A, 3, tau, 1) == GAUSSIAN_INVALID_INPUT
+          && qr_decompose(6, 3, A, 2, tau, 1) == GAUSSIAN_INVALID_INPUT
+          && qr_lstsq(6, 3, A, 3, 2, B, 1, X, 2, 1) == GAUSSIAN_INVALID_INPUT
+          && qr_lstsq(6, 3, A, 3, 1, B, 1, X, 1, 1) == GAUSSIAN_BAD_MATRIX;
+    printf("[TEST] qr 非法参数 / 秩亏 %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_qr_decompose(1, 1, 1);
+    total++; passed += test_qr_decompose(40, 40, 1);
+    total++; passed += test_qr_decompose(300, 77, 1);
+    total++; passed += test_qr_decompose(500, 130, 3);
+    total++; passed += test_lstsq(200, 30, 2, 1);
+    total++; passed += test_lstsq(20000, 16, 2, 1);
+    total++; passed += test_lstsq(5000, 45, 3, 4);
+    total++; passed += test_lstsq(3001, 64, 1, 3);
+    total++; passed += test_lstsq_vandermonde();
+    total++; passed += test_qr_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,273 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_gemm.h"
+#include "gaussian_qr.h"
+#include "gaussian_svd.h"
+#define TEST_SEED 20241003ULL
+#include "test_gaussian_common.h"
+
+/* 随机 m x n 列正交阵（行跨度 n）：随机矩阵的 QR 的 Q */
+static int rand_orth(size_t m, size_t n, double *Q) {
+    double *W = (double*)malloc(m * n * sizeof(double));
+    double *tau = (double*)malloc(n * sizeof(double));
+    int ok = W && tau;
+    for (size_t i = 0; ok && i < m * n; ++i) W[i] = rand_unit();
+    ok = ok && qr_decompose(m, n, W, n, tau, 1) == GAUSSIAN_SUCCESS
+            && qr_form_q(m, n, W, n, tau, Q, n, 1) == GAUSSIAN_SUCCESS;
+    free(W); free(tau);
+    return ok;
+}
+
+/* ||R R^T - I||_max，R 为 k x n（行跨度 ld） */
+static double orth_err(size_t k, size_t n, const double *R, size_t ld) {
+    double *G = (double*)malloc(k * k * sizeof(double)), e = INFINITY;
+    if (G && gaussian_gemm(GEMM_NO_TRANS, GEMM_TRANS, k, k, n, 1.0, R, ld, R, ld,
+                           0.0, G, k, 1) == GAUSSIAN_SUCCESS) {
+        e = 0.0;
+        for (size_t i = 0; i < k; ++i)
+            for (size_t j = 0; j < k; ++j)
+                if (fabs(G[IDX(i,j,k)] - (i == j)) > e) e = fabs(G[IDX(i,j,k)] - (i == j));
+    }
+    free(G);
+    return e;
+}
+
+/* 随机矩阵：||U^T diag(s) V - A||_max / ||A||_max、U / V 的正交性、s 降序 */
+static int test_svd_random(size_t m, size_t n, size_t nthreads) {
+    const size_t lda = n + 1;
+    double *A = (double*)malloc(m * lda * sizeof(double));
+    double *U = (double*)malloc(n * m * sizeof(double));
+    double *V = (double*)malloc(n * n * sizeof(double));
+    double *s = (double*)malloc(n * sizeof(double));
+    double rec = INFINITY, ou = INFINITY, ov = INFINITY;
+    SvdOptions o;
+    SvdStatus st = {0, 0};
+    svd_options_default(&o);
+    o.nthreads = nthreads;
+    int ok = A && U && V && s;
+    if (ok) {
+        double amax = 0.0;
+        for (size_t i = 0; i < m * lda; ++i) {
+            A[i] = rand_unit();
+            if (fabs(A[i]) > amax) amax = fabs(A[i]);
+        }
+        ok = svd_jacobi(m, n, A, lda, s, U, m, V, n, &o, &st) == GAUSSIAN_SUCCESS;
+        for (size_t i = 1; ok && i < n; ++i) if (s[i] > s[i - 1]) ok = 0;
+        /* A -= U^T (diag(s) V) */
+        for (size_t i = 0; ok && i < n; ++i)
+            for (size_t j = 0; j < n; ++j) V[IDX(i,j,n)] *= s[i];
+        ok = ok && gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, m, n, n, -1.0, U, m, V, n,
+                                 1.0, A, lda, 1) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i)
+            for (size_t j = 0; j < n; ++j) V[IDX(i,j,n)] /= s[i];
+        if (ok) {
+            rec = 0.0;
+            for (size_t i = 0; i < m; ++i)
+                for (size_t j = 0; j < n; ++j)
+                    if (fabs(A[IDX(i,j,lda)]) > rec) rec = fabs(A[IDX(i,j,lda)]);
+            rec /= amax;
+            ou = orth_err(n, m, U, m);
+            ov = orth_err(n, n, V, n);
+        }
+    }
+    ok = ok && rec < 1e-12 && ou < 1e-12 && ov < 1e-12;
+    printf("[TEST] svd_jacobi m=%zu n=%zu threads=%zu sweeps=%zu |USV-A|=%.2e |UUt-I|=%.2e |VVt-I|=%.2e %s\n",
+           m, n, nthreads, st.sweeps, rec, ou, ov, ok ? "PASS" : "FAIL");
+    free(A); free(U); free(V); free(s);
+    return ok;
+}
+
+/* 奇异值从 1 到 1e-12 几何递减（按行缩放的 A = P diag(sigma) Q^T）：小奇异值仍有高相对精度 */
+static int test_svd_graded(void) {
+    const size_t m = 80, n = 30;
+    double *P = (double*)malloc(m * n * sizeof(double));
+    double *Qm = (double*)malloc(n * n * sizeof(double));
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double sig[30], s[30];
+    double rel = INFINITY;
+    int ok = P && Qm && A && rand_orth(m, n, P) && rand_orth(n, n, Qm);
+    for (size_t j = 0; j < n; ++j) sig[j] = pow(1e-12, (double)j / (double)(n - 1));
+    if (ok) {
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j) Qm[IDX(i,j,n)] *= sig[j];
+        ok = gaussian_gemm(GEMM_NO_TRANS, GEMM_TRANS, m, n, n, 1.0, P, n, Qm, n,
+                           0.0, A, n, 1) == GAUSSIAN_SUCCESS
+          && svd_jacobi(m, n, A, n, s, NULL, m, NULL, n, NULL, NULL) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        rel = 0.0;
+        for (size_t j = 0; j < n; ++j)
+            if (fabs(s[j] - sig[j]) / sig[j] > rel) rel = fabs(s[j] - sig[j]) / sig[j];
+    }
+    /* 一般的 A 构造本身带 eps ||A|| 的绝对误差，最小值 1e-12 的相对误差约 1e-4 量级 */
+    ok = ok && rel < 1e-2 && fabs(s[0] - 1.0) < 1e-14;
+    printf("[TEST] svd_jacobi 奇异值 1..1e-12 max 相对误差=%.2e %s\n", rel, ok ? "PASS" : "FAIL");
+    free(P); free(Qm); free(A);
+    return ok;
+}
+
+/* 截断 k：奇异值与全量一致，三元组满足 A v = s u，扫描遍数不多于全量 */
+static int test_svd_truncated(size_t m, size_t n, size_t k, size_t nthreads) {
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double *U = (double*)malloc(k * m * sizeof(double));
+    double *V = (double*)malloc(k * n * sizeof(double));
+    double *AV = (double*)malloc(k * m * sizeof(double));
+    double *s = (double*)malloc(n * sizeof(double));
+    double *sf = (double*)malloc(n * sizeof(double));
+    double ds = INFINITY, res = INFINITY;
+    SvdOptions o;
+    SvdStatus st = {0, 0}, stf = {0, 0};
+    svd_options_default(&o);
+    o.nthreads = nthreads;
+    int ok = A && U && V && AV && s && sf;
+    if (ok) {
+        /* 列尺度按 1/(j+1)^2 衰减 */
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < n; ++j)
+                A[IDX(i,j,n)] = rand_unit() / (double)((j + 1) * (j + 1));
+        ok = svd_jacobi(m, n, A, n, sf, NULL, m, NULL, n, &o, &stf) == GAUSSIAN_SUCCESS;
+        o.k = k;
+        ok = ok && svd_jacobi(m, n, A, n, s, U, m, V, n, &o, &st) == GAUSSIAN_SUCCESS
+                && gaussian_gemm(GEMM_NO_TRANS, GEMM_TRANS, k, m, n, 1.0, V, n, A, n,
+                                 0.0, AV, m, 1) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        ds = res = 0.0;
+        for (size_t c = 0; c < k; ++c) {
+            if (fabs(s[c] - sf[c]) / sf[0] > ds) ds = fabs(s[c] - sf[c]) / sf[0];
+            for (size_t i = 0; i < m; ++i) {
+                double r = fabs(AV[IDX(c,i,m)] - s[c] * U[IDX(c,i,m)]) / sf[0];
+                if (r > res) res = r;
+            }
+        }
+    }
+    ok = ok && ds < 1e-13 && res < 1e-12 && st.sweeps <= stf.sweeps;
+    printf("[TEST] svd_jacobi 截断 m=%zu n=%zu k=%zu 遍数 %zu/%zu |s-s_full|=%.2e |Av-su|=%.2e %s\n",
+           m, n, k, st.sweeps, stf.sweeps, ds, res, ok ? "PASS" : "FAIL");
+    free(A); free(U); free(V); free(AV); free(s); free(sf);
+    return ok;
+}
+
+/* 秩亏 A = B C（m x r 乘 r x n）：数值秩为 r，解等于最小范数解 C^T (C C^T)^{-1} B^+ b */
+static int test_pinv_rank_deficient(size_t m, size_t n, size_t r, size_t nthreads) {
+    double *B = (double*)malloc(m * r * sizeof(double));
+    double *C = (double*)malloc(r * n * sizeof(double));
+    double *A = (double*)malloc(m * n * sizeof(double));
+    double *b = (double*)malloc(m * 2 * sizeof(double));
+    double *bw = (double*)malloc(m * 2 * sizeof(double));
+    double *Bw = (double*)malloc(m * r * sizeof(double));
+    double *y = (double*)malloc(r * 2 * sizeof(double));
+    double *CC = (double*)malloc(r * r * sizeof(double));
+    double *z = (double*)malloc(r * 2 * sizeof(double));
+    double *xr = (double*)malloc(n * 2 * sizeof(double));
+    double *x = (double*)malloc(n * 2 * sizeof(double));
+    size_t *piv = (size_t*)malloc(r * sizeof(size_t));
+    size_t rank = 0;
+    double dx = INFINITY;
+    int ok = B && C && A && b && bw && Bw && y && CC && z && xr && x && piv;
+    if (ok) {
+        for (size_t i = 0; i < m * r; ++i) B[i] = rand_unit();
+        for (size_t i = 0; i < r * n; ++i) C[i] = rand_unit();
+        for (size_t i = 0; i < m * 2; ++i) b[i] = rand_unit();
+        ok = gaussian_gemm(GEMM_NO_TRANS, GEMM_NO_TRANS, m, n, r, 1.0, B, r, C, n,
+                           0.0, A, n, 1) == GAUSSIAN_SUCCESS;
+        /* 参考：y = B^+ b，z = (C C^T)^{-1} y，x = C^T z */
+        memcpy(Bw, B, m * r * sizeof(double));
+        memcpy(bw, b, m * 2 * sizeof(double));
+        ok = ok && qr_lstsq(m, r, Bw, r, 2, bw, 2, y, 2, 1) == GAUSSIAN_SUCCESS
+                && gaussian_gemm(GEMM_NO_TRANS, GEMM_TRANS, r, r, n, 1.0, C, n, C, n,
+                                 0.0, CC, r, 1) == GAUSSIAN_SUCCESS
+                && lu_decompose_pp(r, CC, r, piv) == GAUSSIAN_SUCCESS
+                && lu_solve_multi(r, CC, r, piv, 2, y, 2, z, 2) == GAUSSIAN_SUCCESS
+                && gaussian_gemm(GEMM_TRANS, GEMM_NO_TRANS, n, 2, r, 1.0, C, n, z, 2,
+                                 0.0, xr, 2, 1) == GAUSSIAN_SUCCESS;
+        ok = ok && svd_pinv_solve(m, n, A, n, 2, b, 2, x, 2, 0.0, &rank, nthreads) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        double xm = 0.0;
+        dx = 0.0;
+        for (size_t i = 0; i < n * 2; ++i) {
+            if (fabs(x[i] - xr[i]) > dx) dx = fabs(x[i] - xr[i]);
+            if (fabs(xr[i]) > xm) xm = fabs(xr[i]);
+        }
+        dx /= xm;
+    }
+    ok = ok && rank == r && dx < 1e-10;
+    printf("[TEST] svd_pinv_solve 秩亏 m=%zu n=%zu rank=%zu/%zu |x-x_minnorm|=%.2e %s\n",
+           m, n, rank, r, dx, ok ? "PASS" : "FAIL");
+    free(B); free(C); free(A); free(b); free(bw); free(Bw); free(y); free(CC); free(z);
+    free(xr); free(x); free(piv);
+    return ok;
+}
+
+/* 良态方阵：与 lu_decompose_pp + lu_solve 的解一致，秩为 n */
+static int test_pinv_square(size_t n) {
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *LU = (double*)malloc(n * n * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *bw = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    double *xl = (double*)malloc(n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    size_t rank = 0;
+    double dx = INFINITY;
+    int ok = A && LU && b && bw && x && xl && piv;
+    if (ok) {
+        for (size_t i = 0; i < n * n; ++i) A[i] = rand_unit();
+        for (size_t i = 0; i < n; ++i) { A[IDX(i,i,n)] += (double)n; b[i] = rand_unit(); }
+        memcpy(LU, A, n * n * sizeof(double));
+        memcpy(bw, b, n * sizeof(double));
+        ok = lu_decompose_pp(n, LU, n, piv) == GAUSSIAN_SUCCESS
+          && lu_solve(n, LU, n, piv, b, xl) == GAUSSIAN_SUCCESS
+          && svd_pinv_solve(n, n, A, n, 1, bw, 1, x, 1, 0.0, &rank, 1) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        dx = 0.0;
+        for (size_t i = 0; i < n; ++i) if (fabs(x[i] - xl[i]) > dx) dx = fabs(x[i] - xl[i]);
+    }
+    ok = ok && rank == n && dx < 1e-13;
+    printf("[TEST] svd_pinv_solve 良态 n=%zu rank=%zu |x-x_lu|=%.2e %s\n",
+           n, rank, dx, ok ? "PASS" : "FAIL");
+    free(A); free(LU); free(b); free(bw); free(x); free(xl); free(piv);
+    return ok;
+}
+
+/* 非法参数；零矩阵的秩为 0、解为 0 */
+static int test_svd_errors(void) {
+    double A[12] = {0}, s[3], U[12], V[9], b[4] = {1.0, 2.0, 3.0, 4.0}, x[3] = {1.0, 1.0, 1.0};
+    size_t rank = 99;
+    SvdOptions o;
+    svd_options_default(&o);
+    o.k = 4;
+    int ok = svd_jacobi(2, 3, A, 3, s, NULL, 2, NULL, 3, NULL, NULL) == GAUSSIAN_INVALID_INPUT
+          && svd_jacobi(4, 3, A, 3, s, NULL, 4, NULL, 3, &o, NULL) == GAUSSIAN_INVALID_INPUT
+          && svd_jacobi(4, 3, A, 3, s, U, 3, V, 3, NULL, NULL) == GAUSSIAN_INVALID_INPUT
+          && svd_pinv_solve(4, 3, A, 3, 1, b, 1, x, 1, -1.0, NULL, 1) == GAUSSIAN_INVALID_INPUT
+          && svd_pinv_solve(4, 3, A, 3, 1, b, 1, x, 1, 0.0, &rank, 1) == GAUSSIAN_SUCCESS
+          && rank == 0 && x[0] == 0.0 && x[1] == 0.0 && x[2] == 0.0;
+    printf("[TEST] svd 非法参数 / 零矩阵 %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_svd_random(1, 1, 1);
+    total++; passed += test_svd_random(5, 3, 1);
+    total++; passed += test_svd_random(60, 60, 1);
+    total++; passed += test_svd_random(300, 81, 1);
+    total++; passed += test_svd_random(400, 200, 3);
+    total++; passed += test_svd_graded();
+    total++; passed += test_svd_truncated(300, 120, 5, 1);
+    total++; passed += test_svd_truncated(400, 150, 10, 3);
+    total++; passed += test_pinv_rank_deficient(120, 40, 25, 1);
+    total++; passed += test_pinv_rank_deficient(300, 150, 90, 2);
+    total++; passed += test_pinv_square(150);
+    total++; passed += test_svd_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_tri.h"
+#define TEST_SEED 777ULL
+#include "test_gaussian_common.h"
+
+/* 视图（及其压缩副本）上的 L、U 求解与 lu_solve_multi 一致；PA = L U 由 tri_mult 重建 */
+static int test_lu_views(size_t n, size_t lda, size_t nrhs) {
+    double *A = (double*)malloc(n * lda * sizeof(double));
+    double *LU = (double*)malloc(n * lda * sizeof(double));
+    double *B = (double*)malloc(n * nrhs * sizeof(double));
+    double *X0 = (double*)malloc(n * nrhs * sizeof(double));
+    double *X = (double*)malloc(n * nrhs * sizeof(double));
+    double *M = (double*)malloc(n * n * sizeof(double));
+    double *LP = (double*)malloc(tri_packed_size(n) * sizeof(double));
+    double *UP = (double*)malloc(tri_packed_size(n) * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    int ok = A && LU && B && X0 && X && M && LP && UP && piv;
+    double dsolve = 0.0, dmult = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < n * lda; ++i) A[i] = rand_unit();
+        for (size_t i = 0; i < n * nrhs; ++i) B[i] = rand_unit();
+        memcpy(LU, A, n * lda * sizeof(double));
+        ok = lu_decompose_pp(n, LU, lda, piv) == GAUSSIAN_SUCCESS
+          && lu_solve_multi(n, LU, lda, piv, nrhs, B, nrhs, X0, nrhs) == GAUSSIAN_SUCCESS;
+    }
+    TriMatrix L = lu_view_L(n, LU, lda), U = lu_view_U(n, LU, lda), Lp, Up;
+    ok = ok && tri_pack(&L, LP, &Lp) == GAUSSIAN_SUCCESS && tri_pack(&U, UP, &Up) == GAUSSIAN_SUCCESS;
+    for (int packed = 0; ok && packed < 2; ++packed) {
+        const TriMatrix *Lv = packed ? &Lp : &L, *Uv = packed ? &Up : &U;
+        for (size_t i = 0; i < n; ++i)
+            memcpy(&X[IDX(i,0,nrhs)], &B[IDX(piv[i],0,nrhs)], nrhs * sizeof(double));
+        ok = tri_solve(Lv, nrhs, X, nrhs) == GAUSSIAN_SUCCESS
+          && tri_solve(Uv, nrhs, X, nrhs) == GAUSSIAN_SUCCESS
+          && tri_unpack(Uv, M, n) == GAUSSIAN_SUCCESS
+          && tri_mult(Lv, n, M, n) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n * nrhs; ++i)
+            if (fabs(X[i] - X0[i]) > dsolve) dsolve = fabs(X[i] - X0[i]);
+        for (size_t i = 0; ok && i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+                if (fabs(M[IDX(i,j,n)] - A[IDX(piv[i],j,lda)]) > dmult)
+                    dmult = fabs(M[IDX(i,j,n)] - A[IDX(piv[i],j,lda)]);
+    }
+    ok = ok && dsolve < 1e-9 && dmult < 1e-12;
+    printf("[TEST] LU views n=%zu lda=%zu nrhs=%zu solve diff=%.2e PA-LU=%.2e %s\n",
+           n, lda, nrhs, dsolve, dmult, ok ? "PASS" : "FAIL");
+    free(A); free(LU); free(B); free(X0); free(X); free(M); free(LP); free(UP); free(piv);
+    return ok;
+}
+
+/* 8 种组合（上/下、单位/非单位、稠密/压缩）：tri_get 一致，tri_mult 后 tri_solve 复原 */
+static int test_tri_roundtrip(size_t n, size_t nrhs) {
+    const size_t ld = n + 2;
+    double *A = (double*)malloc(n * ld * sizeof(double));
+    double *AP = (double*)malloc(tri_packed_size(n) * sizeof(double));
+    double *B = (double*)malloc(n * (nrhs + 1) * sizeof(double));
+    double *Y = (double*)malloc(n * (nrhs + 1) * sizeof(double));
+    int ok = A && AP && B && Y;
+    double err = 0.0;
+    for (int combo = 0; ok && combo < 8; ++combo) {
+        TriUplo uplo = (combo & 1) ? TRI_UPPER : TRI_LOWER;
+        TriDiag diag = (combo & 2) ? TRI_UNIT : TRI_NON_UNIT;
+        for (size_t i = 0; i < n * ld; ++i) A[i] = 0.5 * rand_unit();
+        for (size_t i = 0; i < n; ++i) A[IDX(i,i,ld)] = (i % 2 ? 2.0 : -2.0) + 0.5 * rand_unit();
+        TriMatrix F = tri_view(n, A, ld, uplo, diag), P;
+        ok = tri_pack(&F, AP, &P) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+                if (tri_get(&F, i, j) != tri_get(&P, i, j)) ok = 0;
+        const TriMatrix *T = (combo & 4) ? &P : &F;
+        for (size_t i = 0; i < n * (nrhs + 1); ++i) B[i] = Y[i] = rand_unit();
+        ok = ok && tri_mult(T, nrhs, Y, nrhs + 1) == GAUSSIAN_SUCCESS;
+        /* 与逐元素稠密乘积比较 */
+        for (size_t i = 0; ok && i < n; ++i)
+            for (size_t c = 0; c < nrhs; ++c) {
+                double s = 0.0;
+                for (size_t j = 0; j < n; ++j) s += tri_get(T, i, j) * B[IDX(j,c,nrhs + 1)];
+                if (fabs(s - Y[IDX(i,c,nrhs + 1)]) > 1e-12) ok = 0;
+            }
+        ok = ok && tri_solve(T, nrhs, Y, nrhs + 1) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i) {
+            for (size_t c = 0; c < nrhs; ++c)
+                if (fabs(Y[IDX(i,c,nrhs + 1)] - B[IDX(i,c,nrhs + 1)]) > err)
+                    err = fabs(Y[IDX(i,c,nrhs + 1)] - B[IDX(i,c,nrhs + 1)]);
+            if (Y[IDX(i,nrhs,nrhs + 1)] != B[IDX(i,nrhs,nrhs + 1)]) ok = 0;   /* 填充列不被触碰 */
+        }
+    }
+    ok = ok && err < 1e-10;
+    printf("[TEST] tri roundtrip n=%zu nrhs=%zu err=%.2e %s\n", n, nrhs, err, ok ? "PASS" : "FAIL");
+    free(A); free(AP); free(B); free(Y);
+    return ok;
+}
+
+static int test_tri_errors(void) {
+    double A[4] = { 1.0, 0.0, 2.0, 0.0 }, b[2] = { 1.0, 1.0 };
+    TriMatrix T = tri_view(2, A, 2, TRI_LOWER, TRI_NON_UNIT);
+    TriMatrix Tu = tri_view(2, A, 2, TRI_LOWER, TRI_UNIT);
+    TriMatrix Tbad = tri_view(2, A, 1, TRI_LOWER, TRI_UNIT);
+    int ok = tri_solve(&T, 1, b, 1) == GAUSSIAN_BAD_MATRIX
+          && tri_solve(&Tu, 1, b, 1) == GAUSSIAN_SUCCESS && b[0] == 1.0 && b[1] == -1.0
+          && tri_solve(&Tu, 2, b, 1) == GAUSSIAN_INVALID_INPUT
+          && tri_mult(&Tbad, 1, b, 1) == GAUSSIAN_INVALID_INPUT
+          && tri_packed_size(4) == 10;
+    printf("[TEST] tri zero diagonal / invalid input %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_lu_views(1, 1, 1);
+    total++; passed += test_lu_views(70, 73, 1);
+    total++; passed += test_lu_views(131, 131, 9);
+    total++; passed += test_tri_roundtrip(1, 3);
+    total++; passed += test_tri_roundtrip(23, 1);
+    total++; passed += test_tri_roundtrip(45, 6);
+    total++; passed += test_tri_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
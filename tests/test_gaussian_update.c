@@ -0,0 +1,140 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "gaussian_update.h"
+#define TEST_SEED 4242ULL
+#include "test_gaussian_common.h"
+
+/* 求解结果与显式矩阵重新分解的结果比较，返回最大差 */
+static double compare_fresh(size_t n, const double *A, LuUpdate *S, const double *b, double *x) {
+    double *LU = (double*)malloc(n * n * sizeof(double));
+    double *x0 = (double*)malloc(n * sizeof(double));
+    size_t *piv = (size_t*)malloc(n * sizeof(size_t));
+    double diff = INFINITY;
+    if (LU && x0 && piv) {
+        memcpy(LU, A, n * n * sizeof(double));
+        if (lu_decompose_pp(n, LU, n, piv) == GAUSSIAN_SUCCESS
+            && lu_solve(n, LU, n, piv, b, x0) == GAUSSIAN_SUCCESS
+            && lu_update_solve(S, b, x) == GAUSSIAN_SUCCESS) {
+            diff = 0.0;
+            for (size_t i = 0; i < n; ++i)
+                if (fabs(x[i] - x0[i]) > diff) diff = fabs(x[i] - x0[i]);
+        }
+    }
+    free(LU); free(x0); free(piv);
+    return diff;
+}
+
+/* 连续秩 1 / 秩 k 修正：每步解与重新分解一致；累计秩超限时自动重分解 */
+static int test_update_sequence(size_t n, size_t max_rank) {
+    const size_t kmax = 3;
+    double *A = (double*)malloc(n * n * sizeof(double));
+    double *U = (double*)malloc(n * kmax * sizeof(double));
+    double *V = (double*)malloc(n * (kmax + 1) * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    LuUpdate S;
+    LuUpdateOptions opts = { max_rank, 0.0, 0.0 };
+    int ok = A && U && V && b && x;
+    double diff = 0.0;
+    size_t steps = 12;
+    if (ok) {
+        for (size_t i = 0; i < n * n; ++i) A[i] = rand_unit();
+        for (size_t i = 0; i < n; ++i) { A[IDX(i,i,n)] += 4.0; b[i] = rand_unit(); }
+        ok = lu_update_init(&S, n, A, n, &opts) == GAUSSIAN_SUCCESS;
+    }
+    for (size_t step = 0; ok && step < steps; ++step) {
+        size_t k = step % 2 ? kmax : 1;
+        for (size_t i = 0; i < n; ++i)
+            for (size_t c = 0; c < k; ++c) {
+                U[IDX(i,c,k)] = 0.3 * rand_unit();
+                V[IDX(i,c,k + 1)] = 0.3 * rand_unit();      /* ldv = k + 1 */
+            }
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+                for (size_t c = 0; c < k; ++c)
+                    A[IDX(i,j,n)] += U[IDX(i,c,k)] * V[IDX(j,c,k + 1)];
+        ok = lu_update_rank_k(&S, k, U, k, V, k + 1) == GAUSSIAN_SUCCESS
+          && S.rank <= S.max_rank;
+        double d = ok ? compare_fresh(n, A, &S, b, x) : INFINITY;
+        if (d > diff) diff = d;
+    }
+    /* 共 24 个秩：max_rank 不小于该值时全程惰性修正，否则必然发生过自动重分解 */
+    ok = ok && diff < 1e-9
+            && (S.max_rank >= 24 ? S.refactorizations == 0 : S.refactorizations > 0);
+    printf("[TEST] lu_update n=%zu max_rank=%zu diff=%.2e rank=%zu refactorizations=%zu %s\n",
+           n, max_rank, diff, ok ? S.rank : 0, ok ? S.refactorizations : 0, ok ? "PASS" : "FAIL");
+    if (A && U && V && b && x) lu_update_free(&S);
+    free(A); free(U); free(V); free(b); free(x);
+    return ok;
+}
+
+/* 修正使 A 奇异：返回 BAD_MATRIX；反向修正后恢复；使 C 病态的修正触发重分解 */
+static int test_update_singular(void) {
+    const size_t n = 40;
+    double *A = (double*)calloc(n * n, sizeof(double));
+    double *u = (double*)calloc(n, sizeof(double));
+    double *v = (double*)calloc(n, sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    LuUpdate S;
+    int ok = A && u && v && b && x;
+    int inited = 0;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) { A[IDX(i,i,n)] = 2.0 + rand_unit(); b[i] = rand_unit(); }
+        inited = ok = lu_update_init(&S, n, A, n, NULL) == GAUSSIAN_SUCCESS;
+    }
+    if (ok) {
+        /* A += e0 (-a00 e0)^T：a00 -> 0，A 奇异（C = 1 - 1 = 0） */
+        u[0] = 1.0; v[0] = -A[0];
+        ok = lu_update_rank_k(&S, 1, u, 1, v, 1) == GAUSSIAN_BAD_MATRIX && S.singular
+          && lu_update_solve(&S, b, x) == GAUSSIAN_BAD_MATRIX;
+        /* 奇异状态下的修正直接重分解：a00 -> 1e-10 * 原值 */
+        v[0] = 1e-10 * A[0];
+        ok = ok && lu_update_rank_k(&S, 1, u, 1, v, 1) == GAUSSIAN_SUCCESS && !S.singular
+             && S.rank == 0;
+        size_t refac = S.refactorizations;
+        /* 回到原矩阵：C = 1 + 1e10 本身良态，但 A0 病态使 SMW 相消，探测触发重分解 */
+        v[0] = (1.0 - 1e-10) * A[0];
+        ok = ok && lu_update_rank_k(&S, 1, u, 1, v, 1) == GAUSSIAN_SUCCESS
+             && S.rank == 0 && S.refactorizations == refac + 1
+             && lu_update_solve(&S, b, x) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i)
+            if (fabs(x[i] * A[IDX(i,i,n)] - b[i]) > 1e-9) ok = 0;
+    }
+    printf("[TEST] lu_update singular / recovery %s\n", ok ? "PASS" : "FAIL");
+    if (inited) lu_update_free(&S);
+    free(A); free(u); free(v); free(b); free(x);
+    return ok;
+}
+
+static int test_update_errors(void) {
+    double A[4] = { 1, 2, 2, 4 }, B[4] = { 2, 1, 1, 3 }, u[2] = { 1, 0 }, b[2] = { 1, 1 };
+    LuUpdate S;
+    int ok = lu_update_init(&S, 2, A, 2, NULL) == GAUSSIAN_BAD_MATRIX
+          && lu_update_init(&S, 2, B, 1, NULL) == GAUSSIAN_INVALID_INPUT
+          && lu_update_init(&S, 2, B, 2, NULL) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        ok = lu_update_rank_k(&S, 2, u, 1, u, 2) == GAUSSIAN_INVALID_INPUT
+          && lu_update_solve(&S, b, b) == GAUSSIAN_INVALID_INPUT
+          && lu_update_rank_k(&S, 0, u, 1, u, 1) == GAUSSIAN_SUCCESS && S.rank == 0;
+        lu_update_free(&S);
+    }
+    printf("[TEST] lu_update invalid input %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_update_sequence(1, 0);
+    total++; passed += test_update_sequence(90, 0);
+    total++; passed += test_update_sequence(90, 5);
+    total++; passed += test_update_singular();
+    total++; passed += test_update_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "iterative.h"
+#include "sparse.h"
+#define TEST_SEED 99ULL
+#include "test_gaussian_common.h"
+
+typedef GAUSSIAN_Err (*KrylovFn)(const CsrMatrix *A, const double *b, double *x,
+                                 const IterOptions *opts, IterStatus *status);
+
+/* 对流扩散：在 Poisson 上让左右邻点系数不对称 */
+static GAUSSIAN_Err convection_diffusion(size_t nx, size_t ny, CsrMatrix *A) {
+    GAUSSIAN_Err ret = csr_poisson2d(nx, ny, A);
+    if (ret != GAUSSIAN_SUCCESS) return ret;
+    for (size_t i = 0; i < A->nrows; ++i)
+        for (size_t p = A->row_ptr[i]; p < A->row_ptr[i + 1]; ++p) {
+            if (A->col_idx[p] + 1 == i) A->val[p] = -1.4;
+            if (A->col_idx[p] == i + 1) A->val[p] = -0.6;
+        }
+    return GAUSSIAN_SUCCESS;
+}
+
+static double true_residual(const CsrMatrix *A, const double *b, const double *x) {
+    const size_t n = A->nrows;
+    double *r = (double*)malloc(n * sizeof(double));
+    if (!r) return INFINITY;
+    csr_spmv(A, x, r, NULL);
+    double rr = 0.0, bb = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        rr += (b[i] - r[i]) * (b[i] - r[i]);
+        bb += b[i] * b[i];
+    }
+    free(r);
+    return sqrt(rr / bb);
+}
+
+/* 收敛到 tol，真实残差与报告一致，历史长度 = 迭代数 + 1 */
+static int run_case(const char *name, KrylovFn fn, const CsrMatrix *A, IterPrecond pc,
+                    size_t restart, size_t nthreads, size_t *iters) {
+    const size_t n = A->nrows;
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)calloc(n, sizeof(double));
+    double hist[2048];
+    int ok = b && x;
+    double tr = 0.0;
+    IterStatus st = { 0, 0.0, hist, 2048, 0, 0.0 };
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) b[i] = rand_unit();
+        IterOptions opts;
+        iter_options_default(&opts);
+        opts.tol = 1e-10;
+        opts.max_iter = 2000;
+        opts.precond = pc;
+        opts.restart = restart;
+        opts.nthreads = nthreads;
+        ok = fn(A, b, x, &opts, &st) == GAUSSIAN_SUCCESS;
+        tr = true_residual(A, b, x);
+        if (tr > 1e-9 || st.residual > opts.tol) ok = 0;
+        if (st.history_len != st.iterations + 1 || st.history[st.history_len - 1] != st.residual) ok = 0;
+    }
+    printf("[TEST] %s precond=%d restart=%zu threads=%zu iters=%zu residual=%.3g %s\n",
+           name, (int)pc, restart, nthreads, st.iterations, tr, ok ? "PASS" : "FAIL");
+    if (iters) *iters = st.iterations;
+    free(b); free(x);
+    return ok;
+}
+
+/* 预条件应减少迭代数 */
+static int test_precond_helps(const char *name, KrylovFn fn, const CsrMatrix *A, int *passed) {
+    size_t it_none = 0, it_jac = 0, it_ilu = 0;
+    *passed += run_case(name, fn, A, ITER_PRECOND_NONE, 30, 1, &it_none);
+    *passed += run_case(name, fn, A, ITER_PRECOND_JACOBI, 30, 3, &it_jac);
+    *passed += run_case(name, fn, A, ITER_PRECOND_ILU0, 30, 2, &it_ilu);
+    int ok = it_ilu < it_none;
+    printf("[TEST] %s ILU(0) iters %zu < none %zu %s\n", name, it_ilu, it_none, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+static int test_not_converged_and_trivial(void) {
+    CsrMatrix A;
+    int ok = csr_poisson2d(20, 20, &A) == GAUSSIAN_SUCCESS;
+    double b[400], x[400];
+    IterOptions opts;
+    iter_options_default(&opts);
+    opts.max_iter = 3;
+    IterStatus st = { 0, 0.0, NULL, 0, 0, 0.0 };
+    for (size_t i = 0; i < 400; ++i) { b[i] = 1.0; x[i] = 0.0; }
+    ok = ok && krylov_cg(&A, b, x, &opts, &st) == GAUSSIAN_NOT_CONVERGED && st.iterations == 3
+            && krylov_gmres(&A, b, x, &opts, &st) == GAUSSIAN_NOT_CONVERGED && st.iterations == 3;
+    for (size_t i = 0; i < 400; ++i) { b[i] = 0.0; x[i] = 5.0; }
+    ok = ok && krylov_bicgstab(&A, b, x, NULL, NULL) == GAUSSIAN_SUCCESS && x[17] == 0.0;
+    printf("[TEST] krylov max_iter / zero rhs %s\n", ok ? "PASS" : "FAIL");
+    csr_free(&A);
+    return ok;
+}
+
+/* CG 遇到不定矩阵、ILU(0) 遇到缺失对角元 */
+static int test_breakdowns(void) {
+    const double D[9] = { 1, 0, 0,  0, -1, 0,  0, 0, 2 };
+    const double Z[9] = { 1, 1, 0,  1, 0, 1,  0, 1, 1 };
+    CsrMatrix A, B;
+    double b[3] = { 1, 1, 1 }, x[3] = { 0, 0, 0 };
+    IterOptions opts;
+    iter_options_default(&opts);
+    int ok = csr_from_dense(3, 3, D, 3, 0.0, &A) == GAUSSIAN_SUCCESS
+          && krylov_cg(&A, b, x, &opts, NULL) == GAUSSIAN_NOT_SPD;
+    /* csr_from_dense 总保留对角元：手工删掉 (1,1) */
+    ok = ok && csr_from_dense(3, 3, Z, 3, 0.0, &B) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        B.row_ptr[2] -= 1;
+        for (size_t q = 4; q < B.nnz; ++q) { B.col_idx[q - 1] = B.col_idx[q]; B.val[q - 1] = B.val[q]; }
+        B.row_ptr[3] -= 1;
+        B.nnz -= 1;
+        opts.precond = ITER_PRECOND_ILU0;
+        ok = krylov_gmres(&B, b, x, &opts, NULL) == GAUSSIAN_BAD_MATRIX;
+        csr_free(&B);
+    }
+    printf("[TEST] krylov breakdown detection %s\n", ok ? "PASS" : "FAIL");
+    csr_free(&A);
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    CsrMatrix P, C;
+    if (csr_poisson2d(40, 30, &P) != GAUSSIAN_SUCCESS || convection_diffusion(30, 30, &C) != GAUSSIAN_SUCCESS) {
+        printf("[TEST] setup FAIL\n");
+        return 1;
+    }
+    int ok = test_precond_helps("cg", krylov_cg, &P, &passed);
+    total += 4; passed += ok;
+    ok = test_precond_helps("bicgstab", krylov_bicgstab, &C, &passed);
+    total += 4; passed += ok;
+    ok = test_precond_helps("gmres", krylov_gmres, &C, &passed);
+    total += 4; passed += ok;
+    total++; passed += run_case("gmres", krylov_gmres, &C, ITER_PRECOND_JACOBI, 5, 1, NULL);
+    total++; passed += run_case("gmres", krylov_gmres, &P, ITER_PRECOND_ILU0, 200, 1, NULL);
+    total++; passed += test_not_converged_and_trivial();
+    total++; passed += test_breakdowns();
+    csr_free(&P);
+    csr_free(&C);
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparse.h"
+#include "thread_pool.h"
+#define TEST_SEED 777ULL
+#include "test_gaussian_common.h"
+
+/* 稀疏随机矩阵 -> CSR -> 稠密 往返一致，SpMV 与稠密乘积一致 */
+static int test_csr_dense_roundtrip(size_t nrows, size_t ncols, size_t nthreads) {
+    const size_t lda = ncols + 3;
+    double *D = (double*)calloc(nrows * lda, sizeof(double));
+    double *D2 = (double*)malloc(nrows * lda * sizeof(double));
+    double *x = (double*)malloc(ncols * sizeof(double));
+    double *y = (double*)malloc(nrows * sizeof(double));
+    CsrMatrix A;
+    memset(&A, 0, sizeof(A));
+    int ok = D && D2 && x && y;
+    double diff = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < nrows; ++i)
+            for (size_t j = 0; j < ncols; ++j)
+                if (rand_unit() > 0.8) D[IDX(i,j,lda)] = rand_unit();
+        for (size_t j = 0; j < ncols; ++j) x[j] = rand_unit();
+        ThreadPool *pool = nthreads == 1 ? NULL : thread_pool_create(nthreads);
+        ok = csr_from_dense(nrows, ncols, D, lda, 0.0, &A) == GAUSSIAN_SUCCESS
+          && csr_to_dense(&A, D2, lda) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < nrows; ++i)
+            if (memcmp(D + i * lda, D2 + i * lda, ncols * sizeof(double)) != 0) ok = 0;
+        for (size_t i = 0; ok && i < nrows; ++i)
+            for (size_t p = A.row_ptr[i] + 1; p < A.row_ptr[i + 1]; ++p)
+                if (A.col_idx[p] <= A.col_idx[p - 1]) ok = 0;
+        if (ok) {
+            csr_spmv(&A, x, y, pool);
+            for (size_t i = 0; i < nrows; ++i) {
+                double sum = 0.0;
+                for (size_t j = 0; j < ncols; ++j) sum += D[IDX(i,j,lda)] * x[j];
+                if (fabs(sum - y[i]) > diff) diff = fabs(sum - y[i]);
+            }
+            if (diff > 1e-13) ok = 0;
+        }
+        thread_pool_destroy(pool);
+    }
+    printf("[TEST] csr dense roundtrip + spmv %zux%zu nnz=%zu threads=%zu diff=%.3g %s\n",
+           nrows, ncols, A.nnz, nthreads, diff, ok ? "PASS" : "FAIL");
+    csr_free(&A);
+    free(D); free(D2); free(x); free(y);
+    return ok;
+}
+
+/* Poisson：非零元个数、对称性、行和（内部行为 0） */
+static int test_poisson2d(size_t nx, size_t ny) {
+    CsrMatrix A;
+    const size_t n = nx * ny;
+    int ok = csr_poisson2d(nx, ny, &A) == GAUSSIAN_SUCCESS;
+    double *D = ok ? (double*)malloc(n * n * sizeof(double)) : NULL;
+    if (ok && D) {
+        ok = A.row_ptr[n] == A.nnz && csr_to_dense(&A, D, n) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i) {
+            double rs = 0.0;
+            for (size_t j = 0; j < n; ++j) {
+                if (D[IDX(i,j,n)] != D[IDX(j,i,n)]) ok = 0;
+                rs += D[IDX(i,j,n)];
+            }
+            size_t ix = i % nx, iy = i / nx;
+            int interior = ix > 0 && ix + 1 < nx && iy > 0 && iy + 1 < ny;
+            if (interior && rs != 0.0) ok = 0;
+            if (D[IDX(i,i,n)] != 4.0) ok = 0;
+        }
+    } else {
+        ok = 0;
+    }
+    printf("[TEST] csr_poisson2d %zux%zu nnz=%zu %s\n", nx, ny, ok ? A.nnz : 0, ok ? "PASS" : "FAIL");
+    if (D) free(D);
+    csr_free(&A);
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_csr_dense_roundtrip(1, 1, 1);
+    total++; passed += test_csr_dense_roundtrip(37, 53, 1);
+    total++; passed += test_csr_dense_roundtrip(5000, 40, 3);
+    total++; passed += test_poisson2d(1, 1);
+    total++; passed += test_poisson2d(7, 5);
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
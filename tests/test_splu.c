@@ -0,0 +1,250 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "sparse.h"
+#include "splu.h"
+#define TEST_SEED 31337ULL
+#include "test_gaussian_common.h"
+
+static int is_permutation(size_t n, const size_t *perm) {
+    unsigned char *seen = (unsigned char*)calloc(n, 1);
+    int ok = seen != NULL;
+    for (size_t i = 0; ok && i < n; ++i) {
+        if (perm[i] >= n || seen[perm[i]]) ok = 0;
+        else seen[perm[i]] = 1;
+    }
+    free(seen);
+    return ok;
+}
+
+static double rel_residual(const CsrMatrix *A, const double *b, const double *x) {
+    const size_t n = A->nrows;
+    double *r = (double*)malloc(n * sizeof(double));
+    if (!r) return INFINITY;
+    csr_spmv(A, x, r, NULL);
+    double rr = 0.0, bb = 0.0;
+    for (size_t i = 0; i < n; ++i) { rr += (b[i] - r[i]) * (b[i] - r[i]); bb += b[i] * b[i]; }
+    free(r);
+    return sqrt(rr / bb);
+}
+
+/* 随机非对称稀疏矩阵（对角占优）：三种排序下求解与稠密 gauss_pp_core 一致 */
+static int test_splu_random(size_t n, SpluOrdering ord) {
+    const size_t lda = n + 1;
+    double *D = (double*)calloc(n * lda, sizeof(double));
+    double *xr = (double*)malloc(n * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    CsrMatrix A;
+    SpluSymbolic sym;
+    SpluNumeric num = { 0 };
+    memset(&A, 0, sizeof(A));
+    memset(&sym, 0, sizeof(sym));
+    int ok = D && xr && b && x;
+    double diff = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) {
+            for (int t = 0; t < 4; ++t) {
+                size_t j = (size_t)((rand_unit() + 1.0) * 0.5 * (double)n) % n;
+                D[IDX(i,j,lda)] = rand_unit();
+            }
+            D[IDX(i,i,lda)] = 6.0 + rand_unit();
+            b[i] = D[IDX(i,n,lda)] = rand_unit();
+        }
+        ok = csr_from_dense(n, n, D, lda, 0.0, &A) == GAUSSIAN_SUCCESS
+          && splu_analyze(&A, ord, &sym) == GAUSSIAN_SUCCESS
+          && is_permutation(n, sym.perm)
+          && splu_factor(&sym, &A, &num) == GAUSSIAN_SUCCESS
+          && splu_solve(&num, b, x) == GAUSSIAN_SUCCESS
+          && gauss_pp_core(n, D, lda, xr) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i) {
+            double d = fabs(x[i] - xr[i]) / (1.0 + fabs(xr[i]));
+            if (d > diff) diff = d;
+        }
+        /* 全取对角主元时，实际 L/U 是 A + A^T 模式预测的子集 */
+        if (diff > 1e-12
+            || (num.off_diag_pivots == 0 && num.nnz_l + num.nnz_u > sym.nnz_l + sym.nnz_u)) ok = 0;
+    }
+    printf("[TEST] splu random n=%zu order=%d nnz=%zu fill=%zu off-diag pivots=%zu diff=%.3g %s\n",
+           n, (int)ord, A.nnz, sym.fill_in, num.off_diag_pivots, diff, ok ? "PASS" : "FAIL");
+    splu_numeric_free(&num);
+    splu_symbolic_free(&sym);
+    csr_free(&A);
+    free(D); free(xr); free(b); free(x);
+    return ok;
+}
+
+/* Poisson：排序后填充少于自然序；同一符号分析重复做数值分解 */
+static int test_splu_poisson_refactor(size_t nx) {
+    CsrMatrix A;
+    SpluSymbolic s_nat, s_rcm, s_md;
+    SpluNumeric num = { 0 };
+    const size_t n = nx * nx;
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    int ok = b && x && csr_poisson2d(nx, nx, &A) == GAUSSIAN_SUCCESS
+          && splu_analyze(&A, SPLU_ORDER_NATURAL, &s_nat) == GAUSSIAN_SUCCESS
+          && splu_analyze(&A, SPLU_ORDER_RCM, &s_rcm) == GAUSSIAN_SUCCESS
+          && splu_analyze(&A, SPLU_ORDER_MINDEG, &s_md) == GAUSSIAN_SUCCESS;
+    double res = 0.0;
+    if (ok) {
+        ok = s_md.fill_in < s_nat.fill_in && s_rcm.fill_in <= s_nat.fill_in;
+        for (size_t i = 0; i < n; ++i) b[i] = rand_unit();
+        /* 时间步进：对角随步数变化，模式不变 */
+        for (int step = 0; ok && step < 3; ++step) {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t q = A.row_ptr[i]; q < A.row_ptr[i + 1]; ++q)
+                    if (A.col_idx[q] == i) A.val[q] = 4.0 + 0.5 * step;
+            ok = splu_factor(&s_md, &A, &num) == GAUSSIAN_SUCCESS
+              && splu_solve(&num, b, x) == GAUSSIAN_SUCCESS;
+            double r = rel_residual(&A, b, x);
+            if (r > res) res = r;
+        }
+        if (res > 1e-13) ok = 0;
+        printf("[TEST] splu poisson %zux%zu fill natural=%zu rcm=%zu mindeg=%zu factor=%.1f KiB residual=%.3g %s\n",
+               nx, nx, s_nat.fill_in, s_rcm.fill_in, s_md.fill_in,
+               (double)(s_md.numeric_bytes + s_md.symbolic_bytes) / 1024.0, res, ok ? "PASS" : "FAIL");
+        splu_symbolic_free(&s_nat);
+        splu_symbolic_free(&s_rcm);
+        splu_symbolic_free(&s_md);
+        splu_numeric_free(&num);
+        csr_free(&A);
+    } else {
+        printf("[TEST] splu poisson setup FAIL\n");
+    }
+    free(b); free(x);
+    return ok;
+}
+
+/* 奇异、模式不一致、col_idx 越界或行内无序 */
+static int test_splu_errors(void) {
+    const double D[4] = { 1, 2, 2, 4 };
+    const double E[9] = { 2, 1, 0,  1, 2, 1,  0, 1, 2 };
+    CsrMatrix A, B, C;
+    SpluSymbolic sym;
+    SpluNumeric num = { 0 };
+    int ok = csr_from_dense(2, 2, D, 2, 0.0, &A) == GAUSSIAN_SUCCESS
+          && splu_analyze(&A, SPLU_ORDER_NATURAL, &sym) == GAUSSIAN_SUCCESS
+          && splu_factor(&sym, &A, &num) == GAUSSIAN_BAD_MATRIX;
+    splu_symbolic_free(&sym);
+    ok = ok && csr_from_dense(3, 3, E, 3, 0.0, &B) == GAUSSIAN_SUCCESS
+            && csr_from_dense(3, 3, E, 3, 1.5, &C) == GAUSSIAN_SUCCESS
+            && splu_analyze(&B, SPLU_ORDER_MINDEG, &sym) == GAUSSIAN_SUCCESS
+            && splu_factor(&sym, &C, &num) == GAUSSIAN_INVALID_INPUT
+            && splu_factor(&sym, &B, &num) == GAUSSIAN_SUCCESS;
+    if (ok) {
+        /* row_ptr 相同、col_idx 不同：模式不一致 */
+        size_t *ci = B.col_idx;
+        size_t alt[7] = { 0, 2,  0, 1, 2,  1, 2 }, perm[3];
+        B.col_idx = alt;
+        ok = splu_factor(&sym, &B, &num) == GAUSSIAN_INVALID_INPUT;
+        /* 行内无序 / 重复 / 越界 */
+        alt[0] = 1; alt[1] = 0;
+        ok = ok && splu_analyze(&B, SPLU_ORDER_NATURAL, &sym) == GAUSSIAN_INVALID_INPUT;
+        alt[0] = 0; alt[1] = 0;
+        ok = ok && csr_order_rcm(&B, perm) == GAUSSIAN_INVALID_INPUT;
+        alt[1] = 3;
+        ok = ok && splu_analyze(&B, SPLU_ORDER_MINDEG, &sym) == GAUSSIAN_INVALID_INPUT;
+        B.col_idx = ci;
+    }
+    printf("[TEST] splu singular / pattern mismatch / bad col_idx %s\n", ok ? "PASS" : "FAIL");
+    splu_symbolic_free(&sym);
+    splu_numeric_free(&num);
+    csr_free(&A); csr_free(&B); csr_free(&C);
+    return ok;
+}
+
+/* 对角为零 / 偏弱：阈值部分主元换行后照常分解 */
+static int test_splu_weak_diagonal(void) {
+    const double P[4] = { 0, 1,  1, 0 };
+    const double W[9] = { 1e-6, 1, 0,  1, 1, 1,  0, 1, 4 };
+    const double S[9] = { 1e-2, 1, 0,  1, 3, 1,  0, 1, 4 };
+    const double *M[3] = { P, W, S };
+    const size_t dim[3] = { 2, 3, 3 };
+    double b[3] = { 1, 2, 3 }, x[3];
+    int ok = 1;
+    size_t swaps = 0;
+    for (int t = 0; ok && t < 3; ++t) {
+        CsrMatrix A;
+        SpluSymbolic sym;
+        SpluNumeric num = { 0 };
+        ok = csr_from_dense(dim[t], dim[t], M[t], dim[t], 0.0, &A) == GAUSSIAN_SUCCESS;
+        if (!ok) break;
+        ok = splu_analyze(&A, SPLU_ORDER_NATURAL, &sym) == GAUSSIAN_SUCCESS
+          && splu_factor(&sym, &A, &num) == GAUSSIAN_SUCCESS
+          && num.off_diag_pivots > 0
+          && splu_solve(&num, b, x) == GAUSSIAN_SUCCESS
+          && rel_residual(&A, b, x) < 1e-13;
+        swaps += num.off_diag_pivots;
+        if (ok) splu_symbolic_free(&sym);
+        splu_numeric_free(&num);
+        csr_free(&A);
+    }
+    printf("[TEST] splu zero / weak diagonal off-diag pivots=%zu %s\n", swaps, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+/* KKT（鞍点）矩阵 [H B^T; B 0]：对角块为零，须换行；与稠密 gauss_pp_core 比较 */
+static int test_splu_kkt(size_t n1, size_t m, SpluOrdering ord) {
+    const size_t n = n1 + m, lda = n + 1;
+    double *D = (double*)calloc(n * lda, sizeof(double));
+    double *xr = (double*)malloc(n * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)malloc(n * sizeof(double));
+    CsrMatrix A;
+    SpluSymbolic sym;
+    SpluNumeric num = { 0 };
+    memset(&A, 0, sizeof(A));
+    memset(&sym, 0, sizeof(sym));
+    int ok = D && xr && b && x;
+    double diff = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < n1; ++i) {
+            D[IDX(i,i,lda)] = 4.0 + rand_unit();
+            if (i + 1 < n1) D[IDX(i,i + 1,lda)] = D[IDX(i + 1,i,lda)] = -1.0;
+        }
+        for (size_t r = 0; r < m; ++r)
+            for (int t = 0; t < 3; ++t) {
+                size_t j = (size_t)((rand_unit() + 1.0) * 0.5 * (double)n1) % n1;
+                D[IDX(n1 + r,j,lda)] = D[IDX(j,n1 + r,lda)] = 1.0 + rand_unit();
+            }
+        for (size_t i = 0; i < n; ++i) b[i] = D[IDX(i,n,lda)] = rand_unit();
+        ok = csr_from_dense(n, n, D, lda, 0.0, &A) == GAUSSIAN_SUCCESS
+          && splu_analyze(&A, ord, &sym) == GAUSSIAN_SUCCESS
+          && splu_factor(&sym, &A, &num) == GAUSSIAN_SUCCESS
+          && splu_solve(&num, b, x) == GAUSSIAN_SUCCESS
+          && gauss_pp_core(n, D, lda, xr) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i) {
+            double d = fabs(x[i] - xr[i]) / (1.0 + fabs(xr[i]));
+            if (d > diff) diff = d;
+        }
+        if (diff > 1e-10 || rel_residual(&A, b, x) > 1e-12) ok = 0;
+    }
+    printf("[TEST] splu kkt n=%zu+%zu order=%d off-diag pivots=%zu diff=%.3g %s\n",
+           n1, m, (int)ord, num.off_diag_pivots, diff, ok ? "PASS" : "FAIL");
+    splu_numeric_free(&num);
+    splu_symbolic_free(&sym);
+    csr_free(&A);
+    free(D); free(xr); free(b); free(x);
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    for (int ord = SPLU_ORDER_NATURAL; ord <= SPLU_ORDER_MINDEG; ++ord) {
+        total++; passed += test_splu_random(1, (SpluOrdering)ord);
+        total++; passed += test_splu_random(150, (SpluOrdering)ord);
+    }
+    total++; passed += test_splu_poisson_refactor(30);
+    total++; passed += test_splu_errors();
+    total++; passed += test_splu_weak_diagonal();
+    for (int ord = SPLU_ORDER_NATURAL; ord <= SPLU_ORDER_MINDEG; ++ord) {
+        total++; passed += test_splu_kkt(60, 20, (SpluOrdering)ord);
+    }
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Gaussian.h"
+#include "iterative.h"
+#include "sparse.h"
+#define TEST_SEED 2718ULL
+#include "test_gaussian_common.h"
+
+static const char *method_name(StationaryMethod m) {
+    return m == STATIONARY_JACOBI ? "jacobi" : (m == STATIONARY_GAUSS_SEIDEL ? "gauss-seidel" : "sor");
+}
+
+/* Poisson（CSR）：收敛、真实残差达标，返回迭代数；x_out 可为 NULL */
+static int run_poisson(StationaryMethod m, double omega, size_t nthreads, size_t *iters, double *x_out) {
+    const size_t nx = 24, n = nx * nx;
+    CsrMatrix A;
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)calloc(n, sizeof(double));
+    double *r = (double*)malloc(n * sizeof(double));
+    double hist[8192];
+    IterStatus st = { 0, 0.0, hist, 8192, 0, 0.0 };
+    int ok = b && x && r && csr_poisson2d(nx, nx, &A) == GAUSSIAN_SUCCESS;
+    double tr = 0.0;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) b[i] = 1.0 + 0.5 * sin((double)i);   /* 各用例相同 */
+        IterOptions opts;
+        iter_options_default(&opts);
+        opts.max_iter = 8000;
+        opts.omega = omega;
+        opts.nthreads = nthreads;
+        ok = stationary_solve_csr(&A, b, x, m, &opts, &st) == GAUSSIAN_SUCCESS;
+        csr_spmv(&A, x, r, NULL);
+        double rr = 0.0, bb = 0.0;
+        for (size_t i = 0; i < n; ++i) { rr += (b[i] - r[i]) * (b[i] - r[i]); bb += b[i] * b[i]; }
+        tr = sqrt(rr / bb);
+        if (tr > opts.tol || fabs(tr - st.residual) > 1e-12 || st.history_len != st.iterations) ok = 0;
+        if (x_out) memcpy(x_out, x, n * sizeof(double));
+        csr_free(&A);
+    }
+    printf("[TEST] %s csr omega=%.3f threads=%zu iters=%zu residual=%.3g %s\n",
+           method_name(m), st.omega, nthreads, st.iterations, tr, ok ? "PASS" : "FAIL");
+    if (iters) *iters = st.iterations;
+    free(b); free(x); free(r);
+    return ok;
+}
+
+/* 迭代数：SOR(自动) < GS < Jacobi；红黑 GS 的结果与线程数无关 */
+static int test_poisson_methods(int *passed, int *total) {
+    size_t it_j = 0, it_gs = 0, it_sor = 0, it_fixed = 0;
+    double *x1 = (double*)malloc(576 * sizeof(double)), *x3 = (double*)malloc(576 * sizeof(double));
+    if (!x1 || !x3) { free(x1); free(x3); return 0; }
+    (*total) += 5;
+    *passed += run_poisson(STATIONARY_JACOBI, 0.0, 1, &it_j, NULL);
+    *passed += run_poisson(STATIONARY_GAUSS_SEIDEL, 0.0, 1, &it_gs, x1);
+    *passed += run_poisson(STATIONARY_GAUSS_SEIDEL, 0.0, 3, NULL, x3);
+    *passed += run_poisson(STATIONARY_SOR, 0.0, 2, &it_sor, NULL);
+    *passed += run_poisson(STATIONARY_SOR, 1.5, 1, &it_fixed, NULL);
+    int ok = it_sor < it_fixed && it_fixed < it_gs && it_gs < it_j && memcmp(x1, x3, 576 * sizeof(double)) == 0;
+    printf("[TEST] iterations jacobi=%zu gs=%zu sor(1.5)=%zu sor(auto)=%zu, threads-invariant %s\n",
+           it_j, it_gs, it_fixed, it_sor, ok ? "PASS" : "FAIL");
+    free(x1); free(x3);
+    return ok;
+}
+
+/* 稠密（lda > n）：带状对角占优 + 一个全稠密块，与 gauss_pp_core 对照 */
+static int test_dense(size_t n, size_t lda, StationaryMethod m, size_t nthreads) {
+    double *A = (double*)calloc(n * lda, sizeof(double));
+    double *Aug = (double*)malloc(n * (n + 1) * sizeof(double));
+    double *b = (double*)malloc(n * sizeof(double));
+    double *x = (double*)calloc(n, sizeof(double));
+    double *xr = (double*)malloc(n * sizeof(double));
+    int ok = A && Aug && b && x && xr;
+    double diff = 0.0;
+    IterStatus st = { 0, 0.0, NULL, 0, 0, 0.0 };
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j)
+                if (j + 2 >= i && j <= i + 2) A[IDX(i,j,lda)] = rand_unit();
+            if (i < 8) for (size_t j = 0; j < 8 && j < n; ++j) A[IDX(i,j,lda)] = rand_unit();
+            A[IDX(i,i,lda)] = 8.0;
+            b[i] = rand_unit();
+            for (size_t j = 0; j < n; ++j) Aug[IDX(i,j,n+1)] = A[IDX(i,j,lda)];
+            Aug[IDX(i,n,n+1)] = b[i];
+        }
+        IterOptions opts;
+        iter_options_default(&opts);
+        opts.tol = 1e-12;
+        opts.nthreads = nthreads;
+        ok = stationary_solve_dense(n, A, lda, b, x, m, &opts, &st) == GAUSSIAN_SUCCESS
+          && gauss_pp_core(n, Aug, n + 1, xr) == GAUSSIAN_SUCCESS;
+        for (size_t i = 0; ok && i < n; ++i)
+            if (fabs(x[i] - xr[i]) > diff) diff = fabs(x[i] - xr[i]);
+        if (diff > 1e-10) ok = 0;
+    }
+    printf("[TEST] %s dense n=%zu lda=%zu threads=%zu iters=%zu diff=%.3g %s\n",
+           method_name(m), n, lda, nthreads, st.iterations, diff, ok ? "PASS" : "FAIL");
+    free(A); free(Aug); free(b); free(x); free(xr);
+    return ok;
+}
+
+static int test_errors(void) {
+    const double Z[4] = { 0, 1, 1, 2 };
+    const double D[4] = { 1, 0.99, 0.99, 1 };      /* 收敛极慢 */
+    double b[2] = { 1, 2 }, x[2] = { 0, 0 };
+    IterOptions opts;
+    iter_options_default(&opts);
+    int ok = stationary_solve_dense(2, Z, 2, b, x, STATIONARY_GAUSS_SEIDEL, &opts, NULL) == GAUSSIAN_BAD_MATRIX;
+    opts.omega = 2.5;
+    ok = ok && stationary_solve_dense(2, D, 2, b, x, STATIONARY_SOR, &opts, NULL) == GAUSSIAN_INVALID_INPUT;
+    opts.omega = 0.0;
+    opts.max_iter = 20;
+    IterStatus st = { 0, 0.0, NULL, 0, 0, 0.0 };
+    ok = ok && stationary_solve_dense(2, D, 2, b, x, STATIONARY_JACOBI, &opts, &st) == GAUSSIAN_NOT_CONVERGED
+            && st.iterations == 20 && st.residual > opts.tol;
+    printf("[TEST] stationary zero diagonal / bad omega / max_iter %s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    int ok = test_poisson_methods(&passed, &total);
+    total++; passed += ok;
+    total++; passed += test_dense(60, 64, STATIONARY_JACOBI, 1);
+    total++; passed += test_dense(60, 64, STATIONARY_GAUSS_SEIDEL, 2);
+    total++; passed += test_dense(97, 97, STATIONARY_SOR, 3);
+    total++; passed += test_errors();
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}
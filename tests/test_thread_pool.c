@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "thread_pool.h"
+
+/* parallel_for：每个下标恰好被访问一次 */
+typedef struct {
+    atomic_int *hits;
+} ForCtx;
+
+static void for_body(void *p, size_t b, size_t e) {
+    ForCtx *ctx = (ForCtx*)p;
+    for (size_t i = b; i < e; ++i) atomic_fetch_add(&ctx->hits[i], 1);
+}
+
+static int test_parallel_for(size_t nthreads, size_t n, size_t grain) {
+    ThreadPool *pool = thread_pool_create(nthreads);
+    atomic_int *hits = (atomic_int*)malloc(n * sizeof(atomic_int));
+    int ok = pool && hits;
+    if (ok) {
+        for (size_t i = 0; i < n; ++i) atomic_init(&hits[i], 0);
+        ForCtx ctx = { hits };
+        thread_pool_parallel_for(pool, n, grain, for_body, &ctx);
+        for (size_t i = 0; i < n; ++i)
+            if (atomic_load(&hits[i]) != 1) { ok = 0; break; }
+    }
+    printf("[TEST] parallel_for threads=%zu n=%zu grain=%zu %s\n",
+           nthreads, n, grain, ok ? "PASS" : "FAIL");
+    free(hits);
+    thread_pool_destroy(pool);
+    return ok;
+}
+
+/* 任务图：菱形依赖链，检查每个任务执行时其前驱均已完成 */
+#define GRAPH_LAYERS 40
+#define GRAPH_WIDTH 8
+
+typedef struct {
+    atomic_int done[GRAPH_LAYERS][GRAPH_WIDTH];
+    atomic_int violations;
+} GraphState;
+
+typedef struct {
+    GraphState *st;
+    int layer, col;
+} GraphNode;
+
+static void graph_body(void *p) {
+    GraphNode *node = (GraphNode*)p;
+    GraphState *st = node->st;
+    if (node->layer > 0)
+        for (int c = 0; c < GRAPH_WIDTH; ++c)
+            if (!atomic_load(&st->done[node->layer - 1][c]))
+                atomic_fetch_add(&st->violations, 1);
+    atomic_store(&st->done[node->layer][node->col], 1);
+}
+
+static int test_task_graph(size_t nthreads) {
+    static GraphState st;
+    static GraphNode nodes[GRAPH_LAYERS][GRAPH_WIDTH];
+    size_t ids[GRAPH_LAYERS][GRAPH_WIDTH];
+    for (int l = 0; l < GRAPH_LAYERS; ++l)
+        for (int c = 0; c < GRAPH_WIDTH; ++c) atomic_init(&st.done[l][c], 0);
+    atomic_init(&st.violations, 0);
+
+    ThreadPool *pool = thread_pool_create(nthreads);
+    TaskGraph *g = task_graph_create();
+    int ok = pool && g;
+    /* 逆序添加，确保调度依赖的是依赖关系而非添加顺序 */
+    for (int l = GRAPH_LAYERS - 1; ok && l >= 0; --l) {
+        for (int c = 0; c < GRAPH_WIDTH; ++c) {
+            nodes[l][c] = (GraphNode){ &st, l, c };
+            ids[l][c] = task_graph_add(g, graph_body, &nodes[l][c], c);
+            if (ids[l][c] == TASK_GRAPH_INVALID) ok = 0;
+        }
+    }
+    for (int l = 1; ok && l < GRAPH_LAYERS; ++l)
+        for (int c = 0; c < GRAPH_WIDTH; ++c)
+            for (int d = 0; d < GRAPH_WIDTH; ++d)
+                if (task_graph_depend(g, ids[l-1][d], ids[l][c]) != 0) ok = 0;
+    if (ok) {
+        task_graph_run(g, pool);
+        for (int l = 0; l < GRAPH_LAYERS; ++l)
+            for (int c = 0; c < GRAPH_WIDTH; ++c)
+                if (!atomic_load(&st.done[l][c])) ok = 0;
+        if (atomic_load(&st.violations) != 0) ok = 0;
+    }
+    printf("[TEST] task_graph threads=%zu violations=%d %s\n",
+           nthreads, atomic_load(&st.violations), ok ? "PASS" : "FAIL");
+    task_graph_destroy(g);
+    thread_pool_destroy(pool);
+    return ok;
+}
+
+int main(void) {
+    int passed = 0, total = 0;
+    total++; passed += test_parallel_for(1, 1000, 0);
+    total++; passed += test_parallel_for(4, 1000, 7);
+    total++; passed += test_parallel_for(3, 5, 0);
+    total++; passed += test_task_graph(1);
+    total++; passed += test_task_graph(4);
+
+    printf("[TEST] 通过 %d / %d 个用例\n", passed, total);
+    return (passed == total) ? 0 : 1;
+}